@@ -6,9 +6,14 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/ActionQueue.hpp"
+#include "helics/core/MessagePool.hpp"
 #include "helics_benchmark_main.h"
 
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace helics;  // NOLINT
 
@@ -99,6 +104,32 @@ static void BMdepacketize(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BMdepacketize);
 
+static void BMpacketizeIndividual(benchmark::State& state)
+{
+    const std::vector<ActionMessage> batch(state.range(0), testMessage1);
+    for (auto _ : state) {
+        std::vector<std::string> packets(batch.size());
+        for (std::size_t ii = 0; ii < batch.size(); ++ii) {
+            batch[ii].packetize(packets[ii]);
+        }
+        benchmark::DoNotOptimize(packets);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMpacketizeIndividual)->Range(8, 512);
+
+static void BMpacketizeBatch(benchmark::State& state)
+{
+    const std::vector<ActionMessage> batch(state.range(0), testMessage1);
+    std::string load;
+    for (auto _ : state) {
+        packetizeBatch(batch, load);
+        benchmark::DoNotOptimize(load);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMpacketizeBatch)->Range(8, 512);
+
 static void BMpacketizeStrings(benchmark::State& state)
 {
     ActionMessage obj(CMD_MULTI_MESSAGE);
@@ -134,6 +165,80 @@ static void BMdepacketizeStrings(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BMdepacketizeStrings);
 
+static ActionMessage generateRoutedMessage()
+{
+    ActionMessage obj(CMD_SEND_MESSAGE);
+    obj.payload = "message payload data";
+    obj.setStringData("fed1/destination_endpoint",
+                      "fed2/source_endpoint",
+                      "fed2/source_endpoint",
+                      "fed1/destination_endpoint");
+    return obj;
+}
+
+static void BMcopyStrings(benchmark::State& state)
+{
+    const auto obj = generateRoutedMessage();
+    for (auto _ : state) {
+        ActionMessage copy(obj);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.counters["sizeof"] = static_cast<double>(sizeof(ActionMessage));
+}
+// Register the function as a benchmark
+BENCHMARK(BMcopyStrings);
+
+static void BMmoveStrings(benchmark::State& state)
+{
+    auto obj = generateRoutedMessage();
+    for (auto _ : state) {
+        ActionMessage moved(std::move(obj));
+        obj = std::move(moved);
+        benchmark::DoNotOptimize(obj);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMmoveStrings);
+
+static void BMsetStrings(benchmark::State& state)
+{
+    ActionMessage obj(CMD_SEND_MESSAGE);
+    for (auto _ : state) {
+        obj.setStringData("fed1/destination_endpoint",
+                          "fed2/source_endpoint",
+                          "fed2/source_endpoint",
+                          "fed1/destination_endpoint");
+        benchmark::DoNotOptimize(obj);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMsetStrings);
+
+// round trip of a message through a command and back as done for sending and receiving messages
+static void BMmessageRoundTrip(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto message = createMessageFromCommand(generateRoutedMessage());
+        ActionMessage cmd(std::move(message));
+        benchmark::DoNotOptimize(cmd);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMmessageRoundTrip);
+
+static void BMmessageRoundTripPooled(benchmark::State& state)
+{
+    MessagePool pool;
+    for (auto _ : state) {
+        auto message = createMessageFromCommand(generateRoutedMessage(), pool.acquire());
+        ActionMessage cmd(std::move(*message));
+        pool.release(std::move(message));
+        benchmark::DoNotOptimize(cmd);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMmessageRoundTripPooled);
+
 // benchmarks with the Json serialization of actionMessage
 
 static void BMtoStringJson(benchmark::State& state)
@@ -251,4 +356,43 @@ static void BMdepacketizeStringsJson(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BMdepacketizeStringsJson);
 
+// benchmarks of the primary action queue with several producers and a single consumer
+
+static void BMactionQueue(benchmark::State& state, ActionQueue::QueueType type)
+{
+    const auto producers = static_cast<int>(state.range(0));
+    static constexpr int messageCount{10000};
+    for (auto _ : state) {
+        ActionQueue queue;
+        queue.setQueueType(type);
+        std::vector<std::thread> threads;
+        threads.reserve(producers);
+        for (int pp = 0; pp < producers; ++pp) {
+            threads.emplace_back([&queue]() {
+                for (int ii = 0; ii < messageCount; ++ii) {
+                    queue.push(ActionMessage(CMD_PUB));
+                }
+            });
+        }
+        for (int ii = 0; ii < producers * messageCount; ++ii) {
+            benchmark::DoNotOptimize(queue.pop());
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * producers * messageCount);
+}
+// Register the function as a benchmark
+BENCHMARK_CAPTURE(BMactionQueue, blocking, ActionQueue::QueueType::BLOCKING)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BMactionQueue, lockfree, ActionQueue::QueueType::LOCK_FREE)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
 HELICS_BENCHMARK_MAIN(actionMessageBenchmark);
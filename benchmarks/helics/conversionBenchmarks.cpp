@@ -5,13 +5,19 @@ Innovation LLC.  See the top-level NOTICE for additional details. All rights res
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include "helics/application_api/TypedInterfaces.hpp"
 #include "helics/application_api/ValueConverter.hpp"
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/CoreFactory.hpp"
 #include "helics_benchmark_main.h"
 
 #include <benchmark/benchmark.h>
+#include <memory>
 #include <string>
 #include <vector>
 
+using helics::CoreType;
+
 template<class T>
 static void BMconversion(benchmark::State& state, const T& arg)
 {
@@ -69,4 +75,69 @@ BENCHMARK_CAPTURE(BMinterpret,
 
 BENCHMARK_CAPTURE(BMinterpret, vector_interp, std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
 
+/** measure reading inputs after each time step, either through the general conversions of Input
+or through the fixed type decoding of TypedInput.  All the inputs subscribe to a single publication
+of the same type so a new value is available on every input each step.  A single federate on a
+test core keeps the core overhead of each step out of the timed section*/
+template<class T>
+static void BMinputRead(benchmark::State& state, const T& arg, bool typed)
+{
+    constexpr int inputCount{256};
+    auto core = helics::CoreFactory::create(CoreType::TEST,
+                                            "--autobroker --federates=1 --log_level=no_print");
+    helics::FederateInfo fedInfo;
+    fedInfo.coreName = core->getIdentifier();
+    helics::ValueFederate fed("reader", fedInfo);
+    helics::TypedPublication<T> pub(&fed, "source");
+    std::vector<helics::TypedInput<T>> inputs;
+    inputs.reserve(inputCount);
+    for (int ii = 0; ii < inputCount; ++ii) {
+        inputs.emplace_back(fed.registerSubscription(pub.getPublication().getName()));
+    }
+    fed.enterExecutingMode();
+    const T val{arg};
+    T out{};
+    for (auto _ : state) {
+        state.PauseTiming();
+        pub.publish(val);
+        fed.requestNextStep();
+        state.ResumeTiming();
+        if (typed) {
+            for (auto& input : inputs) {
+                benchmark::DoNotOptimize(input.getValue());
+            }
+        } else {
+            for (auto& input : inputs) {
+                input.getInput().getValue(out);
+                benchmark::DoNotOptimize(out);
+            }
+        }
+    }
+    fed.finalize();
+    core.reset();
+    helics::cleanupHelicsLibrary();
+    state.SetItemsProcessed(state.iterations() * inputCount);
+}
+
+BENCHMARK_CAPTURE(BMinputRead, double_input, -356.56e-27, false);
+BENCHMARK_CAPTURE(BMinputRead, double_typed, -356.56e-27, true);
+
+BENCHMARK_CAPTURE(BMinputRead, int64_input, int64_t{-12351341}, false);
+BENCHMARK_CAPTURE(BMinputRead, int64_typed, int64_t{-12351341}, true);
+
+BENCHMARK_CAPTURE(BMinputRead, complex_input, std::complex<double>{45.7, -19.5}, false);
+BENCHMARK_CAPTURE(BMinputRead, complex_typed, std::complex<double>{45.7, -19.5}, true);
+
+BENCHMARK_CAPTURE(BMinputRead, string_input, std::string{"test a longer string"}, false);
+BENCHMARK_CAPTURE(BMinputRead, string_typed, std::string{"test a longer string"}, true);
+
+BENCHMARK_CAPTURE(BMinputRead,
+                  vector_input,
+                  std::vector<double>{26.5, 18.6, -48.5, -5.4e-12},
+                  false);
+BENCHMARK_CAPTURE(BMinputRead,
+                  vector_typed,
+                  std::vector<double>{26.5, 18.6, -48.5, -5.4e-12},
+                  true);
+
 HELICS_BENCHMARK_MAIN(conversionBenchmark);
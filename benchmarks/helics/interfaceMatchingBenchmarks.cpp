@@ -0,0 +1,80 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/ValueFederate.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using helics::CoreType;
+
+/** measure the time to register interfaces on N federates each with M publications and M inputs
+and get all the federates into executing mode.  Each input targets a publication on the next
+federate, and each federate uses a separate core so the connections are all matched in the broker*/
+static void BMinterfaceMatching(benchmark::State& state)
+{
+    const auto fedCount = static_cast<int>(state.range(0));
+    const auto interfaceCount = static_cast<int>(state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        const std::string brokerArgs = "--federates=" + std::to_string(fedCount);
+        auto broker = helics::BrokerFactory::create(CoreType::TEST, brokerArgs);
+        broker->setLoggingLevel(HELICS_LOG_LEVEL_NO_PRINT);
+
+        const std::string coreArgs =
+            "--federates=1 --log_level=no_print --broker=" + broker->getIdentifier();
+        std::vector<std::shared_ptr<helics::Core>> cores(fedCount);
+        std::vector<std::unique_ptr<helics::ValueFederate>> feds(fedCount);
+        for (int ii = 0; ii < fedCount; ++ii) {
+            cores[ii] = helics::CoreFactory::create(CoreType::TEST, coreArgs);
+            cores[ii]->connect();
+            helics::FederateInfo fedInfo;
+            fedInfo.coreName = cores[ii]->getIdentifier();
+            feds[ii] = std::make_unique<helics::ValueFederate>("fed" + std::to_string(ii), fedInfo);
+        }
+        state.ResumeTiming();
+        for (int ii = 0; ii < fedCount; ++ii) {
+            const auto target = "pub_" + std::to_string((ii + 1) % fedCount) + "_";
+            const auto prefix = "pub_" + std::to_string(ii) + "_";
+            for (int jj = 0; jj < interfaceCount; ++jj) {
+                feds[ii]->registerGlobalPublication<double>(prefix + std::to_string(jj));
+                feds[ii]->registerSubscription(target + std::to_string(jj));
+            }
+        }
+        for (auto& fed : feds) {
+            fed->enterExecutingModeAsync();
+        }
+        for (auto& fed : feds) {
+            fed->enterExecutingModeComplete();
+        }
+        state.PauseTiming();
+        for (auto& fed : feds) {
+            fed->finalize();
+        }
+        feds.clear();
+        broker->waitForDisconnect();
+        broker.reset();
+        cores.clear();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["connections"] =
+        benchmark::Counter(static_cast<double>(fedCount) * interfaceCount);
+}
+
+BENCHMARK(BMinterfaceMatching)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Ranges({{2, 64}, {16, 4096}})
+    ->Iterations(1)
+    ->UseRealTime();
+
+HELICS_BENCHMARK_MAIN(interfaceMatchingBenchmark);
@@ -177,6 +177,20 @@ BENCHMARK_CAPTURE (BMsendMessage, multiCore/ipcCore, CoreType::IPC)
 
 #endif
 
+#ifdef HELICS_ENABLE_SHM_CORE
+// Register the shared memory benchmarks
+// clang-format off
+BENCHMARK_CAPTURE(BMsendMessage, multiCore/shmCore, CoreType::SHM)
+    // clang-format on
+    //->RangeMultiplier (2)
+    ->Ranges({{1, 1 << 20}, {1, 1}})  // large messages are sent in pieces through the ring
+    ->Ranges({{1, 1}, {1, 1 << 9}})
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#endif
+
 #ifdef HELICS_ENABLE_TCP_CORE
 // Register the TCP benchmarks
 // clang-format off
@@ -0,0 +1,39 @@
+# ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+# Copyright (c) 2017-2026, Battelle Memorial Institute; Lawrence Livermore
+# National Security, LLC; Alliance for Energy Innovation LLC.
+# See the top-level NOTICE for additional details.
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+# locate the lz4 and zstd libraries used for compressing network frames, either one is sufficient
+find_path(LZ4_INCLUDE_DIR NAMES lz4.h)
+find_library(LZ4_LIBRARY NAMES lz4 liblz4)
+find_path(ZSTD_INCLUDE_DIR NAMES zstd.h)
+find_library(ZSTD_LIBRARY NAMES zstd libzstd zstd_static)
+mark_as_advanced(LZ4_INCLUDE_DIR LZ4_LIBRARY ZSTD_INCLUDE_DIR ZSTD_LIBRARY)
+
+set(HELICS_COMPRESSION_INCLUDE_DIRS)
+set(HELICS_COMPRESSION_LIBRARIES)
+
+if(LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+    set(HELICS_HAVE_LZ4 ON)
+    list(APPEND HELICS_COMPRESSION_INCLUDE_DIRS ${LZ4_INCLUDE_DIR})
+    list(APPEND HELICS_COMPRESSION_LIBRARIES ${LZ4_LIBRARY})
+    message(STATUS "lz4 compression enabled: ${LZ4_LIBRARY}")
+endif()
+
+if(ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    set(HELICS_HAVE_ZSTD ON)
+    list(APPEND HELICS_COMPRESSION_INCLUDE_DIRS ${ZSTD_INCLUDE_DIR})
+    list(APPEND HELICS_COMPRESSION_LIBRARIES ${ZSTD_LIBRARY})
+    message(STATUS "zstd compression enabled: ${ZSTD_LIBRARY}")
+endif()
+
+if(NOT HELICS_HAVE_LZ4 AND NOT HELICS_HAVE_ZSTD)
+    message(
+        FATAL_ERROR
+            "neither lz4 nor zstd was found, one of them is needed for HELICS_ENABLE_COMPRESSION"
+    )
+endif()
@@ -10,5 +10,6 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "application_api/Inputs.hpp"
 #include "application_api/Publications.hpp"
 #include "application_api/Subscriptions.hpp"
+#include "application_api/TypedInterfaces.hpp"
 #include "application_api/ValueFederate.hpp"
 #include "core/helics_definitions.hpp"
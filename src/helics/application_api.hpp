@@ -18,5 +18,6 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "application_api/Publications.hpp"
 #include "application_api/Subscriptions.hpp"
 #include "application_api/Translator.hpp"
+#include "application_api/TypedInterfaces.hpp"
 #include "application_api/queryFunctions.hpp"
 #include "core/helics_definitions.hpp"
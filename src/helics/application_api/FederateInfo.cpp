@@ -245,7 +245,7 @@ static constexpr frozen::unordered_map<std::string_view, int, 97> flagStringsTra
     {"disableremotecontrol", HELICS_FLAG_DISABLE_REMOTE_CONTROL},
     {"disable_remote_control", HELICS_FLAG_DISABLE_REMOTE_CONTROL}};
 
-static constexpr frozen::unordered_map<std::string_view, int, 42> optionStringsTranslations{
+static constexpr frozen::unordered_map<std::string_view, int, 45> optionStringsTranslations{
     {"buffer_data", HELICS_HANDLE_OPTION_BUFFER_DATA},
     {"bufferdata", HELICS_HANDLE_OPTION_BUFFER_DATA},
     {"bufferData", HELICS_HANDLE_OPTION_BUFFER_DATA},
@@ -280,6 +280,9 @@ static constexpr frozen::unordered_map<std::string_view, int, 42> optionStringsT
     {"connections", HELICS_HANDLE_OPTION_CONNECTIONS},
     {"timerestricted", HELICS_HANDLE_OPTION_TIME_RESTRICTED},
     {"timeRestricted", HELICS_HANDLE_OPTION_TIME_RESTRICTED},
+    {"publication_group", HELICS_HANDLE_OPTION_PUBLICATION_GROUP},
+    {"publicationgroup", HELICS_HANDLE_OPTION_PUBLICATION_GROUP},
+    {"publicationGroup", HELICS_HANDLE_OPTION_PUBLICATION_GROUP},
     {"clear_priority_list", HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST},
     {"clearPriorityList", HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST},
     {"clearprioritylist", HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST},
@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "units/units.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <string>
@@ -559,6 +560,10 @@ bool Input::checkUpdate(bool assumeUpdate)
                     defV val;
                     integerExtractAndConvert(val, dv, inputUnits, outputUnits);
                     valueExtract(val, newVal);
+                } else if (vectorUnitConversion) {
+                    defV val;
+                    vectorExtractAndConvert(val, dv);
+                    valueExtract(val, newVal);
                 } else {
                     valueExtract(dv, injectionType, newVal);
                 }
@@ -772,6 +777,57 @@ void Input::loadSourceInformation()
             }
         }
     }
+    loadVectorUnitConversion();
+}
+
+void Input::loadVectorUnitConversion()
+{
+    vectorUnitConversion = false;
+    if (!inputUnits || !outputUnits || multiUnits ||
+        (injectionType != DataType::HELICS_VECTOR &&
+         injectionType != DataType::HELICS_COMPLEX_VECTOR)) {
+        return;
+    }
+    const double offset = units::convert(0.0, *inputUnits, *outputUnits);
+    const double scale = units::convert(1.0, *inputUnits, *outputUnits) - offset;
+    // conversions that are not a simple scale and offset are not precomputed
+    const double check = units::convert(100.0, *inputUnits, *outputUnits);
+    if (!std::isfinite(offset) || !std::isfinite(scale) ||
+        std::abs(check - (100.0 * scale + offset)) > 1e-9 * std::max(std::abs(check), 1.0)) {
+        return;
+    }
+    if ((scale == 1.0 && offset == 0.0) ||
+        (injectionType == DataType::HELICS_COMPLEX_VECTOR && offset != 0.0)) {
+        return;
+    }
+    unitScale = scale;
+    unitOffset = offset;
+    vectorUnitConversion = true;
+}
+
+void Input::convertVectorUnits(defV& val) const
+{
+    if (!vectorUnitConversion) {
+        return;
+    }
+    // local copies so the loops do not reload the factors and can be vectorized
+    const double scale = unitScale;
+    const double offset = unitOffset;
+    if (auto* vect = std::get_if<std::vector<double>>(&val)) {
+        for (auto& element : *vect) {
+            element = element * scale + offset;
+        }
+    } else if (auto* cvect = std::get_if<std::vector<std::complex<double>>>(&val)) {
+        for (auto& element : *cvect) {
+            element *= scale;
+        }
+    }
+}
+
+void Input::vectorExtractAndConvert(defV& store, const data_view& dv) const
+{
+    valueExtract(dv, injectionType, store);
+    convertVectorUnits(store);
 }
 
 double doubleExtractAndConvert(const data_view& dv,
@@ -805,6 +861,34 @@ data_view Input::checkAndGetFedUpdate()
         data_view{};
 }
 
+bool Input::extractNumericUpdate(const data_view& dv, double& out)
+{
+    if (injectionType == DataType::HELICS_DOUBLE) {
+        out = doubleExtractAndConvert(dv, inputUnits, outputUnits);
+    } else if (injectionType == DataType::HELICS_INT) {
+        out = static_cast<double>(ValueConverter<int64_t>::interpret(dv));
+        if ((inputUnits) && (outputUnits)) {
+            out = units::convert(out, *inputUnits, *outputUnits);
+        }
+    } else {
+        return false;
+    }
+    lastValue = out;
+    hasUpdate = false;
+    return true;
+}
+
+bool Input::directDecodeAllowed(DataType type)
+{
+    if (injectionType == DataType::HELICS_UNKNOWN) {
+        loadSourceInformation();
+    }
+    if (injectionType != type || multiUnits || !sourceTypes.empty()) {
+        return false;
+    }
+    return !inputUnits || !outputUnits || *inputUnits == *outputUnits;
+}
+
 void Input::forceCoreDataUpdate()
 {
     if (fed == nullptr) {
@@ -812,7 +896,7 @@ void Input::forceCoreDataUpdate()
     }
     auto dv = fed->getBytes(*this);
     if (!dv.empty()) {
-        valueExtract(dv, injectionType, lastValue);
+        vectorExtractAndConvert(lastValue, dv);
     } else if (getMultiInputMode() != MultiInputHandlingMethod::NO_OP) {
         fed->forceCoreUpdate(*this);
     }
@@ -861,6 +945,10 @@ char Input::getValueChar()
             int64_t out = invalidValue<int64_t>();
             if (injectionType == helics::DataType::HELICS_DOUBLE) {
                 out = static_cast<int64_t>(doubleExtractAndConvert(dv, inputUnits, outputUnits));
+            } else if (vectorUnitConversion) {
+                defV val;
+                vectorExtractAndConvert(val, dv);
+                valueExtract(val, out);
             } else {
                 valueExtract(dv, injectionType, out);
             }
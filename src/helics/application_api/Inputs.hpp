@@ -50,6 +50,7 @@ class HELICS_CXX_EXPORT Input: public Interface {
     bool disableAssign{false};  //!< disable assignment for the object
     bool useThreshold{false};  //!< flag to indicate use a threshold for binary output
     bool multiUnits{false};  //!< flag indicating there are multiple Input Units
+    bool vectorUnitConversion{false};  //!< vector data is converted with the precomputed factors
     MultiInputHandlingMethod inputVectorOp{
         MultiInputHandlingMethod::NO_OP};  //!< the vector processing method to use
     int32_t prevInputCount{0};  //!< the previous number of inputs
@@ -62,6 +63,8 @@ class HELICS_CXX_EXPORT Input: public Interface {
     std::string givenTarget;  //!< the first target set for the input
     double delta{-1.0};  //!< the minimum difference
     double threshold{0.0};  //!< the threshold to use for binary decisions
+    double unitScale{1.0};  //!< the precomputed unit conversion scale for vector data
+    double unitOffset{0.0};  //!< the precomputed unit conversion offset for vector data
     // this needs to match the defV type
     std::variant<std::function<void(const double&, Time)>,
                  std::function<void(const int64_t&, Time)>,
@@ -408,6 +411,13 @@ class HELICS_CXX_EXPORT Input: public Interface {
   private:
     /** load some information about the data source such as type and units*/
     void loadSourceInformation();
+    /** precompute the conversion of vector data from the input units to the output units*/
+    void loadVectorUnitConversion();
+    /** apply the precomputed unit conversion to vector data stored in a variant*/
+    void convertVectorUnits(defV& val) const;
+    /** decode vector data to its native type and apply the unit conversion
+    @details used whenever a conversion is active so every requested type sees converted values*/
+    void vectorExtractAndConvert(defV& store, const data_view& dv) const;
     /** helper class for getting a character since that is a bit odd*/
     char getValueChar();
     /** check if updates from the federate are allowed*/
@@ -417,8 +427,16 @@ class HELICS_CXX_EXPORT Input: public Interface {
             inputVectorOp == MultiInputHandlingMethod::NO_OP;
     }
     data_view checkAndGetFedUpdate();
+    /** decode double or integer data straight to a double for bulk retrieval
+    @return false if the data needs the general conversion*/
+    bool extractNumericUpdate(const data_view& dv, double& out);
     void forceCoreDataUpdate();
+    /** check if data of a specific type can be decoded without any conversion
+    @details loads the source information if it is not already known*/
+    bool directDecodeAllowed(DataType type);
     friend class ValueFederateManager;
+    template<class X>
+    friend class TypedInput;
 };
 
 /** convert a dataview to a double and do a unit conversion if appropriate*/
@@ -449,6 +467,10 @@ void Input::getValue_impl(std::integral_constant<int, primaryType> /*V*/, X& out
             defV val;
             integerExtractAndConvert(val, dv, inputUnits, outputUnits);
             valueExtract(val, out);
+        } else if (vectorUnitConversion) {
+            defV val;
+            vectorExtractAndConvert(val, dv);
+            valueExtract(val, out);
         } else {
             valueExtract(dv, injectionType, out);
         }
@@ -509,6 +531,10 @@ const X& Input::getValueRef()
                 defV val;
                 integerExtractAndConvert(val, dv, inputUnits, outputUnits);
                 valueExtract(val, out);
+            } else if (vectorUnitConversion) {
+                defV val;
+                vectorExtractAndConvert(val, dv);
+                valueExtract(val, out);
             } else {
                 valueExtract(dv, injectionType, out);
             }
@@ -516,7 +542,7 @@ const X& Input::getValueRef()
                 lastValue = make_valid(std::move(out));
             }
         } else {
-            valueExtract(dv, injectionType, lastValue);
+            vectorExtractAndConvert(lastValue, dv);
         }
     } else {
         if (checkForNeededCoreRetrieval(lastValue.index(),
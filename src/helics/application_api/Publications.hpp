@@ -262,6 +262,8 @@ class HELICS_CXX_EXPORT Publication: public Interface {
     void publishString(std::string_view val);
     void publishDefV(const defV& val);
     friend class ValueFederateManager;
+    template<class X>
+    friend class TypedPublication;
 };
 
 }  // namespace helics
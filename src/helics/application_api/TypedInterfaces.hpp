@@ -0,0 +1,155 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ValueFederate.hpp"
+
+#include <complex>
+#include <string>
+#include <vector>
+
+/** @file
+@details inputs and publications with a value type fixed at compile time
+*/
+
+namespace helics {
+
+/** check if a type is sent as its own binary representation when published with its own type
+@details bool and Time have their own wire formats so go through the general conversions*/
+template<class X>
+constexpr bool hasDirectEncoding()
+{
+    return helicsType<X>() != DataType::HELICS_CUSTOM && helicsType<X>() != DataType::HELICS_BOOL &&
+        helicsType<X>() != DataType::HELICS_TIME;
+}
+
+/** an input whose value has a fixed type
+@details the value is stored as an X instead of the variant used by Input.  Once the source is
+known, if the publication has the same type and no unit conversion is needed, updates are decoded
+straight into the stored value, otherwise the value goes through the conversions of the Input.
+Change detection and multi-input handling on the Input also use the general path.  The direct path
+does not update the value held by the Input so the input should only be read through this object
+@tparam X the type of the value
+*/
+template<class X>
+class TypedInput {
+    static_assert(hasDirectEncoding<X>(),
+                  "TypedInput requires a type with a direct binary encoding");
+
+  private:
+    Input* input{nullptr};  //!< the input the values come from
+    X value{};  //!< storage for the value
+    bool resolved{false};  //!< the conversion path has been determined
+    bool direct{false};  //!< updates are decoded without conversion
+
+  public:
+    TypedInput() = default;
+    /** construct from an existing input*/
+    explicit TypedInput(Input& inp): input(&inp) {}
+    /** register an input of type X
+    @param valueFed the ValueFederate to use
+    @param key the name of the input
+    @param units the units associated with the input
+    */
+    TypedInput(ValueFederate* valueFed,
+               std::string_view key,
+               std::string_view units = std::string_view{}):
+        input(&valueFed->registerInput<X>(key, units))
+    {
+    }
+    /** get the underlying input*/
+    Input& getInput() const { return *input; }
+    /** check if the input has been updated*/
+    bool isUpdated() const { return input->isUpdated(); }
+    /** check if updates are decoded without conversion*/
+    bool isDirect() const { return direct; }
+    /** set the default value of the input*/
+    void setDefault(const X& val)
+    {
+        value = val;
+        input->setDefault(val);
+    }
+    /** get the latest value*/
+    const X& getValue()
+    {
+        if (!resolved) {
+            resolve();
+        }
+        if (direct && !input->changeDetectionEnabled &&
+            input->inputVectorOp == MultiInputHandlingMethod::NO_OP) {
+            auto dv = input->checkAndGetFedUpdate();
+            if (!dv.empty()) {
+                ValueConverter<X>::interpret(dv, value);
+            }
+            input->hasUpdate = false;
+        } else {
+            input->getValue(value);
+        }
+        return value;
+    }
+
+  private:
+    /** determine the conversion path once the source of the input is known*/
+    void resolve()
+    {
+        if (input->getHelicsInjectionType() == DataType::HELICS_UNKNOWN && !input->isUpdated()) {
+            // the source is not known until the first value arrives
+            return;
+        }
+        direct = input->directDecodeAllowed(helicsType<X>());
+        resolved = true;
+    }
+};
+
+/** a publication whose value has a fixed type
+@details if the publication has the same type as X and change detection is not enabled values are
+encoded into a buffer reused for each publish, otherwise the publish functions of the Publication
+are used
+@tparam X the type of the value
+*/
+template<class X>
+class TypedPublication {
+    static_assert(hasDirectEncoding<X>(),
+                  "TypedPublication requires a type with a direct binary encoding");
+
+  private:
+    Publication* pub{nullptr};  //!< the publication to send values through
+    SmallBuffer buffer;  //!< storage for the encoded value
+
+  public:
+    TypedPublication() = default;
+    /** construct from an existing publication*/
+    explicit TypedPublication(Publication& publication): pub(&publication) {}
+    /** register a publication of type X
+    @param valueFed the ValueFederate to use
+    @param key the name of the publication
+    @param units the units associated with the publication
+    */
+    TypedPublication(ValueFederate* valueFed,
+                     std::string_view key,
+                     std::string_view units = std::string_view{}):
+        pub(&valueFed->registerPublication<X>(key, units))
+    {
+    }
+
+    /** get the underlying publication*/
+    Publication& getPublication() const { return *pub; }
+    /** publish a value*/
+    void publish(const X& val)
+    {
+        if (pub->pubType == helicsType<X>() && !pub->changeDetectionEnabled) {
+            if (pub->fed != nullptr) {
+                ValueConverter<X>::convert(val, buffer);
+                pub->fed->publishBytes(*pub, buffer);
+            }
+        } else {
+            pub->publish(val);
+        }
+    }
+};
+
+}  // namespace helics
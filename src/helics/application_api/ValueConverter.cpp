@@ -11,6 +11,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/frozen_map.h"
 
 #include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <utility>
 #include <vector>
@@ -84,6 +87,41 @@ static const std::byte endianCode = checks::isLittleEndian() ? std::byte{0} : st
 static constexpr const std::byte littleEndianCode{0x0};
 // static constexpr const std::byte bigEndianCode{0x01};
 
+/** reverse the byte order of an 8 byte value*/
+static inline std::uint64_t byteSwap64(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    value = ((value & 0x00FF00FF00FF00FFULL) << 8U) | ((value >> 8U) & 0x00FF00FF00FF00FFULL);
+    value = ((value & 0x0000FFFF0000FFFFULL) << 16U) | ((value >> 16U) & 0x0000FFFF0000FFFFULL);
+    return (value << 32U) | (value >> 32U);
+#endif
+}
+
+/** copy an array of doubles out of a serialized buffer fixing the byte order if needed
+@details the byte order is fixed in the same pass as the copy, the loop is kept simple enough for
+compilers to vectorize it*/
+static inline void
+    copyDoubles(const std::byte* source, double* dest, std::size_t count, bool swapOrder)
+{
+    if (count == 0) {
+        return;
+    }
+    if (!swapOrder) {
+        std::memcpy(dest, source, count * sizeof(double));
+        return;
+    }
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        std::uint64_t word;
+        std::memcpy(&word, source + ii * sizeof(double), sizeof(double));
+        word = byteSwap64(word);
+        std::memcpy(dest + ii, &word, sizeof(double));
+    }
+}
+
 static inline void addCodeAndSize(std::byte* data, std::byte code, size_t size)
 {
     std::memset(data, 0, 8);
@@ -261,29 +299,18 @@ void convertFromBinary(const std::byte* data, std::vector<double>& val)
 {
     const std::size_t size = getDataSize(data);
     val.resize(size);
-    if (size > 0) {
-        std::memcpy(val.data(), data + 8, size * sizeof(double));
-    }
-    if ((data[0] & endianMask) != littleEndianCode) {
-        for (auto& element : val) {
-            checks::swapBytes<8>(reinterpret_cast<std::byte*>(&element));
-        }
-    }
+    copyDoubles(data + 8, val.data(), size, (data[0] & endianMask) != littleEndianCode);
 }
 
 void convertFromBinary(const std::byte* data, double* val)
 {
-    const std::size_t size = getDataSize(data);
-    if (val != nullptr && size > 0) {
-        std::memcpy(val, data + 8, size * sizeof(double));
-    }
-    if ((data[0] & endianMask) != littleEndianCode) {
-        double* currentVal = val;
-        double* end = currentVal + size;
-        while (currentVal != end) {
-            checks::swapBytes<8>(reinterpret_cast<std::byte*>(currentVal++));
-        }
+    if (val == nullptr) {
+        return;
     }
+    copyDoubles(data + 8,
+                val,
+                getDataSize(data),
+                (data[0] & endianMask) != littleEndianCode);
 }
 #if defined(__GNUC__)
 #    pragma GCC diagnostic push
@@ -294,19 +321,12 @@ void convertFromBinary(const std::byte* data, std::vector<std::complex<double>>&
 {
     const std::size_t size = getDataSize(data);
     val.resize(size);
-    if (size > 0) {
-        std::memcpy(reinterpret_cast<double*>(val.data()),
-                    data + 8,
-                    size * sizeof(std::complex<double>));
-    }
-    if ((data[0] & endianMask) != littleEndianCode) {
-        for (auto& value : val) {
-            // making use of array oriented access for complex numbers
-            // See https://en.cppreference.com/w/cpp/numeric/complex
-            checks::swapBytes<8>(reinterpret_cast<std::byte*>(&value));
-            checks::swapBytes<8>(reinterpret_cast<std::byte*>(&value) + 8);
-        }
-    }
+    // making use of array oriented access for complex numbers
+    // See https://en.cppreference.com/w/cpp/numeric/complex
+    copyDoubles(data + 8,
+                reinterpret_cast<double*>(val.data()),
+                size * 2,
+                (data[0] & endianMask) != littleEndianCode);
 }
 #if defined(__GNUC__)
 #    pragma GCC diagnostic pop
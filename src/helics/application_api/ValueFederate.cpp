@@ -147,6 +147,12 @@ void ValueFederate::addAlias(const Input& inp, std::string_view shortcutName)
 {
     vfManager->addAlias(inp, shortcutName);
 }
+
+void ValueFederate::addToPublicationGroup(Publication& pub)
+{
+    pub.setOption(defs::Options::PUBLICATION_GROUP, 1);
+}
+
 void ValueFederate::removeTarget(const Publication& pub, std::string_view target)
 {
     vfManager->removeTarget(pub, target);
@@ -481,6 +487,14 @@ bool ValueFederate::forceCoreUpdate(Input& inp)
     return vfManager->getUpdateFromCore(inp);
 }
 
+int ValueFederate::getDoubles(std::span<Input* const> inputs, std::span<double> values)
+{
+    if (values.size() < inputs.size()) {
+        throw(InvalidParameter("values array is smaller than the number of inputs"));
+    }
+    return vfManager->getDoubles(inputs, values);
+}
+
 void ValueFederate::publishBytes(const Publication& pub, data_view block)  // NOLINT
 {
     if ((currentMode == Modes::EXECUTING) || (currentMode == Modes::INITIALIZING)) {
@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -346,6 +347,17 @@ class HELICS_CXX_EXPORT ValueFederate:
     */
     bool forceCoreUpdate(Input& inp);
 
+    /** get the values of a set of inputs as doubles in a single pass
+    @details updated inputs carrying double or integer data are decoded straight into the output
+    array without going through the generic value conversion, other inputs are retrieved as if
+    through getValue<double>.  Clears the update flag of every input retrieved
+    @param inputs the inputs to retrieve, null entries leave the corresponding value untouched
+    @param values the location to store the values, must be at least as long as inputs
+    @return the number of inputs that had an update
+    @throw InvalidParameter if values is shorter than inputs
+    */
+    int getDoubles(std::span<Input* const> inputs, std::span<double> values);
+
     /** publish a value
     @param pub the publication identifier
     @param block a data block containing the data
@@ -364,6 +376,15 @@ class HELICS_CXX_EXPORT ValueFederate:
         publishBytes(pub, data_view{data, data_size});
     }
 
+    /** add a publication to the publication group of the federate
+    @details the values of grouped publications are collected and sent as a single message to each
+    destination federate when the federate next requests a time or a mode change, instead of one
+    message per value.  Publication options such as only_transmit_on_change still apply to each
+    publication
+    @param pub the publication to add to the group
+    */
+    void addToPublicationGroup(Publication& pub);
+
     /** register a set of publications based on a publication JSON
     @param jsonString a json string containing the data to publish and establish publications from
     */
@@ -17,6 +17,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <map>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace helics {
@@ -224,6 +225,36 @@ data_view ValueFederateManager::getValue(const Input& inp)
     return data_view();
 }
 
+int ValueFederateManager::getDoubles(std::span<Input* const> inps, std::span<double> values)
+{
+    int updates{0};
+    for (std::size_t ii = 0; ii < inps.size(); ++ii) {
+        Input* inp = inps[ii];
+        if (inp == nullptr) {
+            continue;
+        }
+        auto* iData = static_cast<InputData*>(inp->dataReference);
+        if (inp->hasUpdate) {
+            ++updates;
+        }
+        if (iData == nullptr) {
+            values[ii] = inp->getValue<double>();
+            continue;
+        }
+        if (iData->hasUpdate && inp->allowDirectFederateUpdate() && !iData->lastData.empty() &&
+            inp->extractNumericUpdate(iData->lastData, values[ii])) {
+            iData->lastQuery = CurrentTime;
+            iData->hasUpdate = false;
+        } else if (!iData->hasUpdate && !inp->hasUpdate &&
+                   std::holds_alternative<double>(inp->lastValue)) {
+            values[ii] = std::get<double>(inp->lastValue);
+        } else {
+            values[ii] = inp->getValue<double>();
+        }
+    }
+    return updates;
+}
+
 /** function to check if the size is valid for the given type*/
 inline bool isBlockSizeValid(int size, const publication_info& pubI)
 {
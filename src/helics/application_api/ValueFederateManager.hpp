@@ -17,6 +17,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <deque>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -125,6 +126,10 @@ class ValueFederateManager {
     @return a constant data block
     */
     data_view getValue(const Input& inp);
+    /** get the values of a set of inputs as doubles
+    @details values must be at least as long as inputs
+    @return the number of inputs that had an update*/
+    int getDoubles(std::span<Input* const> inps, std::span<double> values);
 
     /** publish a value*/
     void publish(const Publication& pub, const data_view& block);
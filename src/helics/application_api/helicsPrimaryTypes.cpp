@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../utilities/timeStringOps.hpp"
 #include "ValueConverter.hpp"
+#include "valueParsing.hpp"
 
 #include <set>
 #include <string>
@@ -540,9 +541,85 @@ void valueExtract(const defV& data, bool& val)
     }
 }
 
+namespace {
+    /** convert a scanned json value block to a value
+    @return false if the block does not match its type and needs the json library to convert*/
+    bool convertJsonBlock(const detail::JsonValueBlock& block, defV& result)
+    {
+        using ValueKind = detail::JsonValueBlock::ValueKind;
+        const bool isNumber = (block.kind == ValueKind::NUMBER || block.kind == ValueKind::INTEGER);
+        switch (getTypeFromString(block.type)) {
+            case DataType::HELICS_DOUBLE:
+                if (!isNumber) {
+                    return false;
+                }
+                result = block.number;
+                return true;
+            case DataType::HELICS_COMPLEX:
+                if (block.kind != ValueKind::ARRAY || block.array.size() < 2) {
+                    return false;
+                }
+                result = std::complex<double>(block.array[0], block.array[1]);
+                return true;
+            case DataType::HELICS_BOOL:
+                if (block.kind != ValueKind::BOOLEAN) {
+                    return false;
+                }
+                result = block.integer;
+                return true;
+            case DataType::HELICS_VECTOR:
+                if (block.kind != ValueKind::ARRAY) {
+                    return false;
+                }
+                result = block.array;
+                return true;
+            case DataType::HELICS_COMPLEX_VECTOR: {
+                if (block.kind != ValueKind::ARRAY || block.array.empty()) {
+                    return false;
+                }
+                std::vector<std::complex<double>> res;
+                res.reserve(block.array.size() / 2);
+                for (std::size_t ii = 0; ii + 1 < block.array.size(); ii += 2) {
+                    res.emplace_back(block.array[ii], block.array[ii + 1]);
+                }
+                result = std::move(res);
+                return true;
+            }
+            case DataType::HELICS_INT:
+            case DataType::HELICS_TIME:
+                if (block.kind != ValueKind::INTEGER) {
+                    return false;
+                }
+                result = block.integer;
+                return true;
+            case DataType::HELICS_STRING:
+            case DataType::HELICS_CHAR:
+                if (block.kind != ValueKind::STRING) {
+                    return false;
+                }
+                result = std::string(block.text);
+                return true;
+            case DataType::HELICS_NAMED_POINT:
+                if (!block.hasName || !isNumber) {
+                    return false;
+                }
+                result = NamedPoint(block.name, block.number);
+                return true;
+            default:
+                return false;
+        }
+    }
+}  // namespace
+
 defV readJsonValue(const data_view& data)
 {
     defV result;
+    // the common blocks are read directly and anything else goes through the json library
+    detail::JsonValueBlock block;
+    if (detail::scanJsonValueBlock(data.string_view(), block) && block.hasType &&
+        convertJsonBlock(block, result)) {
+        return result;
+    }
     try {
         auto json = fileops::loadJsonStr(data.string_view());
         switch (getTypeFromString(json["type"].get<std::string>())) {
@@ -15,15 +15,18 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/utilities/stringConversion.h"
 #include "gmlc/utilities/stringOps.h"
 #include "gmlc/utilities/string_viewConversion.h"
+#include "valueParsing.hpp"
 
 #include <algorithm>
+#include <array>
+#include <charconv>
 #include <fmt/format.h>
 #if FMT_VERSION >= 110000
 #    include <fmt/ranges.h>
 #endif
 #include <functional>
+#include <iterator>
 #include <numeric>
-#include <regex>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -297,9 +300,217 @@ std::string_view getCleanedTypeName(std::string_view typeName)
     return typeName;
 }
 
-// regular expression to handle complex numbers of various formats
-const std::regex creg(
-    R"(([+-]?(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)\s*([+-]\s*(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)[ji]*)");
+namespace {
+    void trimLeadingSpace(std::string_view& str)
+    {
+        auto pos = str.find_first_not_of(" \t\n\r");
+        str.remove_prefix((pos == std::string_view::npos) ? str.size() : pos);
+    }
+
+    /** read a double from the start of a string ignoring leading whitespace
+    @return the invalid double value if the string does not start with a number*/
+    double leadingDouble(std::string_view str)
+    {
+        string_viewOps::trimString(str);
+        double val{invalidValue<double>()};
+        detail::readDouble(str, val);
+        return val;
+    }
+
+    /** read a complex number in the form "a+bj" or "a - bi" from the start of a string
+    @return false if the string does not start with that form*/
+    bool readComplexPair(std::string_view str, double& real, double& imag)
+    {
+        double realPart{0.0};
+        const auto used = detail::readDouble(str, realPart);
+        if (used == 0) {
+            return false;
+        }
+        str.remove_prefix(used);
+        trimLeadingSpace(str);
+        if (str.empty() || (str.front() != '+' && str.front() != '-')) {
+            return false;
+        }
+        const bool negative = (str.front() == '-');
+        str.remove_prefix(1);
+        trimLeadingSpace(str);
+        double imagPart{0.0};
+        if (str.empty() || str.front() == '+' || str.front() == '-' ||
+            detail::readDouble(str, imagPart) == 0) {
+            return false;
+        }
+        real = realPart;
+        imag = negative ? -imagPart : imagPart;
+        return true;
+    }
+
+    /** read a json array of numbers or of arrays of numbers as complex values
+    @details numbers are taken in pairs as real and imaginary parts and arrays as a single value
+    @return false if the string is something else and needs the json library*/
+    bool readComplexArray(std::string_view str, std::vector<std::complex<double>>& data)
+    {
+        double val{0.0};
+        std::int64_t intVal{0};
+        bool isInteger{false};
+        auto readNumber = [&](std::string_view& text) {
+            auto used = detail::readJsonNumber(text, val, intVal, isInteger);
+            text.remove_prefix(used);
+            return used > 0;
+        };
+        string_viewOps::trimString(str);
+        if (str.empty()) {
+            return false;
+        }
+        if (str.front() != '[') {
+            if (readNumber(str) && str.empty()) {
+                data.resize(0);
+                data.emplace_back(val, 0.0);
+                return true;
+            }
+            return false;
+        }
+        str.remove_prefix(1);
+        trimLeadingSpace(str);
+        if (!str.empty() && str.front() == ']') {
+            return str.size() == 1;
+        }
+        const auto originalSize = data.size();
+        bool imaginaryNext{false};
+        while (!str.empty()) {
+            if (str.front() == '[') {
+                str.remove_prefix(1);
+                std::array<double, 2> parts{0.0, 0.0};
+                std::size_t count{0};
+                trimLeadingSpace(str);
+                if (!str.empty() && str.front() == ']') {
+                    str.remove_prefix(1);
+                } else {
+                    while (true) {
+                        trimLeadingSpace(str);
+                        if (!readNumber(str)) {
+                            data.resize(originalSize);
+                            return false;
+                        }
+                        if (count < parts.size()) {
+                            parts[count] = val;
+                        }
+                        ++count;
+                        trimLeadingSpace(str);
+                        if (!str.empty() && str.front() == ']') {
+                            str.remove_prefix(1);
+                            break;
+                        }
+                        if (str.empty() || str.front() != ',') {
+                            data.resize(originalSize);
+                            return false;
+                        }
+                        str.remove_prefix(1);
+                    }
+                }
+                if (count == 0) {
+                    data.push_back(invalidValue<std::complex<double>>());
+                } else {
+                    data.emplace_back(parts[0], parts[1]);
+                }
+                imaginaryNext = false;
+            } else if (readNumber(str)) {
+                if (imaginaryNext) {
+                    data.back() += std::complex<double>{0.0, val};
+                } else {
+                    data.emplace_back(val, 0.0);
+                }
+                imaginaryNext = !imaginaryNext;
+            } else {
+                break;
+            }
+            trimLeadingSpace(str);
+            if (!str.empty() && str.front() == ']') {
+                str.remove_prefix(1);
+                trimLeadingSpace(str);
+                if (str.empty()) {
+                    return true;
+                }
+                break;
+            }
+            if (str.empty() || str.front() != ',') {
+                break;
+            }
+            str.remove_prefix(1);
+            trimLeadingSpace(str);
+        }
+        data.resize(originalSize);
+        return false;
+    }
+
+    /** append a double formatted the way the json library writes it*/
+    void appendJsonNumber(std::string& json, double val)
+    {
+        if (!std::isfinite(val)) {
+            json.append("null");
+            return;
+        }
+        std::array<char, 64> buffer{};
+        char* end = nlohmann::detail::to_chars(buffer.data(), buffer.data() + buffer.size(), val);
+        json.append(buffer.data(), static_cast<std::size_t>(end - buffer.data()));
+    }
+
+    void appendJsonNumber(std::string& json, std::int64_t val)
+    {
+        std::array<char, 24> buffer{};
+        auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), val);
+        json.append(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+    }
+
+    /** append a quoted string, strings that need escaping are written by the json library*/
+    void appendJsonString(std::string& json, std::string_view str)
+    {
+        const bool plain = std::all_of(str.begin(), str.end(), [](char chr) {
+            const auto code = static_cast<unsigned char>(chr);
+            return code >= 0x20 && code < 0x7F && chr != '"' && chr != '\\';
+        });
+        if (plain) {
+            json.push_back('"');
+            json.append(str);
+            json.push_back('"');
+        } else {
+            json.append(fileops::generateJsonString(nlohmann::json(std::string(str))));
+        }
+    }
+
+    void appendJsonArray(std::string& json, const double* vals, std::size_t size)
+    {
+        if (size == 0) {
+            json.append("[]");
+            return;
+        }
+        json.push_back('[');
+        for (std::size_t ii = 0; ii < size; ++ii) {
+            json.append((ii == 0) ? "\n      " : ",\n      ");
+            appendJsonNumber(json, vals[ii]);
+        }
+        json.append("\n   ]");
+    }
+
+    /** start the next member of a json object written in the layout of
+    fileops::generateJsonString, members must be added in sorted order and the object closed with
+    "\n}"*/
+    void appendJsonMember(std::string& json, std::string_view key)
+    {
+        json.append(json.empty() ? "{\n   \"" : ",\n   \"");
+        json.append(key);
+        json.append("\": ");
+    }
+
+    /** start a json block for a value of the given type with the value member next*/
+    std::string startJsonValueBlock(DataType type)
+    {
+        std::string json;
+        appendJsonMember(json, "type");
+        appendJsonString(json, typeNameStringRef(type));
+        appendJsonMember(json, "value");
+        return json;
+    }
+}  // namespace
 
 std::complex<double> helicsGetComplex(std::string_view val)
 {
@@ -313,8 +524,7 @@ std::complex<double> helicsGetComplex(std::string_view val)
         if (sep == std::string_view::npos) {
             val.remove_prefix(1);
             val.remove_suffix(1);
-            real = numConv<double>(val);
-            return {real, imag};
+            return {leadingDouble(val), imag};
         }
         if (val.find_first_of(',', sep + 1) != std::string_view::npos) {
             auto vectorVal = helicsGetVector(val);
@@ -323,39 +533,32 @@ std::complex<double> helicsGetComplex(std::string_view val)
             }
             return invalidValue<std::complex<double>>();
         }
-        real = numConv<double>(val.substr(1, sep));
+        real = leadingDouble(val.substr(1, sep - 1));
         val.remove_suffix(1);
-        imag = numConv<double>(val.substr(sep + 1));
+        imag = leadingDouble(val.substr(sep + 1));
         return {real, imag};
     }
-    std::smatch match;
-
-    auto temp = std::string(val);
-    std::regex_search(temp, match, creg);
-    try {
-        if (match.size() == 9) {
-            real = numConv<double>(match[1]);
-
-            imag = numConv<double>(match[6]);
-
-            if (*match[5].first == '-') {
-                imag = -imag;
-            }
-        } else {
-            if ((val.back() == 'j') || (val.back() == 'i')) {
-                auto strval = val.substr(0, val.size() - 1);
-                string_viewOps::trimString(strval);
-                imag = numConv<double>(strval);
-                real = 0.0;
-            } else {
-                auto strval = val;
-                string_viewOps::trimString(strval);
-                real = numConv<double>(strval);
-            }
+    string_viewOps::trimString(val);
+    // the forms handled are "a", "a+bj", "a - bi", and "bj"
+    const auto used = detail::readDouble(val, real);
+    if (used == val.size()) {
+        return {real, imag};
+    }
+    // the "a+bj" form is found anywhere in the string such as in "c[1+2j]"
+    for (std::size_t pos = 0; pos < val.size(); ++pos) {
+        const char start = val[pos];
+        if (((start >= '0' && start <= '9') || start == '.' || start == '+' || start == '-') &&
+            readComplexPair(val.substr(pos), real, imag)) {
+            return {real, imag};
         }
     }
-    catch (const std::invalid_argument&) {
-        real = invalidValue<double>();
+    if (!val.empty() && (val.back() == 'j' || val.back() == 'i')) {
+        auto strval = val.substr(0, val.size() - 1);
+        string_viewOps::trimString(strval);
+        if (detail::readDouble(strval, imag) == 0) {
+            return {invalidValue<double>(), 0.0};
+        }
+        return {0.0, imag};
     }
     return {real, imag};
 }
@@ -372,17 +575,27 @@ std::string helicsDoubleString(double val)
 
 std::string helicsVectorString(const std::vector<double>& val)
 {
-    return fmt::format("[{}]", fmt::join(val, ","));
+    return helicsVectorString(val.data(), val.size());
 }
 
 std::string helicsVectorString(const double* vals, size_t size)
 {
-    return fmt::format("[{}]", fmt::join(vals, vals + size, ","));
+    std::string result;
+    result.reserve(size * 12 + 2);
+    result.push_back('[');
+    fmt::format_to(std::back_inserter(result), "{}", fmt::join(vals, vals + size, ","));
+    result.push_back(']');
+    return result;
 }
 
 std::string helicsComplexVectorString(const std::vector<std::complex<double>>& val)
 {
-    return fmt::format("[{}]", fmt::join(val, ","));
+    std::string result;
+    result.reserve(val.size() * 24 + 2);
+    result.push_back('[');
+    fmt::format_to(std::back_inserter(result), "{}", fmt::join(val, ","));
+    result.push_back(']');
+    return result;
 }
 
 std::string helicsNamedPointString(const NamedPoint& point)
@@ -391,13 +604,15 @@ std::string helicsNamedPointString(const NamedPoint& point)
 }
 std::string helicsNamedPointString(std::string_view pointName, double val)
 {
-    nlohmann::json namePoint;
-    namePoint["value"] = val;
-    if (pointName.empty()) {
-    } else {
-        namePoint["name"] = pointName;
+    std::string json;
+    if (!pointName.empty()) {
+        appendJsonMember(json, "name");
+        appendJsonString(json, pointName);
     }
-    return fileops::generateJsonString(namePoint);
+    appendJsonMember(json, "value");
+    appendJsonNumber(json, val);
+    json.append("\n}");
+    return json;
 }
 
 std::vector<double> helicsGetVector(std::string_view val)
@@ -417,6 +632,20 @@ std::vector<std::complex<double>> helicsGetComplexVector(std::string_view val)
 NamedPoint helicsGetNamedPoint(std::string_view val)
 {
     NamedPoint namePoint;
+    detail::JsonValueBlock block;
+    if (detail::scanJsonValueBlock(val, block)) {
+        using ValueKind = detail::JsonValueBlock::ValueKind;
+        if (block.kind == ValueKind::NONE || block.kind == ValueKind::NUMBER ||
+            block.kind == ValueKind::INTEGER) {
+            if (block.kind != ValueKind::NONE) {
+                namePoint.value = block.number;
+            }
+            if (block.hasName) {
+                namePoint.name = block.name;
+            }
+            return namePoint;
+        }
+    }
     try {
         auto json = fileops::loadJsonStr(val);
         switch (json.type()) {
@@ -452,14 +681,14 @@ static int readSize(std::string_view val)
 {
     auto firstBracket = val.find_first_of('[');
     if (firstBracket > 1) {
-        try {
-            auto size = numConv<int>(val.substr(1, firstBracket - 1));
+        int size{0};
+        auto sizeString = val.substr(1, firstBracket - 1);
+        string_viewOps::trimString(sizeString);
+        auto result =
+            std::from_chars(sizeString.data(), sizeString.data() + sizeString.size(), size);
+        if (result.ec == std::errc{} && result.ptr != sizeString.data()) {
             return size;
         }
-        // NOLINTNEXTLINE
-        catch (const std::invalid_argument&) {
-            // go to the alternative path if this fails
-        }
     }
     if (val.find_first_not_of(" ]", firstBracket + 1) == std::string_view::npos) {
         return 0;
@@ -537,8 +766,7 @@ void helicsGetVector(std::string_view val, std::vector<double>& data)
 
             auto vstr = val.substr(firstBracket + 1, nextChar - firstBracket - 1);
             string_viewOps::trimString(vstr);
-            auto vectorVal = numeric_conversion<double>(vstr, invalidValue<double>());
-            data.push_back(vectorVal);
+            data.push_back(leadingDouble(vstr));
 
             firstBracket = nextChar;
         }
@@ -582,16 +810,15 @@ void helicsGetComplexVector(std::string_view val, std::vector<std::complex<doubl
         for (decltype(size) ii = 0; ii < size - 1; ii += 2) {
             auto nextChar = val.find_first_of(",;]", firstBracket + 1);
             auto secondChar = val.find_first_of(",;]", nextChar + 1);
-            try {
-                auto vstr1 = val.substr(firstBracket + 1, nextChar - firstBracket - 1);
-                string_viewOps::trimString(vstr1);
-                auto vstr2 = val.substr(nextChar + 1, secondChar - nextChar - 1);
-                string_viewOps::trimString(vstr2);
-                auto val1 = numConv<double>(vstr1);
-                auto val2 = numConv<double>(vstr2);
+            auto vstr1 = val.substr(firstBracket + 1, nextChar - firstBracket - 1);
+            string_viewOps::trimString(vstr1);
+            auto vstr2 = val.substr(nextChar + 1, secondChar - nextChar - 1);
+            string_viewOps::trimString(vstr2);
+            double val1{0.0};
+            double val2{0.0};
+            if (detail::readDouble(vstr1, val1) > 0 && detail::readDouble(vstr2, val2) > 0) {
                 data.emplace_back(val1, val2);
-            }
-            catch (const std::invalid_argument&) {
+            } else {
                 data.push_back(invalidValue<std::complex<double>>());
             }
             firstBracket = nextChar;
@@ -612,7 +839,7 @@ void helicsGetComplexVector(std::string_view val, std::vector<std::complex<doubl
             auto cval = helicsGetComplex(val);
             data.resize(0);
             data.push_back(cval);
-        } else {
+        } else if (!readComplexArray(val, data)) {
             auto json = fileops::loadJsonStr(val);
             int cnt{0};
             switch (json.type()) {
@@ -757,8 +984,12 @@ SmallBuffer typeConvert(DataType type, double val)
         case DataType::HELICS_BOOL:
             return ValueConverter<std::string_view>::convert((val != 0.0) ? "1" : "0");
         case DataType::HELICS_STRING:
-        case DataType::HELICS_CHAR:
-            return ValueConverter<std::string_view>::convert(helicsDoubleString(val));
+        case DataType::HELICS_CHAR: {
+            std::array<char, 32> buffer{};
+            auto result = fmt::format_to_n(buffer.data(), buffer.size(), "{}", val);
+            return ValueConverter<std::string_view>::convert(
+                std::string_view(buffer.data(), result.size));
+        }
         case DataType::HELICS_NAMED_POINT:
             return ValueConverter<NamedPoint>::convert(NamedPoint{"value", val});
         case DataType::HELICS_COMPLEX_VECTOR: {
@@ -768,10 +999,10 @@ SmallBuffer typeConvert(DataType type, double val)
         case DataType::HELICS_VECTOR:
             return ValueConverter<double>::convert(&val, 1);
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_DOUBLE);
-            json["value"] = val;
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_DOUBLE);
+            appendJsonNumber(json, val);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -790,8 +1021,13 @@ SmallBuffer typeConvert(DataType type, int64_t val)
         case DataType::HELICS_BOOL:
             return ValueConverter<std::string_view>::convert((val != 0) ? "1" : "0");
         case DataType::HELICS_STRING:
-        case DataType::HELICS_CHAR:
-            return ValueConverter<std::string_view>::convert(helicsIntString(val));
+        case DataType::HELICS_CHAR: {
+            std::array<char, 24> buffer{};
+            auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), val);
+            const auto length = static_cast<std::size_t>(result.ptr - buffer.data());
+            return ValueConverter<std::string_view>::convert(
+                std::string_view(buffer.data(), length));
+        }
         case DataType::HELICS_NAMED_POINT:
             if (static_cast<uint64_t>(std::abs(val)) >
                 (2ULL << 51U))  // this checks whether the actual value will fit in a double
@@ -812,10 +1048,10 @@ SmallBuffer typeConvert(DataType type, int64_t val)
             return ValueConverter<double>::convert(&doubleVal, 1);
         }
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_INT);
-            json["value"] = val;
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_INT);
+            appendJsonNumber(json, val);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -850,10 +1086,10 @@ SmallBuffer typeConvert(DataType type, std::string_view val)
         case DataType::HELICS_VECTOR:
             return ValueConverter<std::vector<double>>::convert(helicsGetVector(val));
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_STRING);
-            json["value"] = std::string(val);
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_STRING);
+            appendJsonString(json, val);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -904,14 +1140,10 @@ SmallBuffer typeConvert(DataType type, const double* vals, size_t size)
         default:
             return ValueConverter<double>::convert(vals, size);
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_VECTOR);
-            nlohmann::json jsonArray = nlohmann::json::array();
-            for (size_t ii = 0; ii < size; ++ii) {
-                jsonArray.push_back(vals[ii]);
-            }
-            json["value"] = std::move(jsonArray);
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_VECTOR);
+            appendJsonArray(json, vals, size);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -963,14 +1195,10 @@ SmallBuffer typeConvertComplex(DataType type, const double* vals, size_t size)
         default:
             return ValueConverter<double>::convert(vals, size);
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_VECTOR);
-            nlohmann::json jsonArray = nlohmann::json::array();
-            for (size_t ii = 0; ii < size; ++ii) {
-                jsonArray.push_back(vals[ii]);
-            }
-            json["value"] = std::move(jsonArray);
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_VECTOR);
+            appendJsonArray(json, vals, size);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -1014,15 +1242,11 @@ SmallBuffer typeConvert(DataType type, const std::vector<std::complex<double>>&
             return ValueConverter<std::vector<double>>::convert(vectorVal);
         }
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_COMPLEX_VECTOR);
-            nlohmann::json jsonArray = nlohmann::json::array();
-            for (const auto& element : val) {
-                jsonArray.push_back(element.real());
-                jsonArray.push_back(element.imag());
-            }
-            json["value"] = std::move(jsonArray);
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_COMPLEX_VECTOR);
+            // std::complex is required to have the layout of an array of two doubles
+            appendJsonArray(json, reinterpret_cast<const double*>(val.data()), val.size() * 2);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -1057,13 +1281,11 @@ SmallBuffer typeConvert(DataType type, const std::complex<double>& val)
             return ValueConverter<std::vector<double>>::convert(vectorVal);
         }
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_COMPLEX);
-            nlohmann::json jsonArray = nlohmann::json::array();
-            jsonArray.push_back(val.real());
-            jsonArray.push_back(val.imag());
-            json["value"] = std::move(jsonArray);
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_COMPLEX);
+            const std::array<double, 2> parts{val.real(), val.imag()};
+            appendJsonArray(json, parts.data(), parts.size());
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -1103,11 +1325,15 @@ SmallBuffer typeConvert(DataType type, const NamedPoint& val)
         case DataType::HELICS_VECTOR:
             return ValueConverter<double>::convert(&(val.value), 1);
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_NAMED_POINT);
-            json["name"] = val.name;
-            json["value"] = val.value;
-            return fileops::generateJsonString(json);
+            std::string json;
+            appendJsonMember(json, "name");
+            appendJsonString(json, val.name);
+            appendJsonMember(json, "type");
+            appendJsonString(json, typeNameStringRef(DataType::HELICS_NAMED_POINT));
+            appendJsonMember(json, "value");
+            appendJsonNumber(json, val.value);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -1144,11 +1370,15 @@ SmallBuffer typeConvert(DataType type, std::string_view str, double val)
         case DataType::HELICS_VECTOR:
             return ValueConverter<double>::convert(&(val), 1);
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_NAMED_POINT);
-            json["name"] = std::string(str);
-            json["value"] = val;
-            return fileops::generateJsonString(json);
+            std::string json;
+            appendJsonMember(json, "name");
+            appendJsonString(json, str);
+            appendJsonMember(json, "type");
+            appendJsonString(json, typeNameStringRef(DataType::HELICS_NAMED_POINT));
+            appendJsonMember(json, "value");
+            appendJsonNumber(json, val);
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -1182,10 +1412,10 @@ SmallBuffer typeConvert(DataType type, bool val)
             return ValueConverter<double>::convert(&vec, 1);
         }
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_BOOL);
-            json["value"] = val;
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_BOOL);
+            json.append(val ? "true" : "false");
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -1219,10 +1449,10 @@ SmallBuffer typeConvert(DataType type, char val)
             return ValueConverter<double>::convert(&doubleVal, 1);
         }
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_INT);
-            json["value"] = val;
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_INT);
+            appendJsonNumber(json, static_cast<std::int64_t>(val));
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -1265,10 +1495,10 @@ SmallBuffer typeConvert(DataType type, Time val)
             return ValueConverter<std::vector<double>>::convert(vec);
         }
         case DataType::HELICS_JSON: {
-            nlohmann::json json;
-            json["type"] = typeNameStringRef(DataType::HELICS_TIME);
-            json["value"] = val.getBaseTimeCode();
-            return fileops::generateJsonString(json);
+            auto json = startJsonValueBlock(DataType::HELICS_TIME);
+            appendJsonNumber(json, val.getBaseTimeCode());
+            json.append("\n}");
+            return json;
         }
     }
 }
@@ -0,0 +1,319 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "valueParsing.hpp"
+
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+namespace helics::detail {
+
+std::size_t readDouble(std::string_view str, double& val)
+{
+    std::size_t offset{0};
+    if (!str.empty() && str.front() == '+') {
+        offset = 1;
+    }
+    if (offset >= str.size() || (offset == 1 && (str[1] == '+' || str[1] == '-'))) {
+        return 0;
+    }
+    const char* first = str.data() + offset;
+    const char* last = str.data() + str.size();
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    double result{0.0};
+    // hexadecimal numbers are read as they are by strtod
+    const bool negative = (*first == '-');
+    const char* digits = negative ? first + 1 : first;
+    if (last - digits > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X') &&
+        digits[2] != '-') {
+        auto [hexEnd, hexError] =
+            std::from_chars(digits + 2, last, result, std::chars_format::hex);
+        if (hexError == std::errc{}) {
+            val = negative ? -result : result;
+            return static_cast<std::size_t>(hexEnd - str.data());
+        }
+    }
+    auto [ptr, ec] = std::from_chars(first, last, result);
+    if (ec != std::errc{}) {
+        return 0;
+    }
+    val = result;
+    return static_cast<std::size_t>(ptr - str.data());
+#else
+    // standard libraries without floating point from_chars use strtod on a terminated copy
+    if (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r') {
+        return 0;
+    }
+    const auto length = static_cast<std::size_t>(last - first);
+    std::array<char, 64> buffer{};
+    std::string longString;
+    const char* start{buffer.data()};
+    if (length < buffer.size()) {
+        std::memcpy(buffer.data(), first, length);
+        buffer[length] = '\0';
+    } else {
+        longString.assign(first, length);
+        start = longString.c_str();
+    }
+    char* end{nullptr};
+    errno = 0;
+    const double result = std::strtod(start, &end);
+    // out of range values are rejected as they are by from_chars
+    if (end == start || errno == ERANGE) {
+        return 0;
+    }
+    val = result;
+    return offset + static_cast<std::size_t>(end - start);
+#endif
+}
+
+namespace {
+    bool isDigit(char chr)
+    {
+        return chr >= '0' && chr <= '9';
+    }
+
+    std::size_t skipDigits(std::string_view str, std::size_t pos)
+    {
+        while (pos < str.size() && isDigit(str[pos])) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    void skipSpace(std::string_view& str)
+    {
+        while (!str.empty() &&
+               (str.front() == ' ' || str.front() == '\n' || str.front() == '\r' ||
+                str.front() == '\t')) {
+            str.remove_prefix(1);
+        }
+    }
+
+    /** read a quoted string that has no escape sequences or non ascii characters*/
+    bool readPlainString(std::string_view& str, std::string_view& out)
+    {
+        if (str.empty() || str.front() != '"') {
+            return false;
+        }
+        for (std::size_t ii = 1; ii < str.size(); ++ii) {
+            const auto chr = static_cast<unsigned char>(str[ii]);
+            if (chr == '"') {
+                out = str.substr(1, ii - 1);
+                str.remove_prefix(ii + 1);
+                return true;
+            }
+            if (chr == '\\' || chr < 0x20 || chr >= 0x7F) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool readNumber(std::string_view& str, double& val, std::int64_t& intVal, bool& isInteger)
+    {
+        auto used = readJsonNumber(str, val, intVal, isInteger);
+        if (used == 0) {
+            return false;
+        }
+        str.remove_prefix(used);
+        return true;
+    }
+
+    bool readLiteral(std::string_view& str, std::string_view literal)
+    {
+        if (str.substr(0, literal.size()) != literal) {
+            return false;
+        }
+        str.remove_prefix(literal.size());
+        return true;
+    }
+
+    bool readNumberArray(std::string_view& str, std::vector<double>& array)
+    {
+        str.remove_prefix(1);
+        array.clear();
+        skipSpace(str);
+        if (!str.empty() && str.front() == ']') {
+            str.remove_prefix(1);
+            return true;
+        }
+        double val{0.0};
+        std::int64_t intVal{0};
+        bool isInteger{false};
+        while (true) {
+            skipSpace(str);
+            if (!readNumber(str, val, intVal, isInteger)) {
+                return false;
+            }
+            array.push_back(val);
+            skipSpace(str);
+            if (str.empty()) {
+                return false;
+            }
+            if (str.front() == ']') {
+                str.remove_prefix(1);
+                return true;
+            }
+            if (str.front() != ',') {
+                return false;
+            }
+            str.remove_prefix(1);
+        }
+    }
+
+    bool readValue(std::string_view& str, JsonValueBlock& block)
+    {
+        using ValueKind = JsonValueBlock::ValueKind;
+        if (str.empty()) {
+            return false;
+        }
+        switch (str.front()) {
+            case '"':
+                block.kind = ValueKind::STRING;
+                return readPlainString(str, block.text);
+            case '[':
+                block.kind = ValueKind::ARRAY;
+                return readNumberArray(str, block.array);
+            case 't':
+                block.kind = ValueKind::BOOLEAN;
+                block.integer = 1;
+                block.number = 1.0;
+                return readLiteral(str, "true");
+            case 'f':
+                block.kind = ValueKind::BOOLEAN;
+                block.integer = 0;
+                block.number = 0.0;
+                return readLiteral(str, "false");
+            default: {
+                bool isInteger{false};
+                if (!readNumber(str, block.number, block.integer, isInteger)) {
+                    return false;
+                }
+                block.kind = isInteger ? ValueKind::INTEGER : ValueKind::NUMBER;
+                return true;
+            }
+        }
+    }
+}  // namespace
+
+std::size_t
+    readJsonNumber(std::string_view str, double& val, std::int64_t& intVal, bool& isInteger)
+{
+    std::size_t pos{0};
+    if (pos < str.size() && str[pos] == '-') {
+        ++pos;
+    }
+    if (pos >= str.size() || !isDigit(str[pos])) {
+        return 0;
+    }
+    // json does not allow leading zeros
+    if (str[pos] == '0' && pos + 1 < str.size() && isDigit(str[pos + 1])) {
+        return 0;
+    }
+    pos = skipDigits(str, pos);
+    bool integral{true};
+    if (pos < str.size() && str[pos] == '.') {
+        if (pos + 1 >= str.size() || !isDigit(str[pos + 1])) {
+            return 0;
+        }
+        pos = skipDigits(str, pos + 1);
+        integral = false;
+    }
+    if (pos < str.size() && (str[pos] == 'e' || str[pos] == 'E')) {
+        ++pos;
+        if (pos < str.size() && (str[pos] == '+' || str[pos] == '-')) {
+            ++pos;
+        }
+        if (pos >= str.size() || !isDigit(str[pos])) {
+            return 0;
+        }
+        pos = skipDigits(str, pos);
+        integral = false;
+    }
+    isInteger = false;
+    if (integral) {
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + pos, intVal);
+        if (ec == std::errc{}) {
+            isInteger = true;
+            val = static_cast<double>(intVal);
+            return pos;
+        }
+    }
+    // the number is well formed so this only fails if it is out of range
+    return (readDouble(str.substr(0, pos), val) == pos) ? pos : 0;
+}
+
+bool scanJsonValueBlock(std::string_view str, JsonValueBlock& block)
+{
+    skipSpace(str);
+    if (str.empty() || str.front() != '{') {
+        return false;
+    }
+    str.remove_prefix(1);
+    skipSpace(str);
+    if (!str.empty() && str.front() == '}') {
+        str.remove_prefix(1);
+        skipSpace(str);
+        return str.empty();
+    }
+    while (true) {
+        skipSpace(str);
+        std::string_view key;
+        if (!readPlainString(str, key)) {
+            return false;
+        }
+        skipSpace(str);
+        if (str.empty() || str.front() != ':') {
+            return false;
+        }
+        str.remove_prefix(1);
+        skipSpace(str);
+        // repeated members are left to the json library
+        if (key == "type") {
+            if (block.hasType || !readPlainString(str, block.type)) {
+                return false;
+            }
+            block.hasType = true;
+        } else if (key == "name") {
+            if (block.hasName || !readPlainString(str, block.name)) {
+                return false;
+            }
+            block.hasName = true;
+        } else if (key == "value") {
+            if (block.kind != JsonValueBlock::ValueKind::NONE || !readValue(str, block)) {
+                return false;
+            }
+        } else {
+            JsonValueBlock unused;
+            if (!readValue(str, unused)) {
+                return false;
+            }
+        }
+        skipSpace(str);
+        if (str.empty()) {
+            return false;
+        }
+        if (str.front() == '}') {
+            str.remove_prefix(1);
+            break;
+        }
+        if (str.front() != ',') {
+            return false;
+        }
+        str.remove_prefix(1);
+    }
+    skipSpace(str);
+    return str.empty();
+}
+
+}  // namespace helics::detail
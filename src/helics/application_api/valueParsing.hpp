@@ -0,0 +1,56 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/** @file
+@details functions for reading numbers and simple json blocks from strings without allocating or
+going through the json library
+*/
+
+namespace helics::detail {
+/** read a floating point number from the start of a string
+@details a leading '+' is accepted, leading whitespace is not
+@param str the string to read from
+@param[out] val the number read, left unchanged if no number is read
+@return the number of characters used, 0 if the string does not start with a number*/
+std::size_t readDouble(std::string_view str, double& val);
+
+/** read a number in json format from the start of a string
+@param str the string to read from
+@param[out] val the number read
+@param[out] intVal the number as an integer if it is one
+@param[out] isInteger set to true if the number has no fraction or exponent and fits in an int64_t
+@return the number of characters used, 0 if the string does not start with a json number*/
+std::size_t
+    readJsonNumber(std::string_view str, double& val, std::int64_t& intVal, bool& isInteger);
+
+/** the members of a json object holding a single typed value*/
+struct JsonValueBlock {
+    enum class ValueKind : std::uint8_t { NONE, NUMBER, INTEGER, BOOLEAN, STRING, ARRAY };
+    std::string_view type;  //!< the "type" member
+    std::string_view name;  //!< the "name" member
+    bool hasType{false};  //!< the object has a "type" member
+    bool hasName{false};  //!< the object has a "name" member
+    ValueKind kind{ValueKind::NONE};  //!< the kind of the "value" member
+    double number{0.0};  //!< the value for numbers, integers, and booleans
+    std::int64_t integer{0};  //!< the value for integers and booleans
+    std::string_view text;  //!< the value for strings
+    std::vector<double> array;  //!< the values of an array of numbers
+};
+
+/** scan a json object with string "type" and "name" members and a "value" member
+@details the value can be a number, boolean, string, or array of numbers.  Anything else, including
+strings with escape sequences, makes the scan fail so the text can be given to the json library
+@return true if the object was scanned*/
+bool scanJsonValueBlock(std::string_view str, JsonValueBlock& block);
+
+}  // namespace helics::detail
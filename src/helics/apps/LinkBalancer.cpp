@@ -0,0 +1,115 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "LinkBalancer.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace helics {
+
+namespace {
+    /// the minimum time between measurements of the send rate of a link
+    constexpr std::chrono::milliseconds rateSampleInterval{10};
+    /// the rate assumed for links when none has been measured
+    constexpr double nominalRate{1.0e6};
+}  // namespace
+
+std::size_t
+    LinkBalancer::selectLink(GlobalFederateId source, const std::vector<LinkLoad>& loads, time_type now)
+{
+    if (loads.empty()) {
+        return 0;
+    }
+    updateLinks(loads, now);
+    auto existing = sources.find(source);
+    if (existing != sources.end()) {
+        const auto& state = existing->second;
+        if (state.link < loads.size() && loads[state.link].available &&
+            loads[state.link].acknowledged < state.marker) {
+            // earlier messages from the source may not have arrived so it cannot move
+            return state.link;
+        }
+    }
+    std::size_t best{0};
+    double bestDelay{std::numeric_limits<double>::max()};
+    for (std::size_t ii = 0; ii < loads.size(); ++ii) {
+        if (loads[ii].available && links[ii].delay < bestDelay) {
+            best = ii;
+            bestDelay = links[ii].delay;
+        }
+    }
+    return best;
+}
+
+void LinkBalancer::recordQueued(GlobalFederateId source, std::size_t link, std::uint64_t marker)
+{
+    auto& state = sources[source];
+    state.link = link;
+    state.marker = marker;
+    if (link < links.size()) {
+        ++links[link].messages;
+    }
+}
+
+void LinkBalancer::updateLinks(const std::vector<LinkLoad>& loads, time_type now)
+{
+    if (links.size() != loads.size()) {
+        links.resize(loads.size());
+        for (std::size_t ii = 0; ii < loads.size(); ++ii) {
+            links[ii].lastProcessed = loads[ii].processed;
+            links[ii].lastSample = now;
+        }
+    }
+    double fastest{0.0};
+    for (std::size_t ii = 0; ii < loads.size(); ++ii) {
+        auto& link = links[ii];
+        const auto elapsed = now - link.lastSample;
+        if (elapsed >= rateSampleInterval) {
+            const auto sent = loads[ii].processed - link.lastProcessed;
+            // an idle link says nothing about how fast it can send
+            if (sent > 0 && (link.lastPending > 0 || loads[ii].pending > 0)) {
+                const double sample = static_cast<double>(sent) /
+                    std::chrono::duration<double>(elapsed).count();
+                link.rate = (link.rate == 0.0) ? sample : 0.75 * link.rate + 0.25 * sample;
+            }
+            link.lastProcessed = loads[ii].processed;
+            link.lastPending = loads[ii].pending;
+            link.lastSample = now;
+        }
+        fastest = std::max(fastest, link.rate);
+    }
+    for (std::size_t ii = 0; ii < loads.size(); ++ii) {
+        auto& link = links[ii];
+        // links that have not been measured are assumed to be as fast as the fastest one
+        double rate = (link.rate > 0.0) ? link.rate : fastest;
+        if (rate == 0.0) {
+            rate = nominalRate;
+        }
+        link.delay = static_cast<double>(loads[ii].pending + 1) / rate;
+    }
+}
+
+double LinkBalancer::sendRate(std::size_t link) const
+{
+    return (link < links.size()) ? links[link].rate : 0.0;
+}
+
+std::chrono::nanoseconds LinkBalancer::expectedDelay(std::size_t link) const
+{
+    if (link >= links.size()) {
+        return std::chrono::nanoseconds(0);
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(links[link].delay));
+}
+
+std::uint64_t LinkBalancer::messageCount(std::size_t link) const
+{
+    return (link < links.size()) ? links[link].messages : 0;
+}
+
+}  // namespace helics
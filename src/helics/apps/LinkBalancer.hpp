@@ -0,0 +1,72 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../core/GlobalFederateId.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace helics {
+
+/** class distributing the messages sent to a parent broker over several parallel links
+@details messages from a source stay on the link the source last used until the receiver has
+acknowledged a marker sent over that link after the last message of the source, so the messages
+of each source arrive in order.  A source free to move goes to the link with the shortest
+expected delay, estimated from the number of messages waiting on the link and the rate the link has
+been observed to send them.  The class is not thread safe*/
+class LinkBalancer {
+  public:
+    using time_type = std::chrono::steady_clock::time_point;
+    /** the state of the transmit queue of a link*/
+    struct LinkLoad {
+        std::size_t pending{0};  //!< the number of messages waiting to be sent
+        std::uint64_t processed{0};  //!< the total number of messages taken from the queue
+        bool available{true};  //!< false if the link cannot be used
+        std::uint64_t acknowledged{0};  //!< the last marker on the link the receiver acknowledged
+    };
+
+    /** select the link for a message
+    @param source the source of the message
+    @param loads the current load of each link
+    @param now the current time
+    @return the index of the link to use*/
+    std::size_t
+        selectLink(GlobalFederateId source, const std::vector<LinkLoad>& loads, time_type now);
+    /** record that a message from a source was queued on a link
+    @param marker the marker on the link the receiver acknowledges once it has the message*/
+    void recordQueued(GlobalFederateId source, std::size_t link, std::uint64_t marker);
+    /** get the measured send rate of a link in messages per second, 0 if not yet measured*/
+    double sendRate(std::size_t link) const;
+    /** get the expected delay for a new message on a link as of the last selection*/
+    std::chrono::nanoseconds expectedDelay(std::size_t link) const;
+    /** get the number of messages queued on a link through the balancer*/
+    std::uint64_t messageCount(std::size_t link) const;
+
+  private:
+    struct LinkState {
+        std::uint64_t lastProcessed{0};
+        std::size_t lastPending{0};
+        time_type lastSample;
+        double rate{0.0};  //!< smoothed send rate in messages per second
+        double delay{0.0};  //!< the expected delay in seconds as of the last selection
+        std::uint64_t messages{0};
+    };
+    struct SourceState {
+        std::size_t link{0};
+        std::uint64_t marker{0};  //!< the marker acknowledged once all messages have arrived
+    };
+    void updateLinks(const std::vector<LinkLoad>& loads, time_type now);
+
+    std::vector<LinkState> links;
+    std::map<GlobalFederateId, SourceState> sources;
+};
+
+}  // namespace helics
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../common/JsonProcessingFunctions.hpp"
 #include "../core/BrokerFactory.hpp"
+#include "../core/MessageTimer.hpp"
 #include "../core/helicsCLI11.hpp"
 #include "../core/helicsCLI11JsonConfig.hpp"
 #include "../network/CommsInterface.hpp"
@@ -16,6 +17,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../network/NetworkCommsInterface.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <fmt/format.h>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -28,6 +31,18 @@ SPDX-License-Identifier: BSD-3-Clause
 
 namespace helics {
 
+namespace {
+    /// the longest time to hold a message for the parent to acknowledge the parent link markers
+    constexpr std::chrono::milliseconds parentLinkFenceTimeout{2000};
+
+    /** messages from cores and brokers can depend on anything sent before them so they are
+    fenced behind the parent links and go over the master comm*/
+    bool isOrderedParentMessage(const ActionMessage& cmd)
+    {
+        return !cmd.source_id.isFederate() || isPriorityCommand(cmd) || isProtocolCommand(cmd);
+    }
+}  // namespace
+
 static auto mfact =
     BrokerFactory::addBrokerType<MultiBroker>("multi", static_cast<int>(CoreType::MULTI));
 
@@ -83,7 +98,12 @@ MultiBroker::~MultiBroker()
             std::this_thread::sleep_for(std::chrono::milliseconds(50));
         }
     }
-    masterComm.reset();  // need to ensure the comms are deleted before the callbacks become invalid
+    // need to ensure the comms are deleted before the callbacks become invalid
+    if (fenceTimer) {
+        fenceTimer->cancelAll();
+    }
+    parentLinks.clear();
+    masterComm.reset();
     BrokerBase::joinAllThreads();
 }
 
@@ -111,6 +131,11 @@ bool MultiBroker::brokerConnect()
             }
             masterComm = CommFactory::create(type);
             masterComm->setCallback([this](ActionMessage&& message) {
+                if (message.action() == CMD_PING_REPLY && message.counter > 0) {
+                    // the acknowledgment of a parent link marker
+                    processLinkMarker(message);
+                    return;
+                }
                 BrokerBase::addActionMessage(std::move(message));
             });
             masterComm->setLoggingCallback(BrokerBase::getLoggingCallback());
@@ -122,6 +147,12 @@ bool MultiBroker::brokerConnect()
                 return false;
             }
             BrokerFactory::addAssociatedBrokerType(getIdentifier(), type);
+            if (app && (!netInfo.brokerName.empty() || !netInfo.brokerAddress.empty())) {
+                if (!connectParentLinks(*app, localConfigString)) {
+                    brokerDisconnect();
+                    return false;
+                }
+            }
         }
         bool moreComms = (!configFile.empty());
         if (moreComms) {
@@ -183,6 +214,15 @@ void MultiBroker::brokerDisconnect()
 {
     int exp = 0;
     if (disconnectionStage.compare_exchange_strong(exp, 1)) {
+        // the parent links go first so their messages are sent before the master disconnects
+        for (auto& link : parentLinks) {
+            link->disconnect();
+        }
+        if (fenceActive.load()) {
+            // the disconnected links no longer hold back the fenced messages
+            const std::lock_guard<std::recursive_mutex> lock(linkLock);
+            releaseFencedMessages();
+        }
         if (masterComm) {
             masterComm->disconnect();
         }
@@ -193,6 +233,46 @@ void MultiBroker::brokerDisconnect()
     }
 }
 
+bool MultiBroker::connectParentLinks(helicsCLI11App& app, const std::string& configString)
+{
+    const NetworkBrokerData masterInfo = netInfo;
+    uint16_t index = 0;
+    while (true) {
+        // the links connect to the same broker as the master unless the config says otherwise
+        netInfo = NetworkBrokerData();
+        netInfo.brokerName = masterInfo.brokerName;
+        netInfo.brokerAddress = masterInfo.brokerAddress;
+        netInfo.brokerPort = masterInfo.brokerPort;
+        app.get_config_formatter_base()->section("parent_links")->index(index);
+        app.setDefaultCoreType(CoreType::MULTI);
+        app.parse(configString);
+        const auto linkType = app.getCoreType();
+        if (linkType == CoreType::MULTI) {
+            break;
+        }
+        auto comm = CommFactory::create(linkType);
+        comm->setCallback(
+            [this](ActionMessage&& message) { BrokerBase::addActionMessage(std::move(message)); });
+        comm->setLoggingCallback(BrokerBase::getLoggingCallback());
+        comm->setName(getIdentifier());
+        comm->loadNetworkInfo(netInfo);
+        comm->setTimeout(networkTimeout.to_ms());
+        const bool res = comm->connect();
+        {
+            const std::lock_guard<std::recursive_mutex> lock(linkLock);
+            parentLinks.push_back(std::move(comm));
+            linkMarkers.resize(parentLinks.size() + 1);
+        }
+        if (!res) {
+            netInfo = masterInfo;
+            return false;
+        }
+        ++index;
+    }
+    netInfo = masterInfo;
+    return true;
+}
+
 bool MultiBroker::tryReconnect()
 {
     return masterComm->reconnect();
@@ -224,6 +304,7 @@ std::string MultiBroker::generateLocalAddressString() const
         case CoreType::INPROC:
         case CoreType::IPC:
         case CoreType::INTERPROCESS:
+        case CoreType::SHM:
         case CoreType::TEST:
             return getIdentifier();
         default:
@@ -238,6 +319,10 @@ std::string MultiBroker::generateLocalAddressString() const
 
 void MultiBroker::transmit(route_id rid, const ActionMessage& cmd)
 {
+    if (rid == parent_route_id && !parentLinks.empty()) {
+        transmitToParent(ActionMessage(cmd));
+        return;
+    }
     if (rid == parent_route_id || comms.empty()) {
         if (masterComm) {
             masterComm->transmit(rid, cmd);
@@ -259,6 +344,10 @@ void MultiBroker::transmit(route_id rid, const ActionMessage& cmd)
 
 void MultiBroker::transmit(route_id rid, ActionMessage&& cmd)
 {
+    if (rid == parent_route_id && !parentLinks.empty()) {
+        transmitToParent(std::move(cmd));
+        return;
+    }
     if (rid == parent_route_id || comms.empty()) {
         if (masterComm) {
             masterComm->transmit(rid, cmd);
@@ -278,6 +367,183 @@ void MultiBroker::transmit(route_id rid, ActionMessage&& cmd)
     }
 }
 
+void MultiBroker::transmitToParent(ActionMessage&& cmd)
+{
+    const std::lock_guard<std::recursive_mutex> lock(linkLock);
+    markerSource = global_broker_id_local;
+    markerDestination = higher_broker_id;
+    if (fencedMessages.empty() && !isOrderedParentMessage(cmd)) {
+        sendOverParentLink(std::move(cmd));
+        return;
+    }
+    // messages behind a fence wait as well so nothing overtakes the fenced message
+    fencedMessages.push_back(std::move(cmd));
+    releaseFencedMessages();
+}
+
+void MultiBroker::sendOverParentLink(ActionMessage&& cmd)
+{
+    std::vector<LinkBalancer::LinkLoad> loads;
+    loads.reserve(parentLinks.size() + 1);
+    loads.push_back({masterComm->pendingTransmissions(), masterComm->processedTransmissions()});
+    for (const auto& link : parentLinks) {
+        loads.push_back({link->pendingTransmissions(),
+                         link->processedTransmissions(),
+                         link->isConnected()});
+    }
+    for (std::size_t ii = 0; ii < loads.size(); ++ii) {
+        loads[ii].acknowledged = linkMarkers[ii].acknowledged;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const auto source = cmd.source_id;
+    const auto index = linkBalancer.selectLink(source, loads, now);
+    auto& comm = (index == 0) ? masterComm : parentLinks[index - 1];
+    comm->transmit(parent_route_id, std::move(cmd));
+    // the source can move once the parent acknowledges the next marker on the link
+    linkBalancer.recordQueued(source, index, linkMarkers[index].sent + 1);
+    linkMarkers[index].unmarked = true;
+    markParentLink(index);
+}
+
+void MultiBroker::releaseFencedMessages()
+{
+    if (releasingFence) {
+        // a link made progress while sending, the loop already running checks the fence again
+        return;
+    }
+    releasingFence = true;
+    // set before checking the links so progress made during the check triggers another one
+    fenceActive.store(true);
+    while (!fencedMessages.empty()) {
+        if (!isOrderedParentMessage(fencedMessages.front())) {
+            auto cmd = std::move(fencedMessages.front());
+            fencedMessages.pop_front();
+            sendOverParentLink(std::move(cmd));
+            continue;
+        }
+        if (fenceTargets.empty()) {
+            fenceTargets.reserve(parentLinks.size());
+            for (std::size_t ii = 1; ii <= parentLinks.size(); ++ii) {
+                const auto& markers = linkMarkers[ii];
+                // messages queued after the marker waiting on the parent need the next one
+                fenceTargets.push_back(markers.unmarked ? markers.sent + 1 : markers.sent);
+                markParentLink(ii);
+            }
+            fenceStart = std::chrono::steady_clock::now();
+            if (!parentLinksReachedFence()) {
+                if (!fenceTimer) {
+                    fenceTimer = std::make_shared<MessageTimer>([this](ActionMessage&& /*unused*/) {
+                        const std::lock_guard<std::recursive_mutex> lock(linkLock);
+                        releaseFencedMessages();
+                    });
+                }
+                const auto expiration = fenceStart + parentLinkFenceTimeout;
+                if (fenceTimerIndex < 0) {
+                    fenceTimerIndex = fenceTimer->addTimer(expiration, ActionMessage(CMD_IGNORE));
+                } else {
+                    fenceTimer->updateTimer(fenceTimerIndex, expiration);
+                }
+            }
+        }
+        if (!parentLinksReachedFence()) {
+            if (std::chrono::steady_clock::now() - fenceStart < parentLinkFenceTimeout) {
+                // the marker acknowledgments or the fence timer pick this up later
+                releasingFence = false;
+                return;
+            }
+            ++fenceTimeouts;
+            sendToLogger(parent_broker_id,
+                         HELICS_LOG_LEVEL_WARNING,
+                         getIdentifier(),
+                         "parent did not acknowledge the parent link markers in time, message "
+                         "order to the parent is not guaranteed");
+        }
+        fenceTargets.clear();
+        auto cmd = std::move(fencedMessages.front());
+        fencedMessages.pop_front();
+        masterComm->transmit(parent_route_id, std::move(cmd));
+    }
+    fenceActive.store(false);
+    releasingFence = false;
+}
+
+bool MultiBroker::parentLinksReachedFence() const
+{
+    for (std::size_t ii = 0; ii < parentLinks.size() && ii < fenceTargets.size(); ++ii) {
+        if (parentLinks[ii]->isConnected() &&
+            linkMarkers[ii + 1].acknowledged < fenceTargets[ii]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void MultiBroker::markParentLink(std::size_t index)
+{
+    auto& markers = linkMarkers[index];
+    if (!markers.unmarked || markers.sent != markers.acknowledged ||
+        !markerDestination.isBroker() || !markerSource.isValid()) {
+        return;
+    }
+    // the parent answers the ping after it has processed everything sent over the link before it
+    ActionMessage marker(CMD_PING);
+    marker.source_id = markerSource;
+    marker.dest_id = markerDestination;
+    marker.messageID = static_cast<std::int32_t>(++markers.sent);
+    marker.counter = static_cast<std::uint16_t>(index + 1);
+    markers.unmarked = false;
+    auto& comm = (index == 0) ? masterComm : parentLinks[index - 1];
+    comm->transmit(parent_route_id, std::move(marker));
+}
+
+void MultiBroker::processLinkMarker(const ActionMessage& reply)
+{
+    const std::lock_guard<std::recursive_mutex> lock(linkLock);
+    const std::size_t index = reply.counter - 1;
+    if (index >= linkMarkers.size()) {
+        return;
+    }
+    auto& markers = linkMarkers[index];
+    // only one marker per link waits for its acknowledgment at a time
+    if (static_cast<std::int32_t>(markers.sent) != reply.messageID) {
+        return;
+    }
+    markers.acknowledged = markers.sent;
+    markParentLink(index);
+    if (fenceActive.load()) {
+        releaseFencedMessages();
+    }
+}
+
+std::string MultiBroker::commsQuery(std::string_view request) const
+{
+    if (request == "parent_links") {
+        if (parentLinks.empty()) {
+            return {};
+        }
+        const std::lock_guard<std::recursive_mutex> lock(linkLock);
+        std::string result{"["};
+        for (std::size_t ii = 0; ii <= parentLinks.size(); ++ii) {
+            const auto& comm = (ii == 0) ? masterComm : parentLinks[ii - 1];
+            result.append(fmt::format(
+                R"({{"index":{},"connected":{},"messages":{},"pending":{},"rate":{},)"
+                R"("expected_delay_us":{},"markers":{},"acknowledged":{},"fence_timeouts":{}}})",
+                ii,
+                comm->isConnected(),
+                linkBalancer.messageCount(ii),
+                comm->pendingTransmissions(),
+                linkBalancer.sendRate(ii),
+                static_cast<double>(linkBalancer.expectedDelay(ii).count()) / 1.0e3,
+                linkMarkers[ii].sent,
+                linkMarkers[ii].acknowledged,
+                fenceTimeouts));
+            result.push_back((ii == parentLinks.size()) ? ']' : ',');
+        }
+        return result;
+    }
+    return masterComm ? masterComm->query(request) : std::string{};
+}
+
 void MultiBroker::addRoute(route_id rid, int interfaceId, std::string_view routeInfo)
 {
     if (interfaceId <= 0) {
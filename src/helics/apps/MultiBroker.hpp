@@ -8,8 +8,14 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 #include "../core/CoreBroker.hpp"
 #include "../network/NetworkBroker.hpp"
+#include "LinkBalancer.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -17,6 +23,7 @@ SPDX-License-Identifier: BSD-3-Clause
 namespace helics {
 class ActionMessage;
 class CommsInterface;
+class MessageTimer;
 
 // small function to call to force symbol linkages
 bool allowMultiBroker();
@@ -35,6 +42,34 @@ class MultiBroker: public CoreBroker {
     std::atomic<bool> brokerInitialized{false};  //!< atomic protecting local initialization
     CoreType type{CoreType::MULTI};  //!< the core type of the master controller
     std::vector<std::pair<route_id, int>> routingTable;  // index of the routes
+    /// additional links to the parent broker used in parallel with the master comm
+    std::vector<std::unique_ptr<CommsInterface>> parentLinks;
+    LinkBalancer linkBalancer;  //!< selection of the link for messages to the parent
+    /// lock protecting the link balancer and the fence, recursive since a transmit on an inproc
+    /// link can run the transmit callback of the link on the same thread
+    mutable std::recursive_mutex linkLock;
+    /// messages to the parent held until the parent has received what the links sent before them
+    std::deque<ActionMessage> fencedMessages;
+    /** the state of the markers the parent acknowledges once it has received the messages sent
+    over a link before the marker*/
+    struct LinkMarkers {
+        std::uint64_t sent{0};  //!< the last marker sent over the link
+        std::uint64_t acknowledged{0};  //!< the last marker acknowledged by the parent
+        bool unmarked{false};  //!< indicator that messages were queued after the last marker
+    };
+    /// the markers of the links to the parent, index 0 is the master comm
+    std::vector<LinkMarkers> linkMarkers;
+    /// the marker each parent link must have acknowledged before the first fenced message is sent
+    std::vector<std::uint64_t> fenceTargets;
+    std::chrono::steady_clock::time_point fenceStart;  //!< the time the current fence was set
+    std::shared_ptr<MessageTimer> fenceTimer;  //!< timer releasing a fence that is not cleared
+    std::int32_t fenceTimerIndex{-1};  //!< the index of the fence timeout in the fenceTimer
+    std::uint64_t fenceTimeouts{0};  //!< the number of fences released by the timeout
+    GlobalBrokerId markerSource;  //!< the id of the broker for the markers
+    GlobalBrokerId markerDestination;  //!< the id of the parent broker for the markers
+    std::atomic<bool> fenceActive{false};  //!< indicator that messages are waiting on the fence
+    bool releasingFence{false};  //!< indicator that the fenced messages are being sent
+
   public:
     /** default constructor*/
     MultiBroker() noexcept;
@@ -53,10 +88,27 @@ class MultiBroker: public CoreBroker {
     virtual bool tryReconnect() override;
     /** generate a CLI11 Application for subprocesses for processing of command line arguments*/
     virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
+    /** create and connect the comms listed in the parent_links section of the config file*/
+    bool connectParentLinks(helicsCLI11App& app, const std::string& configString);
+    /** send a message to the parent broker over the least loaded of the parent links*/
+    void transmitToParent(ActionMessage&& cmd);
+    /** send a federate message over the least loaded of the parent links, linkLock must be held*/
+    void sendOverParentLink(ActionMessage&& cmd);
+    /** send the fenced messages whose fence has cleared, linkLock must be held*/
+    void releaseFencedMessages();
+    /** check if the parent has acknowledged the markers of the current fence*/
+    bool parentLinksReachedFence() const;
+    /** send a marker over a link if messages were queued after the last one and no marker is
+    waiting for its acknowledgment, linkLock must be held*/
+    void markParentLink(std::size_t index);
+    /** process the acknowledgment of a marker from the parent broker*/
+    void processLinkMarker(const ActionMessage& reply);
 
   protected:
     /** generate the local address information*/
     virtual std::string generateLocalAddressString() const override;
+    /** query the comms, "parent_links" returns the load of the links to the parent broker*/
+    virtual std::string commsQuery(std::string_view request) const override;
 
   public:
     virtual void transmit(route_id rid, const ActionMessage& cmd) override;
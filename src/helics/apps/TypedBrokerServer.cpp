@@ -41,7 +41,7 @@ static std::pair<std::shared_ptr<Broker>, bool>
         brkname = strs[0];
     }
     if (strs.size() > 1) {
-        brkinit = strs[1] + " --external --localport=" + std::to_string(startPort);
+        brkinit = std::string(strs[1]) + " --external --localport=" + std::to_string(startPort);
     } else {
         brkinit = "--external --localport=" + std::to_string(startPort);
     }
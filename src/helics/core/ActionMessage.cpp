@@ -17,6 +17,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/utilities/base64.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <complex>
 #include <cstring>
 #include <fmt/format.h>
@@ -46,7 +48,7 @@ ActionMessage::ActionMessage(ActionMessage&& act) noexcept:
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
     counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
     Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), payload(std::move(act.payload)),
-    stringData(std::move(act.stringData))
+    stringData(std::move(act.stringData)), sharedPayload(std::move(act.sharedPayload))
 {
 }
 
@@ -54,18 +56,23 @@ ActionMessage::ActionMessage(const ActionMessage& act):
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
     counter(act.counter), flags(act.flags), sequenceID(act.sequenceID), actionTime(act.actionTime),
-    Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), payload(act.payload), stringData(act.stringData)
+    Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), stringData(act.stringData)
+{
+    if (act.hasSharedPayload()) {
+        setSharedPayload(act.sharedPayload);
+    } else {
+        payload = act.payload;
+    }
+}
 
+ActionMessage::ActionMessage(std::unique_ptr<Message> message): ActionMessage(std::move(*message))
 {
 }
 
-ActionMessage::ActionMessage(std::unique_ptr<Message> message):
-    messageAction(CMD_SEND_MESSAGE), messageID(message->messageID), flags(message->flags),
-    actionTime(message->time), payload(std::move(message->data)),
-    stringData({std::move(message->dest),
-                std::move(message->source),
-                std::move(message->original_source),
-                std::move(message->original_dest)})
+ActionMessage::ActionMessage(Message&& message):
+    messageAction(CMD_SEND_MESSAGE), messageID(message.messageID), flags(message.flags),
+    actionTime(message.time), payload(std::move(message.data)),
+    stringData({message.dest, message.source, message.original_source, message.original_dest})
 {
 }
 
@@ -101,7 +108,12 @@ ActionMessage& ActionMessage::operator=(const ActionMessage& act)  // NOLINT
     Te = act.Te;
     Tdemin = act.Tdemin;
     Tso = act.Tso;
-    payload = act.payload;
+    if (act.hasSharedPayload()) {
+        setSharedPayload(act.sharedPayload);
+    } else {
+        releaseSharedPayload();
+        payload = act.payload;
+    }
     stringData = act.stringData;
     return *this;
 }
@@ -123,6 +135,7 @@ ActionMessage& ActionMessage::operator=(ActionMessage&& act) noexcept
     Tso = act.Tso;
     payload = std::move(act.payload);
     stringData = std::move(act.stringData);
+    sharedPayload = std::move(act.sharedPayload);
     return *this;
 }
 
@@ -131,12 +144,11 @@ ActionMessage& ActionMessage::operator=(std::unique_ptr<Message> message) noexce
     messageAction = CMD_SEND_MESSAGE;
     messageID = message->messageID;
     flags = message->flags;
+    sharedPayload.reset();
     payload = std::move(message->data);
     actionTime = message->time;
-    stringData = {std::move(message->dest),
-                  std::move(message->source),
-                  std::move(message->original_source),
-                  std::move(message->original_dest)};
+    stringData.assign(
+        {message->dest, message->source, message->original_source, message->original_dest});
     return *this;
 }
 
@@ -145,14 +157,85 @@ void ActionMessage::setAction(action_message_def::action_t newAction)
     messageAction = newAction;
 }
 
-// NOLINTNEXTLINE
-static const std::string emptyStr;
-const std::string& ActionMessage::getString(int index) const
+void ActionMessage::setSharedPayload(std::shared_ptr<const SmallBuffer> data)
+{
+    if (!data) {
+        releaseSharedPayload();
+        payload.clear();
+        return;
+    }
+    // the view has no capacity so any assignment, append, or resize of the payload copies the data
+    // to a new buffer before writing instead of writing into the shared buffer
+    payload.spanAssign(data->data(), data->size(), 0);
+    sharedPayload = std::move(data);
+}
+
+std::shared_ptr<const SmallBuffer> ActionMessage::extractSharedPayload()
+{
+    if (hasSharedPayload()) {
+        payload = SmallBuffer();
+        return std::exchange(sharedPayload, nullptr);
+    }
+    sharedPayload.reset();
+    return std::make_shared<const SmallBuffer>(std::move(payload));
+}
+
+void ActionMessage::detachPayload()
+{
+    if (hasSharedPayload()) {
+        payload = SmallBuffer(*sharedPayload);
+    }
+    sharedPayload.reset();
+}
+
+void ActionMessage::movePayloadTo(SmallBuffer& data)
+{
+    if (hasSharedPayload() || payload.size() <= data.capacity()) {
+        data.assign(payload.data(), payload.size());
+        releaseSharedPayload();
+        payload.clear();
+    } else {
+        sharedPayload.reset();
+        data = std::move(payload);
+    }
+}
+
+namespace {
+    /// a payload viewing part of a larger buffer along with the owner keeping the buffer alive
+    struct PayloadView {
+        std::shared_ptr<const void> owner;
+        SmallBuffer view;
+    };
+}  // namespace
+
+void ActionMessage::setPayloadView(const std::byte* data,
+                                   std::size_t size,
+                                   const std::shared_ptr<const void>& owner)
+{
+    auto holder = std::make_shared<PayloadView>();
+    holder->owner = owner;
+    // the view never writes to the data, the shared payload is treated as read only
+    holder->view.spanAssign(const_cast<std::byte*>(data), size, size);
+    setSharedPayload(std::shared_ptr<const SmallBuffer>(holder, &holder->view));
+}
+
+void ActionMessage::releaseSharedPayload()
+{
+    if (sharedPayload) {
+        // drop any view so later writes do not go into the shared buffer
+        if (hasSharedPayload()) {
+            payload = SmallBuffer();
+        }
+        sharedPayload.reset();
+    }
+}
+
+std::string_view ActionMessage::getString(int index) const
 {
     if (isValidIndex(index, stringData)) {
         return stringData[index];
     }
-    return emptyStr;
+    return {};
 }
 static constexpr std::size_t maxPayloadSize{0x00FFFFFFUL};
 
@@ -161,18 +244,11 @@ void ActionMessage::setString(int index, std::string_view str)
     if (index >= 255 || index < 0) {
         throw(std::invalid_argument("index out of specified range (0-254)"));
     }
-    if (index >= static_cast<int>(stringData.size())) {
-        stringData.resize(static_cast<size_t>(index) + 1);
-    }
-    stringData[index] = str;
+    stringData.set(static_cast<std::size_t>(index), str);
 }
 
-/** check for little endian*/
-static inline std::uint8_t isLittleEndian()
-{
-    static std::int32_t test{1};
-    return (*reinterpret_cast<std::int8_t*>(&test) == 1) ? static_cast<std::uint8_t>(1) : 0;
-}
+/** marker for little endian byte order of the serialized fields*/
+static constexpr std::uint8_t littleEndian{(std::endian::native == std::endian::little) ? 1U : 0U};
 
 // action_message_base_size= 7 header fields(7*4 bytes)+flags(2 bytes)+counter(2 bytes)+time(8
 // bytes)+payload size(4 bytes)+1 byte for number of strings=45
@@ -181,7 +257,6 @@ static constexpr std::size_t action_message_base_size =
 
 int ActionMessage::toByteArray(std::byte* data, std::size_t buffer_size) const
 {
-    static const uint8_t littleEndian = isLittleEndian();
 
     // put the main string size in the first 4 bytes;
     std::uint32_t ssize{0UL};
@@ -253,7 +328,8 @@ int ActionMessage::toByteArray(std::byte* data, std::size_t buffer_size) const
 
     ++data;
     ssize += action_message_base_size;
-    for (const auto& str : stringData) {
+    for (std::size_t ii = 0; ii < stringData.size(); ++ii) {
+        const auto str = stringData[ii];
         auto strsize = static_cast<uint32_t>(str.size());
         if (buffer_size < ssize + strsize + 4) {
             return -1;
@@ -290,10 +366,8 @@ int ActionMessage::serializedByteCount() const
         return size;
     }
     size += static_cast<int>(payload.size());
-    for (const auto& str : stringData) {
-        // 4(to store the length)+length of the string
-        size += static_cast<int>(sizeof(uint32_t) + str.size());
-    }
+    // 4(to store the length)+length of each string
+    size += static_cast<int>(sizeof(uint32_t) * stringData.size() + stringData.characterCount());
     if (payload.size() >= maxPayloadSize) {
         size += 4;
     }
@@ -337,8 +411,8 @@ std::string ActionMessage::to_json_string() const
     packet["stringCount"] = static_cast<std::uint32_t>(stringData.size());
     if (!stringData.empty()) {
         nlohmann::json sdata = nlohmann::json::array();
-        for (const auto& str : stringData) {
-            sdata.push_back(str);
+        for (std::size_t ii = 0; ii < stringData.size(); ++ii) {
+            sdata.push_back(stringData[ii]);
         }
         packet["strings"] = std::move(sdata);
     }
@@ -350,7 +424,8 @@ std::string ActionMessage::to_json_string() const
         packet["payload"] = gmlc::utilities::base64_encode(payload.data(), payload.size());
         if (!stringData.empty()) {
             nlohmann::json sdata = nlohmann::json::array();
-            for (const auto& str : stringData) {
+            for (std::size_t ii = 0; ii < stringData.size(); ++ii) {
+                const auto str = stringData[ii];
                 sdata.push_back(gmlc::utilities::base64_encode(str.data(), str.size()));
             }
             packet["strings"] = std::move(sdata);
@@ -385,18 +460,58 @@ std::string ActionMessage::packetize_json() const
 
 void ActionMessage::packetize(std::string& data) const
 {
-    auto size = serializedByteCount();
-    data.resize(sizeof(uint32_t) + static_cast<size_t>(size));
-    toByteArray(reinterpret_cast<std::byte*>(&(data[4])), size);
+    data.clear();
+    appendPacket(data);
+}
 
-    data[0] = LEADING_CHAR;
+void ActionMessage::appendPacket(std::string& data) const
+{
+    const auto start = data.size();
+    const auto size = static_cast<std::size_t>(serializedByteCount());
+    // the header and tail are written in place so the buffer is only resized once
+    data.resize(start + sizeof(uint32_t) + size + 2);
+    char* packet = data.data() + start;
+    toByteArray(reinterpret_cast<std::byte*>(packet + sizeof(uint32_t)), size);
+
+    packet[0] = LEADING_CHAR;
     // now generate a length header
-    auto dsz = static_cast<uint32_t>(data.size());
-    data[1] = static_cast<char>(((dsz >> 16U) & 0xFFU));
-    data[2] = static_cast<char>(((dsz >> 8U) & 0xFFU));
-    data[3] = static_cast<char>(dsz & 0xFFU);
-    data.push_back(TAIL_CHAR1);
-    data.push_back(TAIL_CHAR2);
+    const auto dsz = static_cast<uint32_t>(size + sizeof(uint32_t));
+    packet[1] = static_cast<char>(((dsz >> 16U) & 0xFFU));
+    packet[2] = static_cast<char>(((dsz >> 8U) & 0xFFU));
+    packet[3] = static_cast<char>(dsz & 0xFFU);
+    packet[dsz] = TAIL_CHAR1;
+    packet[dsz + 1] = TAIL_CHAR2;
+}
+
+void packetizeBatch(const std::vector<ActionMessage>& messages, std::string& data)
+{
+    std::size_t totalSize{0};
+    for (const auto& message : messages) {
+        totalSize += static_cast<std::size_t>(message.serializedByteCount()) + 6;
+    }
+    data.clear();
+    data.reserve(totalSize);
+    for (const auto& message : messages) {
+        message.appendPacket(data);
+    }
+}
+
+std::size_t depacketizeBatch(const void* data,
+                             std::size_t buffer_size,
+                             std::vector<ActionMessage>& messages)
+{
+    const auto* bytes = reinterpret_cast<const std::byte*>(data);
+    std::size_t used{0};
+    while (used < buffer_size) {
+        ActionMessage message;
+        const auto packetSize = message.depacketize(bytes + used, buffer_size - used);
+        if (packetSize == 0) {
+            break;
+        }
+        used += packetSize;
+        messages.push_back(std::move(message));
+    }
+    return used;
 }
 
 std::vector<char> ActionMessage::to_vector() const
@@ -432,14 +547,21 @@ inline void swap_bytes(std::uint8_t* data)
 
 std::size_t ActionMessage::fromByteArray(const std::byte* data, std::size_t buffer_size)
 {
+    return fromByteArray(data, buffer_size, std::shared_ptr<const void>{});
+}
+
+std::size_t ActionMessage::fromByteArray(const std::byte* data,
+                                         std::size_t buffer_size,
+                                         const std::shared_ptr<const void>& owner)
+{
+    releaseSharedPayload();
     std::size_t tsize{action_message_base_size};
-    static const uint8_t littleEndian = isLittleEndian();
     if (buffer_size < tsize) {
         messageAction = CMD_INVALID;
         return (0);
     }
     if (data[0] == static_cast<std::byte>(LEADING_CHAR)) {
-        auto res = depacketize(data, buffer_size);
+        auto res = depacketize(data, buffer_size, owner);
         if (res > 0) {
             return static_cast<int>(res);
         }
@@ -514,19 +636,30 @@ std::size_t ActionMessage::fromByteArray(const std::byte* data, std::size_t buff
         Tso = timeZero;
     }
     if (size > 0) {
-        payload.assign(data, size);
+        if (owner && (messageAction == CMD_PUB || messageAction == CMD_PUB_BATCH) &&
+            size >= zeroCopyPayloadThreshold && size < maxPayloadSize) {
+            setPayloadView(data, size, owner);
+        } else {
+            payload.assign(data, size);
+        }
         data += size;
     }
     auto stringCount = std::to_integer<std::size_t>(*data);
     ++data;
     if (stringCount != 0) {
-        stringData.resize(stringCount);
         tsize += 4 * stringCount;
         if (buffer_size < tsize) {
             messageAction = CMD_INVALID;
             return (0);
         }
-
+        // most messages carry 4 or fewer strings so only multi-messages need the extra storage
+        std::array<std::string_view, 4> localViews;
+        std::vector<std::string_view> extendedViews;
+        std::string_view* views = localViews.data();
+        if (stringCount > localViews.size()) {
+            extendedViews.resize(stringCount);
+            views = extendedViews.data();
+        }
         for (std::size_t ii = 0; ii < stringCount; ++ii) {
             uint32_t ssize;
             memcpy(&ssize, data, sizeof(uint32_t));
@@ -539,9 +672,10 @@ std::size_t ActionMessage::fromByteArray(const std::byte* data, std::size_t buff
                 messageAction = CMD_INVALID;
                 return (0);
             }
-            stringData[ii].assign(reinterpret_cast<const char*>(data), ssize);
+            views[ii] = std::string_view(reinterpret_cast<const char*>(data), ssize);
             data += ssize;
         }
+        stringData.assign(views, stringCount);
     } else {
         stringData.clear();
     }
@@ -577,6 +711,13 @@ std::size_t ActionMessage::fromByteArray(const std::byte* data, std::size_t buff
 }
 
 std::size_t ActionMessage::depacketize(const void* data, std::size_t buffer_size)
+{
+    return depacketize(data, buffer_size, std::shared_ptr<const void>{});
+}
+
+std::size_t ActionMessage::depacketize(const void* data,
+                                       std::size_t buffer_size,
+                                       const std::shared_ptr<const void>& owner)
 {
     const auto* bytes = reinterpret_cast<const std::byte*>(data);
     if (bytes[0] != static_cast<std::byte>(LEADING_CHAR)) {
@@ -600,7 +741,7 @@ std::size_t ActionMessage::depacketize(const void* data, std::size_t buffer_size
         return 0;
     }
 
-    std::size_t bytesUsed = fromByteArray(bytes + 4, message_size - 4);
+    std::size_t bytesUsed = fromByteArray(bytes + 4, message_size - 4, owner);
     if (bytesUsed == 0U) {
         if (from_json_string(
                 std::string_view(reinterpret_cast<const char*>(bytes) + 4, message_size - 4))) {
@@ -612,7 +753,14 @@ std::size_t ActionMessage::depacketize(const void* data, std::size_t buffer_size
 
 std::size_t ActionMessage::from_string(std::string_view data)
 {
-    auto result = fromByteArray(reinterpret_cast<const std::byte*>(data.data()), data.size());
+    return from_string(data, std::shared_ptr<const void>{});
+}
+
+std::size_t ActionMessage::from_string(std::string_view data,
+                                       const std::shared_ptr<const void>& owner)
+{
+    auto result =
+        fromByteArray(reinterpret_cast<const std::byte*>(data.data()), data.size(), owner);
     if (result == 0U && !data.empty() && data.front() == '{') {
         if (from_json_string(data)) {
             return data.size();
@@ -625,6 +773,7 @@ bool ActionMessage::from_json_string(std::string_view data)
 {
     try {
         auto val = fileops::loadJsonStr(data);
+        releaseSharedPayload();
         // auto version = val["version"].asFloat();
         messageAction = static_cast<action_message_def::action_t>(val["command"].get<int32_t>());
         messageID = val["messageId"].get<int32_t>();
@@ -643,19 +792,21 @@ bool ActionMessage::from_json_string(std::string_view data)
         }
         payload = val["payload"].get<std::string>();
         auto stringCount = val["stringCount"].get<int>();
-        stringData.resize(stringCount);
-        for (int ii = 0; ii < stringCount; ++ii) {
-            setString(ii, val["strings"][ii].get<std::string>());
-        }
         bool base64_encoding{false};
         if (val.contains("encoding") && val["encoding"].is_string()) {
             base64_encoding = val["encoding"].get<std::string>() == "base64";
         }
+        std::vector<std::string> strings(stringCount);
+        for (int ii = 0; ii < stringCount; ++ii) {
+            strings[ii] = val["strings"][ii].get<std::string>();
+            if (base64_encoding) {
+                strings[ii] = gmlc::utilities::base64_decode_to_string(strings[ii]);
+            }
+        }
+        const std::vector<std::string_view> views(strings.begin(), strings.end());
+        stringData.assign(views.data(), views.size());
         if (base64_encoding) {
             payload = gmlc::utilities::base64_decode_to_string(payload.to_string());
-            for (auto& stringd : stringData) {
-                stringd = gmlc::utilities::base64_decode_to_string(stringd);
-            }
         }
     }
     catch (...) {
@@ -711,30 +862,37 @@ std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd)
 
 std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd)
 {
-    auto msg = std::make_unique<Message>();
+    return createMessageFromCommand(std::move(cmd), std::make_unique<Message>());
+}
+
+std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd,
+                                                  std::unique_ptr<Message> msg)
+{
+    msg->clear();
+    // the strings are packed so they cannot be moved out
     switch (cmd.stringData.size()) {
         case 0:
             break;
         case 1:
-            msg->dest = std::move(cmd.stringData[0]);
+            msg->dest = cmd.stringData[0];
             break;
         case 2:
-            msg->dest = std::move(cmd.stringData[0]);
-            msg->source = std::move(cmd.stringData[1]);
+            msg->dest = cmd.stringData[0];
+            msg->source = cmd.stringData[1];
             break;
         case 3:
-            msg->dest = std::move(cmd.stringData[0]);
-            msg->source = std::move(cmd.stringData[1]);
-            msg->original_source = std::move(cmd.stringData[2]);
+            msg->dest = cmd.stringData[0];
+            msg->source = cmd.stringData[1];
+            msg->original_source = cmd.stringData[2];
             break;
         default:
-            msg->dest = std::move(cmd.stringData[0]);
-            msg->source = std::move(cmd.stringData[1]);
-            msg->original_source = std::move(cmd.stringData[2]);
-            msg->original_dest = std::move(cmd.stringData[3]);
+            msg->dest = cmd.stringData[0];
+            msg->source = cmd.stringData[1];
+            msg->original_source = cmd.stringData[2];
+            msg->original_dest = cmd.stringData[3];
             break;
     }
-    msg->data = std::move(cmd.payload);
+    cmd.movePayloadTo(msg->data);
     msg->time = cmd.actionTime;
     msg->flags = cmd.flags;
     msg->messageID = cmd.messageID;
@@ -744,7 +902,7 @@ std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd)
 static constexpr char unknownStr[] = "unknown";
 
 // Map to translate the action to a description
-static constexpr frozen::unordered_map<action_message_def::action_t, std::string_view, 96>
+static constexpr frozen::unordered_map<action_message_def::action_t, std::string_view, 97>
     actionStrings = {
         // priority commands
         {action_message_def::action_t::cmd_priority_disconnect, "priority_disconnect"},
@@ -791,6 +949,7 @@ static constexpr frozen::unordered_map<action_message_def::action_t, std::string
         {action_message_def::action_t::cmd_time_unblock, "time_unblock"},
         {action_message_def::action_t::cmd_request_current_time, "request current time"},
         {action_message_def::action_t::cmd_pub, "pub"},
+        {action_message_def::action_t::cmd_pub_batch, "pub batch"},
         {action_message_def::action_t::cmd_bye, "bye"},
         {action_message_def::action_t::cmd_log, "log"},
         {action_message_def::action_t::cmd_warning, "warning"},
@@ -880,11 +1039,11 @@ const char* commandErrorString(int errorCode)
 std::string errorMessageString(const ActionMessage& command)
 {
     if (checkActionFlag(command, error_flag)) {
-        const auto& estring = command.getString(0);
+        const auto estring = command.getString(0);
         if (estring.empty()) {
             return commandErrorString(command.messageID);
         }
-        return estring;
+        return std::string(estring);
     }
     return std::string{};
 }
@@ -921,6 +1080,14 @@ std::string prettyPrintString(const ActionMessage& command)
                                    static_cast<double>(command.actionTime),
                                    command.dest_id.baseValue()));
             break;
+        case CMD_PUB_BATCH:
+            ret.push_back(':');
+            ret.append(fmt::format("From ({}) size {} at {} to {}",
+                                   command.source_id.baseValue(),
+                                   command.payload.size(),
+                                   static_cast<double>(command.actionTime),
+                                   command.dest_id.baseValue()));
+            break;
         case CMD_REG_BROKER:
             ret.push_back(':');
             ret.append(command.name());
@@ -997,4 +1164,121 @@ void setIterationFlags(ActionMessage& command, IterationRequest iterate)
             break;
     }
 }
+
+std::size_t coalesceTimingMessages(std::vector<ActionMessage>& messages)
+{
+    // the location of the last message seen for each source/destination pair
+    std::vector<std::pair<std::pair<GlobalFederateId, GlobalFederateId>, std::size_t>> lastMessage;
+    std::size_t removed{0};
+    for (std::size_t index = 0; index < messages.size(); ++index) {
+        auto& message = messages[index];
+        if (message.action() == CMD_IGNORE) {
+            continue;
+        }
+        const auto route = std::make_pair(message.source_id, message.dest_id);
+        auto last = std::ranges::find_if(lastMessage,
+                                         [&route](const auto& val) { return val.first == route; });
+        if (last == lastMessage.end()) {
+            lastMessage.emplace_back(route, index);
+            continue;
+        }
+        auto& previous = messages[last->second];
+        if ((message.action() == CMD_TIME_REQUEST || message.action() == CMD_EXEC_REQUEST) &&
+            previous.action() == message.action() && previous.flags == message.flags &&
+            previous.source_handle == message.source_handle &&
+            previous.dest_handle == message.dest_handle) {
+            previous.setAction(CMD_IGNORE);
+            ++removed;
+        }
+        last->second = index;
+    }
+    if (removed > 0) {
+        std::erase_if(messages,
+                      [](const ActionMessage& message) { return message.action() == CMD_IGNORE; });
+    }
+    return removed;
+}
+
+namespace {
+    void storeLittleEndian(std::byte* location, std::uint32_t value)
+    {
+        for (int ii = 0; ii < 4; ++ii) {
+            location[ii] = static_cast<std::byte>((value >> (8 * ii)) & 0xFFU);
+        }
+    }
+
+    std::uint32_t loadLittleEndian(const std::byte* location)
+    {
+        std::uint32_t value{0};
+        for (int ii = 0; ii < 4; ++ii) {
+            value |= std::to_integer<std::uint32_t>(location[ii]) << (8 * ii);
+        }
+        return value;
+    }
+}  // namespace
+
+void packPublicationBatch(ActionMessage& batch, const std::vector<PublicationBatchEntry>& entries)
+{
+    const auto count = entries.size();
+    std::size_t dataSize{0};
+    for (const auto& entry : entries) {
+        dataSize += entry.data->size();
+    }
+    SmallBuffer payload(sizeof(std::uint32_t) * (1 + 3 * count) + dataSize);
+    auto* location = payload.data();
+    storeLittleEndian(location, static_cast<std::uint32_t>(count));
+    auto* sourceColumn = location + sizeof(std::uint32_t);
+    auto* destColumn = sourceColumn + sizeof(std::uint32_t) * count;
+    auto* sizeColumn = destColumn + sizeof(std::uint32_t) * count;
+    auto* values = sizeColumn + sizeof(std::uint32_t) * count;
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        const auto& entry = entries[ii];
+        const auto offset = sizeof(std::uint32_t) * ii;
+        storeLittleEndian(sourceColumn + offset,
+                          static_cast<std::uint32_t>(entry.source_handle.baseValue()));
+        storeLittleEndian(destColumn + offset,
+                          static_cast<std::uint32_t>(entry.dest_handle.baseValue()));
+        storeLittleEndian(sizeColumn + offset, static_cast<std::uint32_t>(entry.data->size()));
+        if (!entry.data->empty()) {
+            std::memcpy(values, entry.data->data(), entry.data->size());
+            values += entry.data->size();
+        }
+    }
+    batch.payload = std::move(payload);
+}
+
+std::vector<PublicationBatchEntry> unpackPublicationBatch(const ActionMessage& batch)
+{
+    std::vector<PublicationBatchEntry> entries;
+    const auto* location = batch.payload.data();
+    const auto size = batch.payload.size();
+    if (size < sizeof(std::uint32_t)) {
+        return entries;
+    }
+    const std::size_t count = loadLittleEndian(location);
+    if ((size - sizeof(std::uint32_t)) / (3 * sizeof(std::uint32_t)) < count) {
+        return entries;
+    }
+    const auto* sourceColumn = location + sizeof(std::uint32_t);
+    const auto* destColumn = sourceColumn + sizeof(std::uint32_t) * count;
+    const auto* sizeColumn = destColumn + sizeof(std::uint32_t) * count;
+    const auto* values = sizeColumn + sizeof(std::uint32_t) * count;
+    auto remaining = static_cast<std::size_t>(location + size - values);
+    entries.reserve(count);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        const auto offset = sizeof(std::uint32_t) * ii;
+        const std::size_t valueSize = loadLittleEndian(sizeColumn + offset);
+        if (valueSize > remaining) {
+            entries.clear();
+            break;
+        }
+        entries.push_back(
+            {InterfaceHandle(static_cast<std::int32_t>(loadLittleEndian(sourceColumn + offset))),
+             InterfaceHandle(static_cast<std::int32_t>(loadLittleEndian(destColumn + offset))),
+             std::make_shared<const SmallBuffer>(values, valueSize)});
+        values += valueSize;
+        remaining -= valueSize;
+    }
+    return entries;
+}
 }  // namespace helics
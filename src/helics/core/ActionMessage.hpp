@@ -7,11 +7,14 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "ActionMessageDefintions.hpp"
+#include "CompactStringArray.hpp"
 #include "SmallBuffer.hpp"
 #include "basic_CoreTypes.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -25,11 +28,13 @@ constexpr int typeStringLoc{0};
 constexpr int typeOutStringLoc{1};
 
 constexpr int32_t cmd_info_basis{65536};
+/// value payloads at least this size can reference a shared receive buffer instead of a copy
+constexpr std::size_t zeroCopyPayloadThreshold{1024};
 
 /** class defining the primary multiMessage object used in HELICS */
 class ActionMessage {
-    // need to try to make sure this object is under 64 bytes in size to fit in cache lines NOT
-    // there yet
+    // the goal is to fit in a 64 byte cache line, the fixed fields take up the first 64 bytes
+    // but the payload buffer adds 96, the packed strings 8 and the shared payload 16 for 184
   private:
     action_message_def::action_t messageAction{CMD_IGNORE};  // 4 -- command
   public:
@@ -47,7 +52,16 @@ class ActionMessage {
     Time Tso{timeZero};  //!< 64 the second order dependent time
     SmallBuffer payload;  //!< buffer to contain the data payload
   private:
-    std::vector<std::string> stringData;  //!< container for extra string data
+    CompactStringArray stringData;  //!< container for extra string data
+    /// immutable buffer shared between messages that the payload may be a view of
+    std::shared_ptr<const SmallBuffer> sharedPayload;
+    /** drop the view of a shared buffer without copying it*/
+    void releaseSharedPayload();
+    /** set the payload as a view of data kept alive by an owner*/
+    void setPayloadView(const std::byte* data,
+                        std::size_t size,
+                        const std::shared_ptr<const void>& owner);
+
   public:
     /** default constructor*/
     ActionMessage() noexcept {}
@@ -65,6 +79,9 @@ class ActionMessage {
     ActionMessage(ActionMessage&& act) noexcept;
     /** build an action message from a message*/
     explicit ActionMessage(std::unique_ptr<Message> message);
+    /** build an action message from a message
+    @details the data is moved out of the message, the strings are copied and left in place*/
+    explicit ActionMessage(Message&& message);
     /** construct from a string*/
     explicit ActionMessage(const std::string& bytes);
     /** construct from a data vector*/
@@ -102,46 +119,55 @@ class ActionMessage {
         dest_id = hand.fed_id;
         dest_handle = hand.handle;
     }
-    /** get the reference to the string data vector*/
-    const std::vector<std::string>& getStringData() const { return stringData; }
+    /** set the payload as a view of a shared immutable buffer
+    @details copies of the message share the buffer instead of copying the data.  Assigning,
+    appending to, or resizing the payload detaches it from the shared buffer first, writes to
+    individual elements of the payload require a call to detachPayload*/
+    void setSharedPayload(std::shared_ptr<const SmallBuffer> data);
+    /** check if the payload is a view of a shared buffer*/
+    bool hasSharedPayload() const noexcept
+    {
+        return sharedPayload && payload.data() == sharedPayload->data() &&
+            payload.size() == sharedPayload->size();
+    }
+    /** extract the payload as a shared immutable buffer
+    @details a payload that is not already shared is moved into a new buffer, the payload of the
+    message is empty afterward*/
+    std::shared_ptr<const SmallBuffer> extractSharedPayload();
+    /** make the payload an independent copy if it is shared so it can be modified or moved*/
+    void detachPayload();
+    /** move the payload into another buffer leaving the payload empty
+    @details the data is copied if it fits in the capacity the buffer already has so the memory of a
+    recycled buffer is reused, otherwise the payload memory is moved into the buffer*/
+    void movePayloadTo(SmallBuffer& data);
+    /** get the reference to the string data array*/
+    const CompactStringArray& getStringData() const { return stringData; }
     /** set the string name associated with a actionMessage*/
     void name(std::string_view name) { payload = name; }
     /** get the string name associated with an action Message*/
     std::string_view name() const { return payload.to_string(); }
     void clearStringData() { stringData.clear(); }
-    // most use cases for this involve short strings, or already have references that need to be
-    // copied so supporting move isn't  going to be that useful here, the long strings are going in
-    // the payload
-    void setStringData(std::string_view string1)
-    {
-        stringData.resize(1);
-        stringData[0] = string1;
-    }
+    // all the strings are packed into a single allocation so setting several strings at once is
+    // cheaper than setting them individually, the long strings are going in the payload
+    void setStringData(std::string_view string1) { stringData.assign({string1}); }
     void setStringData(std::string_view string1, std::string_view string2)
     {
-        stringData.resize(2);
-        stringData[0] = string1;
-        stringData[1] = string2;
+        stringData.assign({string1, string2});
     }
     void setStringData(std::string_view string1, std::string_view string2, std::string_view string3)
     {
-        stringData.resize(3);
-        stringData[0] = string1;
-        stringData[1] = string2;
-        stringData[2] = string3;
+        stringData.assign({string1, string2, string3});
     }
     void setStringData(std::string_view string1,
                        std::string_view string2,
                        std::string_view string3,
                        std::string_view string4)
     {
-        stringData.resize(4);
-        stringData[0] = string1;
-        stringData[1] = string2;
-        stringData[2] = string3;
-        stringData[3] = string4;
+        stringData.assign({string1, string2, string3, string4});
     }
-    const std::string& getString(int index) const;
+    /** get a view of one of the strings
+    @details the view is invalidated by any modification of the string data*/
+    std::string_view getString(int index) const;
 
     void setString(int index, std::string_view str);
     /** get the source GlobalHandle*/
@@ -182,6 +208,10 @@ class ActionMessage {
      */
     std::string packetize() const;
     void packetize(std::string& data) const;
+    /** add the packetized form of the message to the end of a buffer
+    @details multiple packets can be accumulated in a single buffer and sent together, the
+    receiver extracts them in order with depacketize*/
+    void appendPacket(std::string& data) const;
     /** packetize the multiMessage with a simple header and tail sequence using json serialization
      */
     std::string packetize_json() const;
@@ -191,13 +221,28 @@ class ActionMessage {
     std::vector<char> to_vector() const;
     /** generate a command from a raw data stream*/
     std::size_t fromByteArray(const std::byte* data, std::size_t buffer_size);
+    /** generate a command from a raw data stream whose memory is kept alive by an owner
+    @details a value payload of at least zeroCopyPayloadThreshold bytes is not copied, the message
+    shares the data with the owner so the data must not be modified while the owner exists*/
+    std::size_t fromByteArray(const std::byte* data,
+                              std::size_t buffer_size,
+                              const std::shared_ptr<const void>& owner);
     /** load a command from a packetized stream /ref packetize
     @return the number of bytes used
     */
     std::size_t depacketize(const void* data, std::size_t buffer_size);
+    /** load a command from a packetized stream whose memory is kept alive by an owner
+    @return the number of bytes used
+    */
+    std::size_t depacketize(const void* data,
+                            std::size_t buffer_size,
+                            const std::shared_ptr<const void>& owner);
     /** read a command from a string
     @return number of bytes read*/
     std::size_t from_string(std::string_view data);
+    /** read a command from a string whose memory is kept alive by an owner
+    @return number of bytes read*/
+    std::size_t from_string(std::string_view data, const std::shared_ptr<const void>& owner);
     /** read a command from a json string
     @return true if successful*/
     bool from_json_string(std::string_view data);
@@ -206,6 +251,8 @@ class ActionMessage {
 
     friend std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd);
     friend std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd);
+    friend std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd,
+                                                             std::unique_ptr<Message> msg);
 };
 
 inline bool operator<(const ActionMessage& cmd, const ActionMessage& cmd2)
@@ -223,6 +270,27 @@ std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd);
  */
 std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd);
 
+/** move all the information from the ActionMessage into an existing Message object
+@details this allows a previously allocated message to be reused, any existing contents of the
+message are replaced*/
+std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd,
+                                                  std::unique_ptr<Message> msg);
+
+/** packetize a set of messages into a single contiguous buffer
+@details the buffer is sized once for all the messages and the packets are placed back to back
+@param messages the messages to serialize
+@param[out] data the buffer to place the packets in, any existing contents are replaced*/
+void packetizeBatch(const std::vector<ActionMessage>& messages, std::string& data);
+
+/** extract all the complete packets from a buffer
+@param data the buffer containing the packets
+@param buffer_size the size of the data buffer
+@param[out] messages vector the extracted messages are added to
+@return the number of bytes used, any incomplete packet at the end is left unprocessed*/
+std::size_t depacketizeBatch(const void* data,
+                             std::size_t buffer_size,
+                             std::vector<ActionMessage>& messages);
+
 /** check if a command is a protocol command*/
 inline bool isProtocolCommand(const ActionMessage& command) noexcept
 {
@@ -365,4 +433,31 @@ std::string errorMessageString(const ActionMessage& command);
 /** set the flags for an iteration request*/
 void setIterationFlags(ActionMessage& command, IterationRequest iterate);
 
+/** remove timing requests that are superseded by a later request in a group of messages
+@details a CMD_TIME_REQUEST or CMD_EXEC_REQUEST is removed if the next message in the group with
+the same source and destination is the same type of request with the same flags, the relative
+order of the remaining messages is unchanged
+@param messages the group of messages to process
+@return the number of messages removed*/
+std::size_t coalesceTimingMessages(std::vector<ActionMessage>& messages);
+
+/** a single publication value carried in a CMD_PUB_BATCH command*/
+struct PublicationBatchEntry {
+    InterfaceHandle source_handle;  //!< the handle of the publication on the source federate
+    InterfaceHandle dest_handle;  //!< the handle of the input on the destination federate
+    std::shared_ptr<const SmallBuffer> data;  //!< the value
+};
+
+/** place a set of publication values in the payload of a CMD_PUB_BATCH command
+@details the payload is laid out in columns, the count of values followed by all the source
+handles, all the destination handles, all the value sizes and then the value data back to back.
+The integers are always stored little endian
+@param batch the command to fill in, any existing payload is replaced
+@param entries the values to store*/
+void packPublicationBatch(ActionMessage& batch, const std::vector<PublicationBatchEntry>& entries);
+
+/** extract the publication values from the payload of a CMD_PUB_BATCH command
+@return the values in the order they were packed, empty if the payload is malformed*/
+std::vector<PublicationBatchEntry> unpackPublicationBatch(const ActionMessage& batch);
+
 }  // namespace helics
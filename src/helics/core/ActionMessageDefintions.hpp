@@ -96,6 +96,7 @@ across different compilers*/
         cmd_time_barrier_clear = 44,  //!< clear a global time barrier
 
         cmd_pub = 52,  //!< publish a value
+        cmd_pub_batch = 53,  //!< publish a set of values to a single federate
         cmd_bye = 2000,  //!< message stating this is the last communication from a federate
         cmd_log = 55,  //!< log a message with the root broker
         cmd_remote_log = 2055,  //!< send a log message to a remote host
@@ -276,6 +277,7 @@ across different compilers*/
 #define CMD_DEST_FILTER_RESULT action_message_def::action_t::cmd_dest_filter_result
 
 #define CMD_PUB action_message_def::action_t::cmd_pub
+#define CMD_PUB_BATCH action_message_def::action_t::cmd_pub_batch
 #define CMD_LOG action_message_def::action_t::cmd_log
 #define CMD_REMOTE_LOG action_message_def::action_t::cmd_remote_log
 #define CMD_WARNING action_message_def::action_t::cmd_warning
@@ -393,6 +395,8 @@ across different compilers*/
 #define DISCONNECT 2523
 #define DISCONNECT_ERROR 2623
 #define DELAY_CONNECTION 3795
+#define COMPRESSED_FRAME 3801
+#define RETRANSMIT_TIMER 3807
 
 #define NAME_NOT_FOUND 2726
 #define RECONNECT_TRANSMITTER 1997
@@ -0,0 +1,244 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ActionQueue.hpp"
+
+#include <thread>
+#include <utility>
+
+namespace helics {
+
+struct alignas(64) LockFreeActionQueue::Cell {
+    std::atomic<std::size_t> sequence{0};
+    ActionMessage message;
+};
+
+LockFreeActionQueue::LockFreeActionQueue(std::size_t ringCapacity)
+{
+    std::size_t capacity{2};
+    while (capacity < ringCapacity) {
+        capacity <<= 1U;
+    }
+    cells = std::make_unique<Cell[]>(capacity);
+    mask = capacity - 1;
+    for (std::size_t ii = 0; ii < capacity; ++ii) {
+        cells[ii].sequence.store(ii, std::memory_order_relaxed);
+    }
+}
+
+LockFreeActionQueue::~LockFreeActionQueue() = default;
+
+template<class MessageType>
+bool LockFreeActionQueue::tryPushRing(MessageType&& message)
+{
+    auto position = enqueuePosition.load(std::memory_order_relaxed);
+    Cell* cell{nullptr};
+    while (true) {
+        cell = &cells[position & mask];
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto diff =
+            static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (diff == 0) {
+            if (enqueuePosition.compare_exchange_weak(position,
+                                                      position + 1,
+                                                      std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // the ring is full
+            return false;
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+    cell->message = std::forward<MessageType>(message);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+std::optional<ActionMessage> LockFreeActionQueue::tryPopRing()
+{
+    Cell& cell = cells[dequeuePosition & mask];
+    if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+        return std::nullopt;
+    }
+    std::optional<ActionMessage> result(std::move(cell.message));
+    cell.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+    ++dequeuePosition;
+    return result;
+}
+
+template<class MessageType>
+void LockFreeActionQueue::pushOverflow(MessageType&& message)
+{
+    const std::lock_guard<std::mutex> lock(laneLock);
+    overflow.push_back(std::forward<MessageType>(message));
+    overflowCount.store(overflow.size(), std::memory_order_release);
+}
+
+void LockFreeActionQueue::signalConsumer()
+{
+    // pairs with the fence in pop so either the consumer sees the new message or it is woken up
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumerWaiting.load(std::memory_order_relaxed)) {
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
+    }
+}
+
+void LockFreeActionQueue::push(const ActionMessage& message)
+{
+    // once anything has spilled into the overflow everything goes there until it is drained so
+    // the messages from any single producer stay in order
+    if (overflowCount.load(std::memory_order_acquire) != 0 || !tryPushRing(message)) {
+        pushOverflow(message);
+    }
+    signalConsumer();
+}
+
+void LockFreeActionQueue::push(ActionMessage&& message)
+{
+    if (overflowCount.load(std::memory_order_acquire) != 0 || !tryPushRing(std::move(message))) {
+        pushOverflow(std::move(message));
+    }
+    signalConsumer();
+}
+
+void LockFreeActionQueue::pushPriority(const ActionMessage& message)
+{
+    {
+        const std::lock_guard<std::mutex> lock(laneLock);
+        priority.push_back(message);
+        priorityCount.store(priority.size(), std::memory_order_release);
+    }
+    signalConsumer();
+}
+
+void LockFreeActionQueue::pushPriority(ActionMessage&& message)
+{
+    {
+        const std::lock_guard<std::mutex> lock(laneLock);
+        priority.push_back(std::move(message));
+        priorityCount.store(priority.size(), std::memory_order_release);
+    }
+    signalConsumer();
+}
+
+std::optional<ActionMessage> LockFreeActionQueue::try_pop()
+{
+    if (priorityCount.load(std::memory_order_acquire) != 0) {
+        const std::lock_guard<std::mutex> lock(laneLock);
+        if (!priority.empty()) {
+            std::optional<ActionMessage> result(std::move(priority.front()));
+            priority.pop_front();
+            priorityCount.store(priority.size(), std::memory_order_release);
+            return result;
+        }
+    }
+    if (consumerBuffer.empty()) {
+        auto result = tryPopRing();
+        if (result || overflowCount.load(std::memory_order_acquire) == 0) {
+            return result;
+        }
+        // a producer may have claimed the head slot without publishing it yet, that message
+        // was queued before anything in the overflow so wait for it to show up
+        while (enqueuePosition.load(std::memory_order_acquire) != dequeuePosition) {
+            result = tryPopRing();
+            if (result) {
+                return result;
+            }
+            std::this_thread::yield();
+        }
+        // the ring is drained so everything in the overflow comes next
+        const std::lock_guard<std::mutex> lock(laneLock);
+        consumerBuffer.swap(overflow);
+        overflowCount.store(0, std::memory_order_release);
+    }
+    if (consumerBuffer.empty()) {
+        return std::nullopt;
+    }
+    std::optional<ActionMessage> result(std::move(consumerBuffer.front()));
+    consumerBuffer.pop_front();
+    return result;
+}
+
+ActionMessage LockFreeActionQueue::pop()
+{
+    std::uint32_t spins{0};
+    while (true) {
+        auto result = try_pop();
+        if (result) {
+            if (spins > 0 && spinLimit < maxSpin) {
+                // spinning was successful so allow a bit more of it next time
+                spinLimit *= 2;
+            }
+            return std::move(*result);
+        }
+        if (spins < spinLimit) {
+            ++spins;
+            if (spins > minSpin) {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+        const auto ticket = signal.load(std::memory_order_acquire);
+        consumerWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        result = try_pop();
+        if (!result) {
+            signal.wait(ticket, std::memory_order_acquire);
+            result = try_pop();
+        }
+        consumerWaiting.store(false, std::memory_order_relaxed);
+        if (spinLimit > minSpin) {
+            spinLimit /= 2;
+        }
+        if (result) {
+            return std::move(*result);
+        }
+        spins = 0;
+    }
+}
+
+bool LockFreeActionQueue::empty() const
+{
+    if (priorityCount.load(std::memory_order_acquire) != 0 || !consumerBuffer.empty() ||
+        overflowCount.load(std::memory_order_acquire) != 0) {
+        return false;
+    }
+    return cells[dequeuePosition & mask].sequence.load(std::memory_order_acquire) !=
+        dequeuePosition + 1;
+}
+
+ActionQueue::ActionQueue() = default;
+
+ActionQueue::~ActionQueue() = default;
+
+void ActionQueue::setQueueType(QueueType type)
+{
+    if (type == queueType) {
+        return;
+    }
+    if (type == QueueType::LOCK_FREE) {
+        if (!lockFreeQueue) {
+            lockFreeQueue = std::make_unique<LockFreeActionQueue>();
+        }
+        auto message = blockingQueue.try_pop();
+        while (message) {
+            lockFreeQueue->push(std::move(*message));
+            message = blockingQueue.try_pop();
+        }
+    } else {
+        auto message = lockFreeQueue->try_pop();
+        while (message) {
+            blockingQueue.emplace(std::move(*message));
+            message = lockFreeQueue->try_pop();
+        }
+    }
+    queueType = type;
+}
+
+}  // namespace helics
@@ -0,0 +1,166 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+#include "gmlc/containers/BlockingPriorityQueue.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace helics {
+
+/** multi-producer single consumer queue of ActionMessages
+@details the main lane is a bounded lock free ring, if the ring fills up messages spill into a
+mutex protected overflow list which preserves the ordering of messages from each producer.
+Priority messages go through a separate lane which is always checked first.  The consumer spins
+briefly when the queue is empty before parking until a producer signals new data.
+Only a single thread may call pop or try_pop at any given time.
+*/
+class LockFreeActionQueue {
+  public:
+    /** construct the queue with a capacity of the ring, the capacity is rounded up to a power of
+     * 2*/
+    explicit LockFreeActionQueue(std::size_t ringCapacity = defaultCapacity);
+    ~LockFreeActionQueue();
+    LockFreeActionQueue(const LockFreeActionQueue&) = delete;
+    LockFreeActionQueue& operator=(const LockFreeActionQueue&) = delete;
+
+    /** add a message to the queue*/
+    void push(const ActionMessage& message);
+    /** add a message to the queue*/
+    void push(ActionMessage&& message);
+    /** add a message to the priority lane*/
+    void pushPriority(const ActionMessage& message);
+    /** add a message to the priority lane*/
+    void pushPriority(ActionMessage&& message);
+    /** get a message from the queue if one is available*/
+    std::optional<ActionMessage> try_pop();
+    /** get a message from the queue blocking until one is available*/
+    ActionMessage pop();
+    /** check if the queue is empty, only reliable from the consumer thread*/
+    bool empty() const;
+    /** get the capacity of the lock free ring*/
+    std::size_t capacity() const noexcept { return mask + 1; }
+
+    static constexpr std::size_t defaultCapacity{1024};
+
+  private:
+    struct Cell;
+    template<class MessageType>
+    bool tryPushRing(MessageType&& message);
+    std::optional<ActionMessage> tryPopRing();
+    template<class MessageType>
+    void pushOverflow(MessageType&& message);
+    /** wake up the consumer if it is parked*/
+    void signalConsumer();
+
+    std::unique_ptr<Cell[]> cells;  //!< the storage for the ring
+    std::size_t mask{0};  //!< the mask for the ring index
+    alignas(64) std::atomic<std::size_t> enqueuePosition{0};  //!< position for the producers
+    alignas(64) std::size_t dequeuePosition{0};  //!< position for the consumer
+    /// the number of messages in the overflow list
+    alignas(64) std::atomic<std::size_t> overflowCount{0};
+    /// the number of messages in the priority lane
+    std::atomic<std::size_t> priorityCount{0};
+    /// counter incremented on each push to allow the consumer to park
+    std::atomic<std::uint32_t> signal{0};
+    std::atomic<bool> consumerWaiting{false};  //!< flag indicating the consumer is parked
+    /// the number of spin iterations before the consumer parks, adjusted based on recent activity
+    std::uint32_t spinLimit{minSpin};
+    static constexpr std::uint32_t minSpin{16};
+    static constexpr std::uint32_t maxSpin{1024};
+    std::mutex laneLock;  //!< lock protecting the overflow and priority lanes
+    std::deque<ActionMessage> overflow;  //!< storage for messages when the ring is full
+    std::deque<ActionMessage> priority;  //!< storage for priority messages
+    /// messages moved from the overflow that must be delivered before anything else in the ring
+    std::deque<ActionMessage> consumerBuffer;
+};
+
+/** the queue used for routing all actions through a broker or core
+@details the type of the underlying queue can be selected while configuring but should not be
+changed once the processing thread is running*/
+class ActionQueue {
+  public:
+    enum class QueueType {
+        BLOCKING = 0,  //!< mutex based blocking priority queue
+        LOCK_FREE = 1  //!< lock free multi-producer single consumer ring
+    };
+    ActionQueue();
+    ~ActionQueue();
+    /** set the type of queue to use, any messages already in the queue are transferred*/
+    void setQueueType(QueueType type);
+    /** get the type of queue in use*/
+    QueueType getQueueType() const noexcept { return queueType; }
+
+    /** add a message to the queue*/
+    void push(const ActionMessage& message)
+    {
+        if (queueType == QueueType::LOCK_FREE) {
+            lockFreeQueue->push(message);
+        } else {
+            blockingQueue.push(message);
+        }
+    }
+    /** add a message to the queue*/
+    void push(ActionMessage&& message)
+    {
+        if (queueType == QueueType::LOCK_FREE) {
+            lockFreeQueue->push(std::move(message));
+        } else {
+            blockingQueue.emplace(std::move(message));
+        }
+    }
+    /** add a message to the queue that will be processed before normal messages*/
+    void pushPriority(const ActionMessage& message)
+    {
+        if (queueType == QueueType::LOCK_FREE) {
+            lockFreeQueue->pushPriority(message);
+        } else {
+            blockingQueue.pushPriority(message);
+        }
+    }
+    /** add a message to the queue that will be processed before normal messages*/
+    void pushPriority(ActionMessage&& message)
+    {
+        if (queueType == QueueType::LOCK_FREE) {
+            lockFreeQueue->pushPriority(std::move(message));
+        } else {
+            blockingQueue.emplacePriority(std::move(message));
+        }
+    }
+    /** get a message from the queue if one is available*/
+    std::optional<ActionMessage> try_pop()
+    {
+        return (queueType == QueueType::LOCK_FREE) ? lockFreeQueue->try_pop() :
+                                                     blockingQueue.try_pop();
+    }
+    /** get a message from the queue blocking until one is available*/
+    ActionMessage pop()
+    {
+        return (queueType == QueueType::LOCK_FREE) ? lockFreeQueue->pop() : blockingQueue.pop();
+    }
+    /** check if the queue is empty*/
+    bool empty() const
+    {
+        return (queueType == QueueType::LOCK_FREE) ? lockFreeQueue->empty() :
+                                                     blockingQueue.empty();
+    }
+
+  private:
+    QueueType queueType{QueueType::BLOCKING};
+    gmlc::containers::BlockingPriorityQueue<ActionMessage> blockingQueue;
+    std::unique_ptr<LockFreeActionQueue> lockFreeQueue;
+};
+
+}  // namespace helics
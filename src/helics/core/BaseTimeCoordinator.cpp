@@ -142,14 +142,13 @@ void BaseTimeCoordinator::generateDebuggingTimeInfo(nlohmann::json& base) const
 
 nlohmann::json BaseTimeCoordinator::grantTimeoutCheck(const ActionMessage& cmd)
 {
-    for (auto& dep : dependencies) {
-        if (dep.fedID == cmd.source_id) {
-            dep.timeoutCount = cmd.counter;
-            if (cmd.counter == 6) {
-                nlohmann::json base;
-                generateDebuggingTimeInfo(base);
-                return base;
-            }
+    auto* dep = dependencies.getDependencyInfo(cmd.source_id);
+    if (dep != nullptr) {
+        dep->timeoutCount = cmd.counter;
+        if (cmd.counter == 6) {
+            nlohmann::json base;
+            generateDebuggingTimeInfo(base);
+            return base;
         }
     }
     return nlohmann::json::object();
@@ -98,6 +98,8 @@ class BaseTimeCoordinator {
     bool isDependency(GlobalFederateId ofed) const;
     /** check whether a timeCoordinator has any dependencies or dependents*/
     bool empty() const { return dependencies.empty(); }
+    /** get the number of federates or brokers the coordinator is connected with*/
+    std::size_t size() const { return dependencies.size(); }
 
   protected:
     /** generate a timeRequest message based on the dependency info data*/
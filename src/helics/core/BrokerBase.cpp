@@ -201,6 +201,19 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
     hApp->add_flag("--json",
                    useJsonSerialization,
                    "use the JSON serialization mode for communications");
+    hApp->add_option("--queue",
+                     queueType,
+                     "specify the type of queue to use for routing actions in the broker/core")
+        ->transform(CLI::CheckedTransformer({{"blocking", "0"},
+                                             {"default", "0"},
+                                             {"lockfree", "1"},
+                                             {"lock_free", "1"}},
+                                            CLI::ignore_case));
+    hApp->add_option(
+            "--queue_batch_size",
+            queueBatchSize,
+            "the maximum number of waiting messages to process as a group, superseded timing messages within a group are dropped")
+        ->check(CLI::PositiveNumber);
 
     // add the profiling setup command
     auto* popt =
@@ -555,6 +568,7 @@ void BrokerBase::configureBase()
     });
     mLogManager->initializeLogging(identifier);
     maxLogLevel.store(mLogManager->getMaxLevel());
+    actionQueue.setQueueType(queueType);
     mainLoopIsRunning.store(true);
     queueProcessingThread = std::thread(&BrokerBase::queueProcessingLoop, this);
     brokerState = BrokerState::CONFIGURED;
@@ -604,6 +618,13 @@ void BrokerBase::saveProfilingData(std::string_view message)
 
 void BrokerBase::writeProfilingData()
 {
+    auto eventLoop = commsQuery("event_loop");
+    if (!eventLoop.empty()) {
+        saveProfilingData(fmt::format("<PROFILING>{}[{}](comms)EVENT LOOP{}</PROFILING>",
+                                      identifier,
+                                      global_id.load().baseValue(),
+                                      eventLoop));
+    }
     if (prBuff) {
         try {
             prBuff->writeFile();
@@ -787,10 +808,10 @@ void BrokerBase::addActionMessage(const ActionMessage& message)
 void BrokerBase::addActionMessage(ActionMessage&& message)
 {
     if (isPriorityCommand(message)) {
-        actionQueue.emplacePriority(std::move(message));
+        actionQueue.pushPriority(std::move(message));
     } else {
         // just route to the general queue;
-        actionQueue.emplace(std::move(message));
+        actionQueue.push(std::move(message));
     }
 }
 
@@ -799,10 +820,10 @@ void BrokerBase::addActionMessage(ActionMessage&& message) const
     // the queue is thread safe so can be run in a const situation without possibility of issues
     auto& lQueue = const_cast<decltype(actionQueue)&>(actionQueue);
     if (isPriorityCommand(message)) {
-        lQueue.emplacePriority(std::move(message));
+        lQueue.pushPriority(std::move(message));
     } else {
         // just route to the general queue;
-        lQueue.emplace(std::move(message));
+        lQueue.push(std::move(message));
     }
 }
 
@@ -930,153 +951,184 @@ void BrokerBase::queueProcessingLoop()
         mainLoopIsRunning.store(false);
         return;
     }
+    std::vector<ActionMessage> batch;
+    auto logUnprocessed = [&, this](std::size_t start, std::string_view prefix) {
+        for (auto index = start; index < batch.size(); ++index) {
+            if (!isDisconnectCommand(batch[index])) {
+                LOG_TRACE(global_broker_id_local,
+                          identifier,
+                          std::string(prefix) + prettyPrintString(batch[index]));
+            }
+        }
+    };
     while (true) {
-        auto command = actionQueue.pop();
-        ++messageCounter;
-        if (dumplog) {
-            dumpMessages.push_back(command);
+        batch.clear();
+        batch.push_back(actionQueue.pop());
+        // take anything else that is already waiting so it can be processed as a group
+        while (batch.size() < queueBatchSize) {
+            auto next = actionQueue.try_pop();
+            if (!next) {
+                break;
+            }
+            batch.push_back(std::move(*next));
         }
-        if (command.action() == CMD_IGNORE) {
-            continue;
+        messageCounter += batch.size();
+        if (dumplog) {
+            dumpMessages.insert(dumpMessages.end(), batch.begin(), batch.end());
         }
-        auto ret = commandProcessor(command);
-        if (ret == CMD_IGNORE) {
-            ++messagesSinceLastTick;
-            continue;
+        if (batch.size() > 1) {
+            coalesceTimingMessages(batch);
         }
-        switch (ret) {
-            case CMD_TICK:
-                if (checkActionFlag(command, error_flag)) {
+        for (std::size_t index = 0; index < batch.size(); ++index) {
+            auto& command = batch[index];
+            if (command.action() == CMD_IGNORE) {
+                continue;
+            }
+            auto ret = commandProcessor(command);
+            if (ret == CMD_IGNORE) {
+                ++messagesSinceLastTick;
+                continue;
+            }
+            switch (ret) {
+                case CMD_TICK:
+                    if (checkActionFlag(command, error_flag)) {
 #ifndef HELICS_DISABLE_ASIO
-                    contextLoop = nullptr;
-                    contextLoop = serv->startContextLoop();
+                        contextLoop = nullptr;
+                        contextLoop = serv->startContextLoop();
 #endif
-                }
-                // deal with error state timeout
-                if (brokerState.load() == BrokerState::CONNECTED_ERROR) {
-                    auto ctime = std::chrono::steady_clock::now();
-                    auto timeDiff = ctime - errorTimeStart;
-                    if (timeDiff >= errorDelay.to_ms()) {
-                        command.setAction(CMD_USER_DISCONNECT);
-                        addActionMessage(command);
-                    } else {
-#ifndef HELICS_DISABLE_ASIO
-                        if (!disable_timer) {
-                            ticktimer.expires_at(errorTimeStart + errorDelay.to_ns());
-                            active = std::make_pair(true, true);
-                            ticktimer.async_wait(timerCallback);
+                    }
+                    // deal with error state timeout
+                    if (brokerState.load() == BrokerState::CONNECTED_ERROR) {
+                        auto ctime = std::chrono::steady_clock::now();
+                        auto timeDiff = ctime - errorTimeStart;
+                        if (timeDiff >= errorDelay.to_ms()) {
+                            command.setAction(CMD_USER_DISCONNECT);
+                            addActionMessage(command);
                         } else {
+#ifndef HELICS_DISABLE_ASIO
+                            if (!disable_timer) {
+                                ticktimer.expires_at(errorTimeStart + errorDelay.to_ns());
+                                active = std::make_pair(true, true);
+                                ticktimer.async_wait(timerCallback);
+                            } else {
+                                command.setAction(CMD_ERROR_CHECK);
+                                addActionMessage(command);
+                            }
+#else
                             command.setAction(CMD_ERROR_CHECK);
                             addActionMessage(command);
-                        }
-#else
-                        command.setAction(CMD_ERROR_CHECK);
-                        addActionMessage(command);
 #endif
+                        }
+                        break;
                     }
-                    break;
-                }
 #ifndef DISABLE_TICK
-                if (messagesSinceLastTick == 0) {
-                    command.messageID =
-                        forwardingReasons | static_cast<uint32_t>(TickForwardingReasons::NO_COMMS);
-                    processCommand(std::move(command));
-                } else if (forwardTick) {
-                    command.messageID = forwardingReasons;
-                }
+                    if (messagesSinceLastTick == 0) {
+                        command.messageID = forwardingReasons |
+                            static_cast<uint32_t>(TickForwardingReasons::NO_COMMS);
+                        processCommand(std::move(command));
+                    } else if (forwardTick) {
+                        command.messageID = forwardingReasons;
+                    }
 #endif
-                messagesSinceLastTick = 0;
+                    messagesSinceLastTick = 0;
 // reschedule the timer
 #ifndef HELICS_DISABLE_ASIO
-                {
-                    auto currTime = std::chrono::steady_clock::now();
-                    if (maxCoSimDuration > timeZero) {
-                        if ((currTime - timeStart) > maxCoSimDuration.to_ms()) {
-                            ActionMessage dDisable(CMD_TIMEOUT_DISCONNECT);
-                            dDisable.source_id = global_broker_id_local;
-                            dDisable.dest_id = global_broker_id_local;
-                            addActionMessage(dDisable);
-                            break;
+                    {
+                        auto currTime = std::chrono::steady_clock::now();
+                        if (maxCoSimDuration > timeZero) {
+                            if ((currTime - timeStart) > maxCoSimDuration.to_ms()) {
+                                ActionMessage dDisable(CMD_TIMEOUT_DISCONNECT);
+                                dDisable.source_id = global_broker_id_local;
+                                dDisable.dest_id = global_broker_id_local;
+                                addActionMessage(dDisable);
+                                break;
+                            }
+                        }
+                        if (tickTimer > timeZero && !disable_timer) {
+                            ticktimer.expires_at(currTime + tickTimer.to_ns());
+                            active = std::make_pair(true, true);
+                            ticktimer.async_wait(timerCallback);
                         }
                     }
-                    if (tickTimer > timeZero && !disable_timer) {
-                        ticktimer.expires_at(currTime + tickTimer.to_ns());
-                        active = std::make_pair(true, true);
-                        ticktimer.async_wait(timerCallback);
-                    }
-                }
 #endif
-                break;
-            case CMD_ERROR_CHECK:
-                if (brokerState.load() == BrokerState::CONNECTED_ERROR) {
-                    auto ctime = std::chrono::steady_clock::now();
-                    auto timeDiff = ctime - errorTimeStart;
-                    if (timeDiff > errorDelay.to_ms()) {
-                        command.setAction(CMD_USER_DISCONNECT);
-                        addActionMessage(command);
-                    } else {
+                    break;
+                case CMD_ERROR_CHECK:
+                    if (brokerState.load() == BrokerState::CONNECTED_ERROR) {
+                        auto ctime = std::chrono::steady_clock::now();
+                        auto timeDiff = ctime - errorTimeStart;
+                        if (timeDiff > errorDelay.to_ms()) {
+                            command.setAction(CMD_USER_DISCONNECT);
+                            addActionMessage(command);
+                        } else {
 #ifndef HELICS_DISABLE_ASIO
-                        if (tickTimer > timeDiff * 2 || disable_timer) {
+                            if (tickTimer > timeDiff * 2 || disable_timer) {
+                                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                                addActionMessage(command);
+                            }
+#else
                             std::this_thread::sleep_for(std::chrono::milliseconds(200));
                             addActionMessage(command);
-                        }
-#else
-                        std::this_thread::sleep_for(std::chrono::milliseconds(200));
-                        addActionMessage(command);
 #endif
+                        }
                     }
-                }
-                break;
-            case CMD_PING:
-                // ping is processed normally but doesn't count as an actual message for timeout
-                // purposes unless it comes from the parent
-                if (command.source_id != parent_broker_id) {
-                    ++messagesSinceLastTick;
-                }
-                processCommand(std::move(command));
-                break;
-            case CMD_BASE_CONFIGURE:
-                baseConfigure(command);
-                break;
-            case CMD_IGNORE:
-            default:
-                break;
-            case CMD_TERMINATE_IMMEDIATELY:
-                timerStop();
-                mainLoopIsRunning.store(false);
-                logDump();
-                {
+                    break;
+                case CMD_PING:
+                    // ping is processed normally but doesn't count as an actual message for
+                    // timeout purposes unless it comes from the parent
+                    if (command.source_id != parent_broker_id) {
+                        ++messagesSinceLastTick;
+                    }
+                    processCommand(std::move(command));
+                    break;
+                case CMD_BASE_CONFIGURE:
+                    baseConfigure(command);
+                    break;
+                case CMD_IGNORE:
+                default:
+                    break;
+                case CMD_TERMINATE_IMMEDIATELY:
+                    timerStop();
+                    mainLoopIsRunning.store(false);
+                    logDump();
+                    logUnprocessed(index + 1, "TI unprocessed command ");
+                    {
+                        auto tcmd = actionQueue.try_pop();
+                        while (tcmd) {
+                            if (!isDisconnectCommand(*tcmd)) {
+                                LOG_TRACE(global_broker_id_local,
+                                          identifier,
+                                          std::string("TI unprocessed command ") +
+                                              prettyPrintString(*tcmd));
+                            }
+                            tcmd = actionQueue.try_pop();
+                        }
+                    }
+                    return;  // immediate return
+                case CMD_STOP:
+                    timerStop();
+                    if (!haltOperations) {
+                        processCommand(std::move(command));
+                        mainLoopIsRunning.store(false);
+                        logDump();
+                        processDisconnect();
+                    }
+                    logUnprocessed(index + 1, "STOPPED unprocessed command ");
                     auto tcmd = actionQueue.try_pop();
                     while (tcmd) {
                         if (!isDisconnectCommand(*tcmd)) {
                             LOG_TRACE(global_broker_id_local,
                                       identifier,
-                                      std::string("TI unprocessed command ") +
+                                      std::string("STOPPED unprocessed command ") +
                                           prettyPrintString(*tcmd));
                         }
                         tcmd = actionQueue.try_pop();
                     }
-                }
-                return;  // immediate return
-            case CMD_STOP:
-                timerStop();
-                if (!haltOperations) {
-                    processCommand(std::move(command));
-                    mainLoopIsRunning.store(false);
-                    logDump();
-                    processDisconnect();
-                }
-                auto tcmd = actionQueue.try_pop();
-                while (tcmd) {
-                    if (!isDisconnectCommand(*tcmd)) {
-                        LOG_TRACE(global_broker_id_local,
-                                  identifier,
-                                  std::string("STOPPED unprocessed command ") +
-                                      prettyPrintString(*tcmd));
-                    }
-                    tcmd = actionQueue.try_pop();
-                }
-                return;
+                    return;
+            }
+        }
+        if (deferredOperationsPending && actionQueue.empty()) {
+            deferredOperationsPending = false;
+            processDeferredOperations();
         }
     }
 }
@@ -12,8 +12,8 @@ and some common methods used cores and brokers
 */
 
 #include "ActionMessage.hpp"
+#include "ActionQueue.hpp"
 #include "FederateIdExtra.hpp"
-#include "gmlc/containers/BlockingPriorityQueue.hpp"
 
 #include <atomic>
 #include <limits>
@@ -108,12 +108,16 @@ class BrokerBase {
     bool queueDisabled{false};
     /// turn off the timer/timeout subsystem completely
     bool disable_timer{false};
+    /// the type of queue to use for the primary routing queue
+    ActionQueue::QueueType queueType{ActionQueue::QueueType::BLOCKING};
+    /// the maximum number of queued messages to take and process as a group
+    std::size_t queueBatchSize{1};
     /// counter for the total number of message processed
     std::atomic<std::size_t> messageCounter{0};
 
   protected:
     std::unique_ptr<BaseTimeCoordinator> timeCoord;  //!< object managing the time control
-    gmlc::containers::BlockingPriorityQueue<ActionMessage> actionQueue;  //!< primary routing queue
+    ActionQueue actionQueue;  //!< primary routing queue
     std::shared_ptr<LogManager> mLogManager;  //!< object to handle the logging considerations
     /** enumeration of the possible core states*/
     enum class BrokerState : int16_t {
@@ -143,6 +147,8 @@ class BrokerBase {
     bool hasTimeDependency{false};  //!< set to true if the broker has Time dependencies
     /// flag indicating that the broker has entered execution mode
     bool enteredExecutionMode{false};
+    /// flag indicating there are operations waiting until the queue is empty
+    bool deferredOperationsPending{false};
     bool waitingForBrokerPingReply{false};  //!< flag indicating we are waiting for a ping reply
     bool hasFilters{false};  //!< flag indicating filters come through the broker
 
@@ -276,6 +282,10 @@ class BrokerBase {
     @param command the command to process
     */
     virtual void processPriorityCommand(ActionMessage&& command) = 0;
+    /** process any operations which were deferred until no more messages are waiting
+    @details called from the processing loop when deferredOperationsPending is set and the queue is
+    empty*/
+    virtual void processDeferredOperations() {}
 
     /** send a Message to the logging system
     @return true if the message was actually logged
@@ -288,7 +298,9 @@ class BrokerBase {
                       bool fromRemote = false) const;
     /** save a profiling message*/
     void saveProfilingData(std::string_view message);
-    /** write profiler data to file*/
+    /** write profiler data to file
+    @details the dispatch statistics of the comms event loop are added to the profiling data if
+    the comms use one*/
     void writeProfilingData();
     /** generate a new random id*/
     void generateNewIdentifier();
@@ -304,6 +316,9 @@ class BrokerBase {
     bool getFlagValue(int32_t flag) const;
     /** virtual function to return the current simulation time*/
     virtual double getSimulationTime() const { return mInvalidSimulationTime; }
+    /** query the communication system used by the broker
+    @return a json string with the answer or an empty string if the query is not recognized*/
+    virtual std::string commsQuery(std::string_view /*request*/) const { return {}; }
     /** process some common commands that can be processed by the broker base */
     std::pair<bool, std::vector<std::string_view>> processBaseCommands(ActionMessage& command);
     /** add some base information to a json structure */
@@ -220,7 +220,13 @@ bool CommonCore::connect()
                 if (observer) {
                     setActionFlag(reg, observer_flag);
                 }
-                transmit(parent_route_id, reg);
+                if (warmStartId.isValid()) {
+                    // the core loop holds the registration to send it with the first federate
+                    reg.dest_id = warmStartId;
+                    addActionMessage(std::move(reg));
+                } else {
+                    transmit(parent_route_id, reg);
+                }
                 setBrokerState(BrokerState::CONNECTED);
                 if (!disconnection.activate()) {
                     if (!disconnection.isActive()) {
@@ -543,6 +549,7 @@ void CommonCore::finalize(LocalFederateId federateID)
         throw(InvalidIdentifier("federateID not valid finalize"));
     }
 
+    sendPublicationBatches(fed);
     auto cbrokerState = getBrokerState();
     switch (cbrokerState) {
         case BrokerState::TERMINATED:
@@ -692,7 +699,7 @@ bool CommonCore::enterInitializingMode(LocalFederateId federateID, IterationRequ
             fed->initIterating.store(true);
             initIterations.store(true);
         }
-
+        sendPublicationBatches(fed);
         addActionMessage(init);
 
         if (fed->isCallbackFederate()) {
@@ -753,6 +760,7 @@ iteration_time CommonCore::enterExecutingMode(LocalFederateId federateID, Iterat
             break;
     }
 
+    sendPublicationBatches(fed);
     ActionMessage exec(CMD_EXEC_REQUEST);
     exec.source_id = fed->global_id.load();
     exec.dest_id = fed->global_id.load();
@@ -765,7 +773,7 @@ iteration_time CommonCore::enterExecutingMode(LocalFederateId federateID, Iterat
 
 LocalFederateId CommonCore::registerFederate(std::string_view name, const CoreFederateInfo& info)
 {
-    if (!waitCoreRegistration()) {
+    if (!waitCoreRegistration(true)) {
         if (getBrokerState() == BrokerState::ERRORED) {
             if (!lastErrorString.empty()) {
                 throw(RegistrationFailure(lastErrorString));
@@ -961,6 +969,7 @@ Time CommonCore::timeRequest(LocalFederateId federateID, Time next)
     }
     switch (fed->getState()) {
         case FederateStates::EXECUTING: {
+            sendPublicationBatches(fed);
             // generate the request through the core
             ActionMessage treq(CMD_TIME_REQUEST);
             treq.source_id = fed->global_id.load();
@@ -1041,6 +1050,7 @@ iteration_time CommonCore::requestTimeIterative(LocalFederateId federateID,
         default:
             break;
     }
+    sendPublicationBatches(fed);
     // generate the request through the core
     ActionMessage treq(CMD_TIME_REQUEST);
     treq.source_id = fed->global_id.load();
@@ -1821,41 +1831,34 @@ void CommonCore::setValue(InterfaceHandle handle, const char* data, uint64_t len
         if (subs.empty()) {
             return;
         }
-        if (subs.size() == 1) {
-            ActionMessage pub(CMD_PUB);
-            pub.source_id = handleInfo->getFederateId();
-            pub.source_handle = handle;
-            pub.setDestination(subs[0]);
-            pub.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-            pub.payload.assign(data, len);
-            pub.actionTime = fed->nextAllowedSendTime();
-            actionQueue.push(std::move(pub));
+        // all the subscribers share a single immutable copy of the data
+        auto value = std::make_shared<const SmallBuffer>(data, len);
+        std::vector<ActionMessage> readyBatches;
+        if (fed->addGroupedValue(handle, subs, value, readyBatches)) {
+            for (auto& batch : readyBatches) {
+                actionQueue.push(std::move(batch));
+            }
             return;
         }
-        ActionMessage package(CMD_MULTI_MESSAGE);
-        package.source_id = handleInfo->getFederateId();
-        package.source_handle = handle;
-
         ActionMessage pub(CMD_PUB);
         pub.source_id = handleInfo->getFederateId();
         pub.source_handle = handle;
         pub.counter = static_cast<uint16_t>(fed->getCurrentIteration());
-        pub.payload.assign(data, len);
+        pub.setSharedPayload(std::move(value));
         pub.actionTime = fed->nextAllowedSendTime();
-
-        for (auto& target : subs) {
-            pub.setDestination(target);
-            auto res = appendMessage(package, pub);
-            if (res < 0)  // deal with max package size if there are a lot of subscribers
-            {
-                actionQueue.push(std::move(package));
-                package = ActionMessage(CMD_MULTI_MESSAGE);
-                package.source_id = handleInfo->getFederateId();
-                package.source_handle = handle;
-                appendMessage(package, pub);
-            }
+        for (std::size_t ii = 0; ii + 1 < subs.size(); ++ii) {
+            pub.setDestination(subs[ii]);
+            actionQueue.push(pub);
         }
-        actionQueue.push(std::move(package));
+        pub.setDestination(subs.back());
+        actionQueue.push(std::move(pub));
+    }
+}
+
+void CommonCore::sendPublicationBatches(FederateState* fed)
+{
+    for (auto& batch : fed->takePublicationBatches()) {
+        actionQueue.push(std::move(batch));
     }
 }
 
@@ -2353,7 +2356,9 @@ void CommonCore::sendMessage(InterfaceHandle sourceHandle, std::unique_ptr<Messa
         throw(InvalidFunctionCall(
             "Endpoint is receive only; no messages can be sent through this endpoint"));
     }
-    ActionMessage mess(std::move(message));
+    ActionMessage mess(std::move(*message));
+    // the message object keeps its string storage so it can be reused for an incoming message
+    messagePool.release(std::move(message));
 
     mess.setString(sourceStringLoc, hndl->key);
     mess.source_id = hndl->getFederateId();
@@ -2407,7 +2412,8 @@ void CommonCore::deliverMessage(ActionMessage& message)
                                                InterfaceType::ENDPOINT) :
                 loopHandles.findHandle(message.getDest());
             if (localP == nullptr) {
-                auto kfnd = knownExternalEndpoints.find(message.getString(targetStringLoc));
+                auto kfnd =
+                    knownExternalEndpoints.find(std::string(message.getString(targetStringLoc)));
                 if (kfnd != knownExternalEndpoints.end()) {  // destination is known
                     transmit(kfnd->second, message);
                 } else {
@@ -3210,6 +3216,10 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
               fmt::format("|| priority_cmd:{} from {}",
                           prettyPrintString(command),
                           command.source_id.baseValue()));
+    if (command.action() != CMD_REG_FED && command.action() != CMD_REG_BROKER) {
+        // anything else sent to the broker has to follow the registration of the core
+        sendHeldRegistration();
+    }
     switch (command.action()) {
         case CMD_PING_PRIORITY:
             if (command.dest_id == global_broker_id_local) {
@@ -3232,6 +3242,22 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
                 // forward on to Broker
                 command.source_id = global_broker_id_local;
                 transmit(parent_route_id, std::move(command));
+            } else if (warmStartRegistration) {
+                // sent with the id from the previous run and the core name so the broker can
+                // find this core if it assigned a different id
+                command.source_id = warmStartId;
+                command.dest_id = warmStartId;
+                command.setString(0, identifier);
+                if (heldRegistration.action() == CMD_REG_BROKER) {
+                    ActionMessage package(CMD_MULTI_MESSAGE);
+                    package.source_id = warmStartId;
+                    appendMessage(package, heldRegistration);
+                    appendMessage(package, command);
+                    heldRegistration = ActionMessage(CMD_IGNORE);
+                    transmit(parent_route_id, std::move(package));
+                } else {
+                    transmit(parent_route_id, std::move(command));
+                }
             } else {
                 // this will get processed when this core is assigned a global hid
                 delayTransmitQueue.push(std::move(command));
@@ -3247,6 +3273,12 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
             addActionMessage(resend);
         } break;
         case CMD_REG_BROKER:
+            if (command.name() == identifier && warmStartId.isValid() && !warmStartRegistration) {
+                // queued by connect to be sent with the first federate registration
+                warmStartRegistration = true;
+                heldRegistration = std::move(command);
+                break;
+            }
             // These really shouldn't happen here probably means something went wrong in setup but
             // we can handle it forward the connection request to the higher level
             if (command.name() == identifier) {
@@ -3396,14 +3428,48 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
 
 void CommonCore::transmitDelayedMessages()
 {
+    // federate registrations waiting on the broker are sent together in as few messages as possible
+    std::vector<ActionMessage> registrations;
+    auto sendRegistrations = [this, &registrations]() {
+        if (registrations.size() == 1) {
+            transmit(parent_route_id, std::move(registrations.front()));
+        } else if (!registrations.empty()) {
+            ActionMessage package(CMD_MULTI_MESSAGE);
+            package.source_id = global_broker_id_local;
+            for (const auto& registration : registrations) {
+                if (appendMessage(package, registration) < 0) {
+                    transmit(parent_route_id, std::move(package));
+                    package = ActionMessage(CMD_MULTI_MESSAGE);
+                    package.source_id = global_broker_id_local;
+                    appendMessage(package, registration);
+                }
+            }
+            transmit(parent_route_id, std::move(package));
+        }
+        registrations.clear();
+    };
     auto msg = delayTransmitQueue.pop();
     while (msg) {
         if (msg->source_id == parent_broker_id || msg->source_id == gDirectCoreId) {
             msg->source_id = global_broker_id_local;
         }
-        routeMessage(*msg);
+        if (msg->action() == CMD_REG_FED) {
+            registrations.push_back(std::move(*msg));
+        } else {
+            sendRegistrations();
+            routeMessage(*msg);
+        }
         msg = delayTransmitQueue.pop();
     }
+    sendRegistrations();
+}
+
+void CommonCore::sendHeldRegistration()
+{
+    if (heldRegistration.action() == CMD_REG_BROKER) {
+        transmit(parent_route_id, std::move(heldRegistration));
+        heldRegistration = ActionMessage(CMD_IGNORE);
+    }
 }
 
 void CommonCore::errorRespondDelayedMessages(std::string_view estring)
@@ -3478,6 +3544,8 @@ void CommonCore::processCommand(ActionMessage&& command)
               fmt::format("|| cmd:{} from {}",
                           prettyPrintString(command),
                           command.source_id.baseValue()));
+    // without a federate registration the core registration goes with the next command
+    sendHeldRegistration();
     switch (command.action()) {
         case CMD_IGNORE:
             break;
@@ -3648,6 +3716,7 @@ void CommonCore::processCommand(ActionMessage&& command)
             //  }
             break;
         case CMD_PUB:
+        case CMD_PUB_BATCH:
             routeMessage(command);
             break;
         case CMD_LOG:
@@ -5131,7 +5200,7 @@ void CommonCore::processQueryCommand(ActionMessage& cmd)
                 queryResp.source_id = cmd.dest_id;
                 queryResp.messageID = cmd.messageID;
                 queryResp.counter = cmd.counter;
-                const std::string& target = cmd.getString(targetStringLoc);
+                const auto target = cmd.getString(targetStringLoc);
                 if (target == getIdentifier()) {
                     queryResp.source_id = global_broker_id_local;
                     repStr = coreQuery(cmd.payload.to_string(), force_ordered);
@@ -5233,7 +5302,7 @@ bool CommonCore::hasTimeBlock(GlobalFederateId federateID)
     return false;
 }
 
-bool CommonCore::waitCoreRegistration()
+bool CommonCore::waitCoreRegistration(bool warmStart)
 {
     int sleepcnt = 0;
     auto brkid = global_id.load();
@@ -5252,6 +5321,10 @@ bool CommonCore::waitCoreRegistration()
         if (getBrokerState() >= BrokerState::TERMINATING) {
             return false;
         }
+        if (warmStart && warmStartId.isValid() && getBrokerState() >= BrokerState::CONNECTED) {
+            // federates register with the id from the previous run along with the core
+            return true;
+        }
         if (sleepcnt == 4) {
             LOG_WARNING(parent_broker_id,
                         identifier,
@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Core.hpp"
 #include "FederateIdExtra.hpp"
 #include "HandleManager.hpp"
+#include "MessagePool.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/containers/AirLock.hpp"
@@ -303,6 +304,9 @@ class CommonCore: public Core, public BrokerBase {
     virtual const std::string& getFederateTag(LocalFederateId fid,
                                               std::string_view tag) const override final;
 
+    /** get the pool used to recycle message objects passing through the core*/
+    MessagePool& getMessagePool() { return messagePool; }
+
   private:
     /** implementation details of the connection process
      */
@@ -344,6 +348,8 @@ class CommonCore: public Core, public BrokerBase {
     FederateState* getHandleFederate(InterfaceHandle handle);
     /** get the basic handle information*/
     const BasicHandleInfo* getHandleInfo(InterfaceHandle handle) const;
+    /** send the pending grouped publication values of a federate*/
+    void sendPublicationBatches(FederateState* fed);
     /** get a localEndpoint from the name*/
     const BasicHandleInfo* getLocalEndpoint(std::string_view name) const;
 
@@ -355,6 +361,10 @@ class CommonCore: public Core, public BrokerBase {
     OperatingState minFederateState() const;
 
     virtual double getSimulationTime() const override;
+    /** set the global id the root broker assigned to this core in a previous run
+    @details the registration of the core is then sent with the first federate registration and
+    the federates do not wait for the broker to acknowledge the core*/
+    void setWarmStartId(GlobalBrokerId brokerId) { warmStartId = brokerId; }
 
   private:
     /** get the federate Information from the federateID*/
@@ -374,6 +384,11 @@ class CommonCore: public Core, public BrokerBase {
     std::map<GlobalFederateId, route_id> routing_table;
     /** FIFO queue for transmissions to the root that need to be delayed for a certain time */
     gmlc::containers::SimpleQueue<ActionMessage> delayTransmitQueue;
+    GlobalBrokerId warmStartId;  //!< the id the root broker assigned in a previous run
+    /// the registration of the core was sent with the id from the previous run
+    bool warmStartRegistration{false};
+    /// the registration of the core held to be sent with the first federate registration
+    ActionMessage heldRegistration{CMD_IGNORE};
     /** external map for all known external endpoints with names and route */
     std::unordered_map<std::string, route_id> knownExternalEndpoints;
     std::vector<std::pair<std::string, std::string>> tags;  //!< storage for user defined tags
@@ -381,6 +396,8 @@ class CommonCore: public Core, public BrokerBase {
     std::unique_ptr<TimeoutMonitor> timeoutMon;
     /** actually transmit messages that were delayed until the core was actually registered*/
     void transmitDelayedMessages();
+    /** send the registration of the core if it is still held for a federate registration*/
+    void sendHeldRegistration();
     /** respond to delayed message with an error*/
     void errorRespondDelayedMessages(std::string_view estring);
     /** actually transmit messages that were delayed for a particular source
@@ -471,6 +488,7 @@ class CommonCore: public Core, public BrokerBase {
     /** counter for the number of messages that have been sent, nothing magical about 54 just a
      * number bigger than 1 to prevent confusion */
     std::atomic<int32_t> messageCounter{54};
+    MessagePool messagePool;  //!< storage for message objects that can be reused
     ordered_guarded<HandleManager> handles;  //!< local handle information;
     /// copy of handles to use in the primary processing loop without thread protection
     HandleManager loopHandles;
@@ -512,8 +530,9 @@ class CommonCore: public Core, public BrokerBase {
     void connectFilterTiming();
     /** check if a given federate has a timeblock*/
     bool hasTimeBlock(GlobalFederateId federateID);
-    /** wait for the core to be registered with the broker*/
-    bool waitCoreRegistration();
+    /** wait for the core to be registered with the broker
+    @param warmStart return once the core is connected if it registers with a warm start id*/
+    bool waitCoreRegistration(bool warmStart = false);
     /** generate the messages to a set of destinations*/
     void generateMessages(ActionMessage& message,
                           const std::vector<std::pair<GlobalHandle, std::string_view>>& targets);
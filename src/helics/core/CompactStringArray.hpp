@@ -0,0 +1,285 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** class storing a small array of strings in a single contiguous allocation
+@details the block starts with a header containing the capacity of the block in bytes and the
+number of strings followed by a table of offsets and then the character data of all the strings.
+Empty arrays do not allocate, and any number of strings costs at most one allocation.  The object
+itself is a single pointer so moving it is trivial.
+*/
+class CompactStringArray {
+  public:
+    /** default constructor*/
+    CompactStringArray() noexcept = default;
+    /** construct from a list of strings*/
+    CompactStringArray(std::initializer_list<std::string_view> strings) { assign(strings); }
+    /** copy constructor*/
+    CompactStringArray(const CompactStringArray& other)
+    {
+        if (other.block != nullptr && other.size() > 0) {
+            const auto bytes = other.usedBytes();
+            block = allocate(bytes);
+            std::memcpy(block, other.block, bytes);
+            writeField(0, static_cast<std::uint32_t>(bytes));
+        }
+    }
+    /** move constructor*/
+    CompactStringArray(CompactStringArray&& other) noexcept:
+        block(std::exchange(other.block, nullptr))
+    {
+    }
+    /** copy assignment*/
+    CompactStringArray& operator=(const CompactStringArray& other)
+    {
+        if (this == &other) {
+            return *this;
+        }
+        if (other.block == nullptr || other.size() == 0) {
+            clear();
+            return *this;
+        }
+        const auto bytes = other.usedBytes();
+        if (block == nullptr || capacityBytes() < bytes) {
+            auto* newBlock = allocate(bytes);
+            delete[] block;
+            block = newBlock;
+            std::memcpy(block, other.block, bytes);
+            writeField(0, static_cast<std::uint32_t>(bytes));
+        } else {
+            const auto capacity = readField(0);
+            std::memcpy(block, other.block, bytes);
+            writeField(0, capacity);
+        }
+        return *this;
+    }
+    /** move assignment*/
+    CompactStringArray& operator=(CompactStringArray&& other) noexcept
+    {
+        if (this != &other) {
+            delete[] block;
+            block = std::exchange(other.block, nullptr);
+        }
+        return *this;
+    }
+    /** destructor*/
+    ~CompactStringArray() { delete[] block; }
+
+    /** get the number of strings stored*/
+    std::size_t size() const noexcept { return (block == nullptr) ? 0U : readField(1); }
+    /** check if there are no strings stored*/
+    bool empty() const noexcept { return size() == 0U; }
+    /** get a view of the string at a specific index, no bounds checking is done*/
+    std::string_view operator[](std::size_t index) const noexcept
+    {
+        const auto start = offset(index);
+        return {reinterpret_cast<const char*>(block) + start, offset(index + 1) - start};
+    }
+    /** get a view of a string with bounds checking*/
+    std::string_view at(std::size_t index) const
+    {
+        if (index >= size()) {
+            throw(std::out_of_range("specified index is not valid"));
+        }
+        return operator[](index);
+    }
+    /** get a view of the last string*/
+    std::string_view back() const noexcept { return operator[](size() - 1); }
+    /** get the total number of characters in all the strings*/
+    std::size_t characterCount() const noexcept
+    {
+        return (block == nullptr) ? 0U : offset(size()) - offset(0);
+    }
+
+    /** replace the contents with a list of strings*/
+    void assign(std::initializer_list<std::string_view> strings)
+    {
+        assign(strings.begin(), strings.size());
+    }
+    /** replace the contents with an array of strings
+    @details the strings may reference data currently stored in the array*/
+    void assign(const std::string_view* strings, std::size_t count)
+    {
+        assign(strings, count, 0);
+    }
+    /** set the string at a particular index expanding the array with empty strings as needed*/
+    void set(std::size_t index, std::string_view str)
+    {
+        const auto count = size();
+        if (index == count && count > 0 && !references(str) &&
+            capacityBytes() >= usedBytes() + sizeof(std::uint32_t) + str.size()) {
+            appendInPlace(str);
+            return;
+        }
+        std::vector<std::string_view> strings((index >= count) ? index + 1 : count);
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            strings[ii] = operator[](ii);
+        }
+        strings[index] = str;
+        // rebuild in a new block since the existing strings reference the current block
+        // appending leaves some room so sequential additions don't rebuild every time
+        const std::size_t reserve = (index >= count) ?
+            (headerBytes(index + 1) + characterCount() + str.size()) * 3 / 2 :
+            0;
+        CompactStringArray replacement;
+        replacement.assign(strings.data(), strings.size(), reserve);
+        swap(replacement);
+    }
+    /** remove the last string*/
+    void pop_back() noexcept
+    {
+        const auto count = size();
+        if (count > 0) {
+            writeField(1, static_cast<std::uint32_t>(count - 1));
+        }
+    }
+    /** remove all the strings, retaining any allocated memory*/
+    void clear() noexcept
+    {
+        if (block != nullptr) {
+            writeField(1, 0U);
+        }
+    }
+    /** swap contents with another array*/
+    void swap(CompactStringArray& other) noexcept { std::swap(block, other.block); }
+
+  private:
+    static constexpr std::size_t maxBlockSize{0xFFFF'FFFFU};
+
+    void assign(const std::string_view* strings, std::size_t count, std::size_t minCapacity)
+    {
+        if (count == 0) {
+            clear();
+            return;
+        }
+        std::size_t characters{0};
+        bool aliased{false};
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            characters += strings[ii].size();
+            aliased = aliased || references(strings[ii]);
+        }
+        const auto bytes = headerBytes(count) + characters;
+        if (bytes > maxBlockSize) {
+            throw(std::bad_alloc());
+        }
+        std::byte* target = block;
+        std::uint32_t capacity{0};
+        if (block == nullptr || aliased || capacityBytes() < bytes) {
+            const auto allocation = (minCapacity > bytes && minCapacity <= maxBlockSize) ?
+                minCapacity :
+                bytes;
+            target = allocate(allocation);
+            capacity = static_cast<std::uint32_t>(allocation);
+        } else {
+            capacity = readField(0);
+        }
+        auto loc = static_cast<std::uint32_t>(headerBytes(count));
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            writeField(target, 2 + ii, loc);
+            if (!strings[ii].empty()) {
+                std::memcpy(target + loc, strings[ii].data(), strings[ii].size());
+            }
+            loc += static_cast<std::uint32_t>(strings[ii].size());
+        }
+        writeField(target, 2 + count, loc);
+        writeField(target, 1, static_cast<std::uint32_t>(count));
+        writeField(target, 0, capacity);
+        if (target != block) {
+            delete[] block;
+            block = target;
+        }
+    }
+    /** add a string to the end of the array when the block has sufficient capacity
+    @details the character data is shifted to make room for the additional offset entry*/
+    void appendInPlace(std::string_view str) noexcept
+    {
+        const auto count = size();
+        const auto start = headerBytes(count);
+        const auto end = usedBytes();
+        std::memmove(block + start + sizeof(std::uint32_t), block + start, end - start);
+        for (std::size_t ii = 0; ii <= count; ++ii) {
+            writeField(2 + ii, static_cast<std::uint32_t>(offset(ii) + sizeof(std::uint32_t)));
+        }
+        const auto loc = end + sizeof(std::uint32_t);
+        if (!str.empty()) {
+            std::memcpy(block + loc, str.data(), str.size());
+        }
+        writeField(3 + count, static_cast<std::uint32_t>(loc + str.size()));
+        writeField(1, static_cast<std::uint32_t>(count + 1));
+    }
+    /** the size of the header fields and offset table for a given number of strings*/
+    static constexpr std::size_t headerBytes(std::size_t count)
+    {
+        return sizeof(std::uint32_t) * (count + 3);
+    }
+    static std::byte* allocate(std::size_t bytes) { return new std::byte[bytes]; }
+
+    std::uint32_t readField(std::size_t field) const noexcept
+    {
+        std::uint32_t value;
+        std::memcpy(&value, block + field * sizeof(std::uint32_t), sizeof(std::uint32_t));
+        return value;
+    }
+    void writeField(std::size_t field, std::uint32_t value) noexcept
+    {
+        writeField(block, field, value);
+    }
+    static void writeField(std::byte* target, std::size_t field, std::uint32_t value) noexcept
+    {
+        std::memcpy(target + field * sizeof(std::uint32_t), &value, sizeof(std::uint32_t));
+    }
+    std::size_t offset(std::size_t index) const noexcept { return readField(2 + index); }
+    std::size_t capacityBytes() const noexcept { return readField(0); }
+    /** the number of bytes in use for the current strings*/
+    std::size_t usedBytes() const noexcept { return offset(size()); }
+    /** check if a string_view points into the current block*/
+    bool references(std::string_view str) const noexcept
+    {
+        if (block == nullptr || str.empty()) {
+            return false;
+        }
+        const auto* start = reinterpret_cast<const char*>(block);
+        return (std::less_equal<const char*>()(start, str.data()) &&
+                std::less<const char*>()(str.data(), start + capacityBytes()));
+    }
+
+    std::byte* block{nullptr};
+};
+
+/** operator to check if two string arrays contain the same strings*/
+inline bool operator==(const CompactStringArray& arr1, const CompactStringArray& arr2)
+{
+    if (arr1.size() != arr2.size()) {
+        return false;
+    }
+    for (std::size_t ii = 0; ii < arr1.size(); ++ii) {
+        if (arr1[ii] != arr2[ii]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** operator to check if two string arrays are not equal*/
+inline bool operator!=(const CompactStringArray& arr1, const CompactStringArray& arr2)
+{
+    return !(arr1 == arr2);
+}
+
+}  // namespace helics
@@ -25,6 +25,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "queryHelpers.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <fmt/format.h>
 #include <iostream>
 #include <limits>
@@ -51,6 +52,8 @@ namespace {
                                                                 "queries",
                                                                 "address",
                                                                 "counts",
+                                                                "compression",
+                                                                "parent_links",
                                                                 "summary",
                                                                 "federates",
                                                                 "brokers",
@@ -163,8 +166,11 @@ route_id CoreBroker::getRoute(GlobalFederateId fedid) const
 BasicBrokerInfo* CoreBroker::getBrokerById(GlobalBrokerId brokerid)
 {
     if (isRootc) {
+        // the id is the index unless it was reserved by a previous run
         auto brkNum = brokerid.localIndex();
-        return (isValidIndex(brkNum, mBrokers) ? &mBrokers[brkNum] : nullptr);
+        if (isValidIndex(brkNum, mBrokers) && mBrokers[brkNum].global_id == brokerid) {
+            return &mBrokers[brkNum];
+        }
     }
 
     auto fnd = mBrokers.find(brokerid);
@@ -175,13 +181,48 @@ const BasicBrokerInfo* CoreBroker::getBrokerById(GlobalBrokerId brokerid) const
 {
     if (isRootc) {
         auto brkNum = brokerid.localIndex();
-        return (isValidIndex(brkNum, mBrokers)) ? &mBrokers[brkNum] : nullptr;
+        if (isValidIndex(brkNum, mBrokers) && mBrokers[brkNum].global_id == brokerid) {
+            return &mBrokers[brkNum];
+        }
     }
 
     auto fnd = mBrokers.find(brokerid);
     return (fnd != mBrokers.end()) ? &(*fnd) : nullptr;
 }
 
+void CoreBroker::reserveBrokerIds(const std::vector<std::pair<std::string, GlobalBrokerId>>& ids)
+{
+    for (const auto& [brokerName, brokerId] : ids) {
+        if (reservedIdSet.insert(brokerId).second) {
+            reservedBrokerIds.emplace(brokerName, brokerId);
+        }
+    }
+}
+
+GlobalBrokerId CoreBroker::assignBrokerId(std::string_view brokerName,
+                                          GlobalBrokerId requested) const
+{
+    auto reserved = reservedBrokerIds.find(brokerName);
+    if (reserved != reservedBrokerIds.end() && mBrokers.find(reserved->second) == mBrokers.end()) {
+        return reserved->second;
+    }
+    if (requested.isValid() && requested != parent_broker_id) {
+        LOG_WARNING(global_broker_id_local,
+                    getIdentifier(),
+                    fmt::format("{} requested id {} which is not available",
+                                brokerName,
+                                requested.baseValue()));
+    }
+    // the ids reserved for the brokers of a previous run are skipped
+    GlobalBrokerId candidate(static_cast<GlobalBrokerId::BaseType>(mBrokers.size()) - 1 +
+                             gGlobalBrokerIdShift);
+    while (reservedIdSet.find(candidate) != reservedIdSet.end() ||
+           mBrokers.find(candidate) != mBrokers.end()) {
+        candidate = GlobalBrokerId(candidate.baseValue() + 1);
+    }
+    return candidate;
+}
+
 void CoreBroker::setLoggingCallback(
     std::function<void(int, std::string_view, std::string_view)> logFunction)
 {
@@ -296,13 +337,13 @@ void CoreBroker::addAlias(std::string_view interfaceKey, std::string_view alias)
 
 route_id CoreBroker::fillMessageRouteInformation(ActionMessage& mess)
 {
-    const auto& endpointName = mess.getString(targetStringLoc);
+    auto endpointName = mess.getString(targetStringLoc);
     auto* eptInfo = handles.getInterfaceHandle(endpointName, InterfaceType::ENDPOINT);
     if (eptInfo != nullptr) {
         mess.setDestination(eptInfo->handle);
         return getRoute(eptInfo->handle.fed_id);
     }
-    auto fnd2 = knownExternalEndpoints.find(endpointName);
+    auto fnd2 = knownExternalEndpoints.find(std::string(endpointName));
     if (fnd2 != knownExternalEndpoints.end()) {
         return fnd2->second;
     }
@@ -478,10 +519,16 @@ void CoreBroker::brokerRegistration(ActionMessage&& command)
             delayTransmitQueue.push(command);
         }
     } else {
-        mBrokers.back().global_id = GlobalBrokerId(
-            static_cast<GlobalBrokerId::BaseType>(mBrokers.size()) - 1 + gGlobalBrokerIdShift);
+        mBrokers.back().global_id = assignBrokerId(command.name(), command.dest_id);
         mBrokers.addSearchTermForIndex(mBrokers.back().global_id, mBrokers.size() - 1);
         auto global_brkid = mBrokers.back().global_id;
+        if (command.dest_id.isValid() && command.dest_id != parent_broker_id &&
+            command.dest_id != global_brkid) {
+            // the core registers its first federates with the id it requested
+            warmStartAliases.insert_or_assign(std::string(command.name()),
+                                              std::make_pair(GlobalBrokerId(command.dest_id),
+                                                             global_brkid));
+        }
         auto route = mBrokers.back().route;
         if (checkActionFlag(command, slow_responding_flag)) {
             mBrokers.back()._disable_ping = true;
@@ -549,6 +596,22 @@ void CoreBroker::fedRegistration(ActionMessage&& command)
         earlyMessages.push_back(std::move(command));
         return;
     }
+    if (isRootc && command.source_id == command.dest_id && command.source_id.isBroker()) {
+        // sent by a core with the id it requested before its registration was acknowledged
+        auto alias = warmStartAliases.find(command.getString(0));
+        if (alias != warmStartAliases.end() && alias->second.first == command.source_id) {
+            command.source_id = alias->second.second;
+        }
+        command.dest_id = parent_broker_id;
+        if (routing_table.find(command.source_id) == routing_table.end()) {
+            LOG_WARNING(global_broker_id_local,
+                        getIdentifier(),
+                        fmt::format("federate {} registered from unknown core {}",
+                                    command.name(),
+                                    command.getString(0)));
+            return;
+        }
+    }
     const bool countable = !checkActionFlag(command, non_counting_flag);
     bool dynamicFed{false};
     if (countable && getCountableFederates() >= maxFederateCount) {
@@ -906,6 +969,41 @@ std::string CoreBroker::generateFederationSummary() const
     return fileops::generateJsonString(summary);
 }
 
+// check if a message is one of the time messages whose updates can be aggregated
+static bool isAggregatedTimeMessage(const ActionMessage& command, GlobalFederateId brokerId)
+{
+    switch (command.action()) {
+        case CMD_TIME_REQUEST:
+        case CMD_TIME_GRANT:
+        case CMD_REQUEST_CURRENT_TIME:
+            return command.dest_id == brokerId;
+        default:
+            return false;
+    }
+}
+
+bool CoreBroker::deferTimeUpdate()
+{
+    if (timeAggregationThreshold == 0 || timeCoord->size() < timeAggregationThreshold) {
+        return false;
+    }
+    // once every dependency could have reported there is nothing more to aggregate
+    if (++deferredTimeUpdates >= timeCoord->size()) {
+        deferredTimeUpdates = 0;
+        return false;
+    }
+    deferredOperationsPending = true;
+    return true;
+}
+
+void CoreBroker::processDeferredOperations()
+{
+    if (deferredTimeUpdates > 0) {
+        deferredTimeUpdates = 0;
+        timeCoord->updateTimeFactors();
+    }
+}
+
 void CoreBroker::generateTimeBarrier(ActionMessage& message)
 {
     if (checkActionFlag(message, cancel_flag)) {
@@ -1108,6 +1206,10 @@ void CoreBroker::processCommand(ActionMessage&& command)
                           prettyPrintString(command),
                           command.source_id.baseValue(),
                           command.dest_id.baseValue()));
+    if (deferredTimeUpdates > 0 && !isAggregatedTimeMessage(command, global_broker_id_local)) {
+        // anything else must see the time factors from all the time messages before it
+        processDeferredOperations();
+    }
     switch (command.action()) {
         case CMD_IGNORE:
         case CMD_PROTOCOL:
@@ -1125,6 +1227,9 @@ void CoreBroker::processCommand(ActionMessage&& command)
                 ActionMessage pngrep(CMD_PING_REPLY);
                 pngrep.dest_id = command.source_id;
                 pngrep.source_id = global_broker_id_local;
+                // echoed so a child can tell which of its pings is answered
+                pngrep.messageID = command.messageID;
+                pngrep.counter = command.counter;
                 routeMessage(pngrep);
             } else {
                 routeMessage(command);
@@ -1397,7 +1502,9 @@ void CoreBroker::processCommand(ActionMessage&& command)
             } else if (command.dest_id == global_broker_id_local) {
                 if (timeCoord->processTimeMessage(command) != TimeProcessingResult::NOT_PROCESSED) {
                     if (enteredExecutionMode) {
-                        timeCoord->updateTimeFactors();
+                        if (!deferTimeUpdate()) {
+                            timeCoord->updateTimeFactors();
+                        }
                     } else {
                         if (getBrokerState() >= BrokerState::OPERATING) {
                             auto res = timeCoord->checkExecEntry(command.source_id);
@@ -1460,6 +1567,7 @@ void CoreBroker::processCommand(ActionMessage&& command)
             }
             break;
         case CMD_PUB:
+        case CMD_PUB_BATCH:
             transmit(getRoute(command.dest_id), command);
             break;
 
@@ -2465,6 +2573,11 @@ std::shared_ptr<helicsCLI11App> CoreBroker::generateCLI()
                     mTimeMonitorPeriod,
                     "period to display logs of times from the time monitor federate")
         ->needs(tfed);
+    app->add_option("--time_aggregation_threshold",
+                    timeAggregationThreshold,
+                    "the number of time dependencies at which the broker aggregates the timing "
+                    "messages waiting in its queue into a single time update, 0 to disable")
+        ->capture_default_str();
     return app;
 }
 
@@ -2840,6 +2953,23 @@ void CoreBroker::findRegexMatch(const std::string& target,
 
 static constexpr auto regexKey = "REGEX:";
 
+// get the index of the found handle list used for an interface type during initialization
+static int foundHandleIndex(InterfaceType type)
+{
+    switch (type) {
+        case InterfaceType::PUBLICATION:
+            return 0;
+        case InterfaceType::INPUT:
+            return 1;
+        case InterfaceType::ENDPOINT:
+            return 2;
+        case InterfaceType::FILTER:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
 void CoreBroker::executeInitializationOperations(bool iterating)
 {
     if (iterating) {
@@ -2863,6 +2993,8 @@ void CoreBroker::executeInitializationOperations(bool iterating)
     if (brokerKey == universalKey) {
         LOG_SUMMARY(global_broker_id_local, getIdentifier(), "Broker started with universal key");
     }
+    // registration is mostly complete so switch the name lookups to the frozen tables
+    handles.freezeSearchIndex();
     checkDependencies();
     if (!mTimeMonitorFederate.empty()) {
         loadTimeMonitor(true, std::string_view{});
@@ -2908,21 +3040,11 @@ void CoreBroker::executeInitializationOperations(bool iterating)
                     }
                     return;
                 }
-                switch (type) {
-                    case InterfaceType::PUBLICATION:
-                        foundAliasHandles[0].emplace_back(target);
-                        break;
-                    case InterfaceType::INPUT:
-                        foundAliasHandles[1].emplace_back(target);
-                        break;
-                    case InterfaceType::ENDPOINT:
-                        foundAliasHandles[2].emplace_back(target);
-                        break;
-                    case InterfaceType::FILTER:
-                        foundAliasHandles[3].emplace_back(target);
-                        break;
-                    default:
-                        break;
+                auto index = foundHandleIndex(type);
+                // equal names are adjacent in the unknown maps and only need to be notified once
+                if (index >= 0 && (foundAliasHandles[index].empty() ||
+                                   foundAliasHandles[index].back() != target)) {
+                    foundAliasHandles[index].emplace_back(target);
                 }
             });
         if (!foundAliasHandles[0].empty()) {
@@ -3758,6 +3880,22 @@ std::string CoreBroker::generateQueryAnswer(std::string_view request, bool force
         base["interfaces"] = static_cast<int>(handles.size());
         return fileops::generateJsonString(base);
     }
+    if (request == "compression") {
+        nlohmann::json base;
+        addHeader(base);
+        auto stats = commsQuery(request);
+        base["compression"] =
+            stats.empty() ? nlohmann::json{{"type", "none"}} : fileops::loadJsonStr(stats);
+        return fileops::generateJsonString(base);
+    }
+    if (request == "parent_links") {
+        nlohmann::json base;
+        addHeader(base);
+        auto stats = commsQuery(request);
+        base["parent_links"] =
+            stats.empty() ? nlohmann::json::array() : fileops::loadJsonStr(stats);
+        return fileops::generateJsonString(base);
+    }
     if (request == "summary") {
         return generateFederationSummary();
     }
@@ -28,6 +28,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -138,6 +139,10 @@ class CoreBroker: public Broker, public BrokerBase {
     std::deque<std::pair<int32_t, decltype(std::chrono::steady_clock::now())>> queryTimeouts;
 
     std::vector<ActionMessage> earlyMessages;  //!< list of messages that came before connection
+    /// the number of time dependencies at which timing updates are aggregated, 0 to disable
+    std::size_t timeAggregationThreshold{0};
+    /// the number of time messages processed since the time factors were last updated
+    std::size_t deferredTimeUpdates{0};
     gmlc::concurrency::TriggerVariable disconnection;  //!< controller for the disconnection process
     /// class to handle timeouts and disconnection notices
     std::unique_ptr<TimeoutMonitor> timeoutMon;
@@ -155,6 +160,13 @@ class CoreBroker: public Broker, public BrokerBase {
     Time mTimeMonitorCurrentTime{Time::minVal()};  //!< the last time from the timing federate
     std::atomic<double> simTime{mInvalidSimulationTime};  //!< loaded simTime for logging
     Time mNextTimeBarrier{Time::maxVal()};  //!< the last known time barrier
+    /// ids the root broker assigned in a previous run by the name they were assigned to
+    std::map<std::string, GlobalBrokerId, std::less<>> reservedBrokerIds;
+    std::set<GlobalBrokerId> reservedIdSet;  //!< the ids in reservedBrokerIds
+    /// the requested and assigned ids of cores not given the id they requested by name
+    std::map<std::string, std::pair<GlobalBrokerId, GlobalBrokerId>, std::less<>>
+        warmStartAliases;
+
   private:
     /** function that processes all the messages
     @param command -- the message to process
@@ -166,6 +178,12 @@ class CoreBroker: public Broker, public BrokerBase {
     @param command the command to process
     */
     void processPriorityCommand(ActionMessage&& command) override;
+    /** update the time factors if any timing updates have been deferred*/
+    void processDeferredOperations() override;
+    /** check if the time factor update for a time message should be aggregated with the messages
+    that follow it
+    @return true if the update was deferred*/
+    bool deferTimeUpdate();
 
     /** process configure commands for the broker*/
     void processBrokerConfigureCommands(ActionMessage& cmd);
@@ -330,6 +348,9 @@ class CoreBroker: public Broker, public BrokerBase {
     virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
 
     virtual double getSimulationTime() const override;
+    /** reserve the ids a root broker assigned in a previous run for the same names
+    @details must be called before the broker connects*/
+    void reserveBrokerIds(const std::vector<std::pair<std::string, GlobalBrokerId>>& ids);
 
   private:
     int getCountableFederates() const;
@@ -402,6 +423,10 @@ class CoreBroker: public Broker, public BrokerBase {
     const BasicBrokerInfo* getBrokerById(GlobalBrokerId brokerid) const;
 
     BasicBrokerInfo* getBrokerById(GlobalBrokerId brokerid);
+    /** get the id the root broker assigns to a new broker or core
+    @param brokerName the name of the broker or core
+    @param requested the id it requested, the id is granted if it is reserved for the name*/
+    GlobalBrokerId assignBrokerId(std::string_view brokerName, GlobalBrokerId requested) const;
 
     void addLocalInfo(BasicHandleInfo& handleInfo, const ActionMessage& message);
     void addPublication(ActionMessage& message);
@@ -109,6 +109,8 @@ using namespace std::chrono_literals;  // NOLINT
 
 namespace helics {
 static constexpr std::uint64_t valueBufferWarningDefaultBytes{100ULL * 1024ULL * 1024ULL};
+/// the size of the pending grouped publication values that causes the batches to be sent early
+static constexpr std::size_t publicationBatchSizeLimit{1024ULL * 1024ULL};
 
 FederateState::FederateState(const std::string& fedName, const CoreFederateInfo& fedInfo):
     name(fedName),
@@ -166,6 +168,8 @@ void FederateState::reset(const CoreFederateInfo& fedInfo)
     queue.clear();
     delayQueues.clear();
     interfaceInformation.reset();
+    pendingBatches.clear();
+    pendingBatchBytes = 0;
 
     timeCoord =
         std::make_unique<TimeCoordinator>([this](const ActionMessage& msg) { routeMessage(msg); });
@@ -688,6 +692,72 @@ std::vector<GlobalHandle> FederateState::getSubscribers(InterfaceHandle handle)
     return subs;
 }
 
+bool FederateState::addGroupedValue(InterfaceHandle handle,
+                                    const std::vector<GlobalHandle>& subscribers,
+                                    const std::shared_ptr<const SmallBuffer>& data,
+                                    std::vector<ActionMessage>& readyBatches)
+{
+    const std::scoped_lock<FederateState> fedlock(*this);
+    const auto* pubInfo = interfaceInformation.getPublication(handle);
+    if (pubInfo == nullptr || !pubInfo->grouped) {
+        return false;
+    }
+    const auto iteration = getCurrentIteration();
+    if (pendingBatchBytes > 0 &&
+        (pendingBatchTime != allowed_send_time || pendingBatchIteration != iteration ||
+         pendingBatchBytes >= publicationBatchSizeLimit)) {
+        readyBatches = generatePublicationBatches();
+    }
+    pendingBatchTime = allowed_send_time;
+    pendingBatchIteration = iteration;
+    for (const auto& sub : subscribers) {
+        pendingBatches[sub.fed_id].push_back({handle, sub.handle, data});
+    }
+    // count at least one byte per value so empty values still mark the batches as pending
+    pendingBatchBytes += (data->size() + 1) * subscribers.size();
+    return true;
+}
+
+std::vector<ActionMessage> FederateState::takePublicationBatches()
+{
+    const std::scoped_lock<FederateState> fedlock(*this);
+    return generatePublicationBatches();
+}
+
+std::vector<ActionMessage> FederateState::generatePublicationBatches()
+{
+    std::vector<ActionMessage> batches;
+    if (pendingBatchBytes == 0) {
+        return batches;
+    }
+    const auto source = global_id.load();
+    for (auto& [dest, entries] : pendingBatches) {
+        if (entries.empty()) {
+            continue;
+        }
+        if (entries.size() == 1) {
+            // a single value goes out as a normal publication
+            ActionMessage pub(CMD_PUB, source, dest);
+            pub.source_handle = entries.front().source_handle;
+            pub.dest_handle = entries.front().dest_handle;
+            pub.setSharedPayload(std::move(entries.front().data));
+            pub.actionTime = pendingBatchTime;
+            pub.counter = static_cast<uint16_t>(pendingBatchIteration);
+            batches.push_back(std::move(pub));
+        } else {
+            ActionMessage batch(CMD_PUB_BATCH, source, dest);
+            packPublicationBatch(batch, entries);
+            batch.actionTime = pendingBatchTime;
+            batch.counter = static_cast<uint16_t>(pendingBatchIteration);
+            batches.push_back(std::move(batch));
+        }
+        // the storage is kept since the same destinations are expected at the next time step
+        entries.clear();
+    }
+    pendingBatchBytes = 0;
+    return batches;
+}
+
 std::vector<std::pair<GlobalHandle, std::string_view>>
     FederateState::getMessageDestinations(InterfaceHandle handle)
 {
@@ -913,6 +983,12 @@ void FederateState::updateQueuedValueBytes()
     }
 }
 
+std::unique_ptr<Message> FederateState::acquireMessage()
+{
+    return (mParent != nullptr) ? mParent->getMessagePool().acquire() :
+                                  std::make_unique<Message>();
+}
+
 void FederateState::checkValueBufferWarning()
 {
     if (valueBufferWarningLimit == 0) {
@@ -1170,6 +1246,9 @@ void FederateState::initCallbackProcessing()
         case IterationRequest::ITERATE_IF_NEEDED:
         case IterationRequest::FORCE_ITERATION:
         default: {
+            for (auto& batch : takePublicationBatches()) {
+                mParent->addActionMessage(std::move(batch));
+            }
             ActionMessage exec(CMD_EXEC_REQUEST);
             exec.source_id = global_id.load();
             exec.dest_id = global_id.load();
@@ -1203,6 +1282,9 @@ void FederateState::execCallbackProcessing(IterationResult result)
         case IterationRequest::ITERATE_IF_NEEDED:
         case IterationRequest::FORCE_ITERATION:
         default: {
+            for (auto& batch : takePublicationBatches()) {
+                mParent->addActionMessage(std::move(batch));
+            }
             ActionMessage treq(CMD_TIME_REQUEST);
             treq.source_id = global_id.load();
             treq.dest_id = treq.source_id;
@@ -1601,6 +1683,7 @@ MessageProcessingResult FederateState::processActionMessage(ActionMessage& cmd)
             break;
         case CMD_SEND_MESSAGE:
         case CMD_PUB:
+        case CMD_PUB_BATCH:
             processDataMessage(cmd);
             break;
         case CMD_LOG:
@@ -1873,7 +1956,7 @@ void FederateState::processDataMessage(ActionMessage& cmd)
                 if (state <= FederateStates::EXECUTING) {
                     timeCoord->processTimeMessage(cmd);
                 }
-                epi->addMessage(createMessageFromCommand(std::move(cmd)));
+                epi->addMessage(createMessageFromCommand(std::move(cmd), acquireMessage()));
             }
         } break;
         case CMD_PUB: {
@@ -1894,8 +1977,8 @@ void FederateState::processDataMessage(ActionMessage& cmd)
                             static_cast<double>(cmd.actionTime),
                             static_cast<double>(time_granted)));
                     }
-                    auto mess = std::make_unique<Message>();
-                    mess->data = std::move(cmd.payload);
+                    auto mess = acquireMessage();
+                    cmd.movePayloadTo(mess->data);
                     mess->dest = eptI->key;
                     mess->flags = cmd.flags;
                     mess->time = cmd.actionTime;
@@ -1909,38 +1992,30 @@ void FederateState::processDataMessage(ActionMessage& cmd)
                 }
                 break;
             }
-            for (auto& src : subI->input_sources) {
-                auto valueTime = cmd.actionTime;
-                if (timeMethod == TimeSynchronizationMethod::ASYNC) {
-                    if (valueTime < time_granted) {
-                        valueTime = time_granted;
-                    }
-                }
-                if ((cmd.source_id == src.fed_id) && (cmd.source_handle == src.handle)) {
-                    const auto payloadSize = static_cast<std::uint64_t>(cmd.payload.size());
-                    if (subI->addData(src,
-                                      valueTime,
-                                      cmd.counter,
-                                      std::make_shared<const SmallBuffer>(
-                                          std::move(cmd.payload)))) {
-                        if (payloadSize >
-                            (std::numeric_limits<std::uint64_t>::max() - queuedValueBytes)) {
-                            queuedValueBytes = std::numeric_limits<std::uint64_t>::max();
-                        } else {
-                            queuedValueBytes += payloadSize;
-                        }
-                        checkValueBufferWarning();
-                        if (!subI->not_interruptible) {
-                            timeCoord->updateValueTime(valueTime, !timeGranted_mode);
-                            LOG_TRACE(timeCoord->printTimeStatus());
-                        }
-                        LOG_DATA(fmt::format("receive PUBLICATION {} from {}",
-                                             prettyPrintString(cmd),
-                                             subI->getSourceName(src)));
-                    }
-                    // this can only match once
-                    break;
+            addInputValue(*subI, cmd.getSource(), cmd.extractSharedPayload(), cmd);
+            if (state <= FederateStates::EXECUTING) {
+                timeCoord->processTimeMessage(cmd);
+            }
+        } break;
+        case CMD_PUB_BATCH: {
+            auto entries = unpackPublicationBatch(cmd);
+            for (auto& entry : entries) {
+                auto* subI = interfaceInformation.getInput(entry.dest_handle);
+                if (subI != nullptr) {
+                    addInputValue(*subI,
+                                  GlobalHandle(cmd.source_id, entry.source_handle),
+                                  std::move(entry.data),
+                                  cmd);
+                    continue;
                 }
+                // values for other interface types are processed as individual publications
+                ActionMessage pub(CMD_PUB, cmd.source_id, cmd.dest_id);
+                pub.source_handle = entry.source_handle;
+                pub.dest_handle = entry.dest_handle;
+                pub.actionTime = cmd.actionTime;
+                pub.counter = cmd.counter;
+                pub.setSharedPayload(std::move(entry.data));
+                processDataMessage(pub);
             }
             if (state <= FederateStates::EXECUTING) {
                 timeCoord->processTimeMessage(cmd);
@@ -1951,6 +2026,42 @@ void FederateState::processDataMessage(ActionMessage& cmd)
     }
 }
 
+void FederateState::addInputValue(InputInfo& input,
+                                  GlobalHandle source,
+                                  std::shared_ptr<const SmallBuffer> data,
+                                  const ActionMessage& cmd)
+{
+    for (auto& src : input.input_sources) {
+        if (source.fed_id != src.fed_id || source.handle != src.handle) {
+            continue;
+        }
+        auto valueTime = cmd.actionTime;
+        if (timeMethod == TimeSynchronizationMethod::ASYNC) {
+            if (valueTime < time_granted) {
+                valueTime = time_granted;
+            }
+        }
+        const auto payloadSize = static_cast<std::uint64_t>(data->size());
+        if (input.addData(src, valueTime, cmd.counter, std::move(data))) {
+            if (payloadSize > (std::numeric_limits<std::uint64_t>::max() - queuedValueBytes)) {
+                queuedValueBytes = std::numeric_limits<std::uint64_t>::max();
+            } else {
+                queuedValueBytes += payloadSize;
+            }
+            checkValueBufferWarning();
+            if (!input.not_interruptible) {
+                timeCoord->updateValueTime(valueTime, !timeGranted_mode);
+                LOG_TRACE(timeCoord->printTimeStatus());
+            }
+            LOG_DATA(fmt::format("receive PUBLICATION {} from {}",
+                                 prettyPrintString(cmd),
+                                 input.getSourceName(src)));
+        }
+        // this can only match once
+        break;
+    }
+}
+
 void FederateState::processLoggingMessage(ActionMessage& cmd)
 {
     switch (cmd.action()) {
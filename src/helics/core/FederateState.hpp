@@ -152,6 +152,11 @@ class FederateState {
     Time time_granted{startupTime};  //!< the most recent granted time;
     Time allowed_send_time{startupTime};  //!< the next time a message can be sent;
     Time minimumReceiveTime{startupTime};  //!< minimum receive time for messages
+    /// values of grouped publications waiting to be sent to each destination federate
+    std::map<GlobalFederateId, std::vector<PublicationBatchEntry>> pendingBatches;
+    Time pendingBatchTime{startupTime};  //!< the send time of the pending grouped values
+    std::int32_t pendingBatchIteration{0};  //!< the iteration of the pending grouped values
+    std::size_t pendingBatchBytes{0};  //!< the total size of the pending grouped values
 
 #if __cplusplus >= 201703L
     mutable std::atomic_flag processing{};  //!< the federate is processing
@@ -219,6 +224,20 @@ class FederateState {
      */
     const std::vector<std::shared_ptr<const SmallBuffer>>& getAllValues(InterfaceHandle handle);
 
+    /** add the value of a publication to the pending batches if the publication is grouped
+    @param handle the publication
+    @param subscribers the destinations of the value
+    @param data the value
+    @param[out] readyBatches batches that must be sent before the value, filled in if the pending
+    values are for a different time or iteration or have grown too large
+    @return false if the publication is not grouped and the value was not added*/
+    bool addGroupedValue(InterfaceHandle handle,
+                         const std::vector<GlobalHandle>& subscribers,
+                         const std::shared_ptr<const SmallBuffer>& data,
+                         std::vector<ActionMessage>& readyBatches);
+    /** get the batches for all the pending grouped publication values
+    @details the batches must be sent before any time or mode request of the federate*/
+    std::vector<ActionMessage> takePublicationBatches();
     /** getPublishedValue */
     std::pair<SmallBuffer, Time> getPublishedValue(InterfaceHandle handle);
     /** set the CommonCore object that is managing this Federate*/
@@ -353,10 +372,24 @@ class FederateState {
     @param currentTime the time of the update
     */
     void fillEventVectorNextIteration(Time currentTime);
+    /** add a value from a publication to an input
+    @param input the input to add the value to
+    @param source the publication the value came from
+    @param data the value
+    @param cmd the command carrying the value, it supplies the time and iteration of the value*/
+    void addInputValue(InputInfo& input,
+                       GlobalHandle source,
+                       std::shared_ptr<const SmallBuffer> data,
+                       const ActionMessage& cmd);
+    /** generate the CMD_PUB_BATCH commands for the pending grouped publication values and clear
+     * them*/
+    std::vector<ActionMessage> generatePublicationBatches();
     /** update the queued value byte estimate from the input queues*/
     void updateQueuedValueBytes();
     /** issue a warning if queued future value buffers exceed the configured threshold*/
     void checkValueBufferWarning();
+    /** get a message object for an incoming message, reusing one from the core if available*/
+    std::unique_ptr<Message> acquireMessage();
     /** add a dependency to the timing coordination*/
     void addDependency(GlobalFederateId fedToDependOn);
     /** add a dependent federate*/
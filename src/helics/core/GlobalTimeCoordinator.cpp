@@ -63,12 +63,13 @@ void GlobalTimeCoordinator::sendTimeUpdateRequest(Time triggerTime)
     ActionMessage updateTime(CMD_REQUEST_CURRENT_TIME, mSourceId, mSourceId);
     normalizeSequenceCounter(sequenceCounter);
     updateTime.counter = sequenceCounter;
-    for (auto& dep : dependencies) {
+    for (const auto& dep : dependencies) {
         if (dep.next <= triggerTime && dep.next < cTerminationTime) {
             updateTime.dest_id = dep.fedID;
             updateTime.setExtraDestData(dep.sequenceCounter);
-            dep.updateRequested = true;
-            dep.grantedIteration = sequenceCounter;
+            auto* requested = dependencies.getDependencyInfo(dep.fedID);
+            requested->updateRequested = true;
+            requested->grantedIteration = sequenceCounter;
             sendMessageFunction(updateTime);
         }
     }
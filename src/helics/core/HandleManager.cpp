@@ -303,8 +303,8 @@ BasicHandleInfo* HandleManager::getInterfaceHandle(std::string_view name, Interf
 
     BasicHandleInfo* handle{nullptr};
     auto fnd = imap.find(name);
-    if (fnd != imap.end()) {
-        handle = &handles[fnd->second.baseValue()];
+    if (fnd.isValid()) {
+        handle = &handles[fnd.baseValue()];
         if (type == InterfaceType::TRANSLATOR) {
             if (handle->handleType != InterfaceType::TRANSLATOR) {
                 handle = nullptr;
@@ -324,8 +324,8 @@ const BasicHandleInfo* HandleManager::getInterfaceHandle(std::string_view name,
     const auto& imap = getMap(type);
     const BasicHandleInfo* handle{nullptr};
     auto fnd = imap.find(name);
-    if (fnd != imap.end()) {
-        handle = &handles[fnd->second.baseValue()];
+    if (fnd.isValid()) {
+        handle = &handles[fnd.baseValue()];
         if (type == InterfaceType::TRANSLATOR) {
             if (handle->handleType != InterfaceType::TRANSLATOR) {
                 handle = nullptr;
@@ -354,12 +354,12 @@ std::vector<GlobalHandle> HandleManager::regexSearch(const std::string& regexExp
     }
     try {
         const std::regex rgx(rex);
-        for (const auto& mres : imap) {
-            if (std::regex_match(mres.first.data(), rgx)) {
-                const auto* handle = getHandleInfo(mres.second);
+        imap.forEach([this, &rgx, &matches](std::string_view name, InterfaceHandle index) {
+            if (std::regex_match(name.begin(), name.end(), rgx)) {
+                const auto* handle = getHandleInfo(index);
                 matches.push_back(handle->handle);
             }
-        }
+        });
     }
     catch (const std::regex_error& re) {
         throw std::invalid_argument(re.what());
@@ -454,15 +454,15 @@ void HandleManager::addAlias(std::string_view interfaceName, std::string_view al
 void HandleManager::addPublicationAlias(std::string_view interfaceName, std::string_view alias)
 {
     auto fnd = publications.find(interfaceName);
-    if (fnd != publications.end()) {
-        auto res = publications.try_emplace(alias, fnd->second.baseValue());
-        if (!res.second && res.first->second != fnd->second) {
+    if (fnd.isValid()) {
+        auto res = publications.tryInsert(alias, fnd);
+        if (!res.second && res.first != fnd) {
             throw std::runtime_error("publication name and alias already exists");
         }
     } else {
         fnd = publications.find(alias);
-        if (fnd != publications.end()) {
-            publications.emplace(interfaceName, fnd->second.baseValue());
+        if (fnd.isValid()) {
+            publications.tryInsert(interfaceName, fnd);
         }
     }
 }
@@ -470,15 +470,15 @@ void HandleManager::addPublicationAlias(std::string_view interfaceName, std::str
 void HandleManager::addEndpointAlias(std::string_view interfaceName, std::string_view alias)
 {
     auto fnd = endpoints.find(interfaceName);
-    if (fnd != endpoints.end()) {
-        auto res = endpoints.try_emplace(alias, fnd->second.baseValue());
-        if (!res.second && res.first->second != fnd->second) {
+    if (fnd.isValid()) {
+        auto res = endpoints.tryInsert(alias, fnd);
+        if (!res.second && res.first != fnd) {
             throw std::runtime_error("endpoint name and alias already exists");
         }
     } else {
         fnd = endpoints.find(alias);
-        if (fnd != endpoints.end()) {
-            endpoints.emplace(interfaceName, fnd->second.baseValue());
+        if (fnd.isValid()) {
+            endpoints.tryInsert(interfaceName, fnd);
         }
     }
 }
@@ -486,15 +486,15 @@ void HandleManager::addEndpointAlias(std::string_view interfaceName, std::string
 void HandleManager::addFilterAlias(std::string_view interfaceName, std::string_view alias)
 {
     auto fnd = filters.find(interfaceName);
-    if (fnd != filters.end()) {
-        auto res = filters.try_emplace(alias, fnd->second.baseValue());
-        if (!res.second && res.first->second != fnd->second) {
+    if (fnd.isValid()) {
+        auto res = filters.tryInsert(alias, fnd);
+        if (!res.second && res.first != fnd) {
             throw std::runtime_error("filter name and alias already exists");
         }
     } else {
         fnd = filters.find(alias);
-        if (fnd != filters.end()) {
-            filters.emplace(interfaceName, fnd->second.baseValue());
+        if (fnd.isValid()) {
+            filters.tryInsert(interfaceName, fnd);
         }
     }
 }
@@ -502,15 +502,15 @@ void HandleManager::addFilterAlias(std::string_view interfaceName, std::string_v
 void HandleManager::addInputAlias(std::string_view interfaceName, std::string_view alias)
 {
     auto fnd = inputs.find(interfaceName);
-    if (fnd != inputs.end()) {
-        auto res = inputs.try_emplace(alias, fnd->second.baseValue());
-        if (!res.second && res.first->second != fnd->second) {
+    if (fnd.isValid()) {
+        auto res = inputs.tryInsert(alias, fnd);
+        if (!res.second && res.first != fnd) {
             throw std::runtime_error("input name and alias already exists");
         }
     } else {
         fnd = inputs.find(alias);
-        if (fnd != inputs.end()) {
-            inputs.emplace(interfaceName, fnd->second.baseValue());
+        if (fnd.isValid()) {
+            inputs.tryInsert(interfaceName, fnd);
         }
     }
 }
@@ -541,22 +541,21 @@ bool HandleManager::addAliasName(std::string_view interfaceName, std::string_vie
     return cascading;
 }
 
-using MapType = std::unordered_map<std::string_view, InterfaceHandle>;
 using AliasT = std::unordered_map<std::string_view, std::vector<std::string_view>>;
 static void addFields(std::string_view key,
                       std::string_view typeName,
                       InterfaceHandle hid,
-                      MapType& searchMap,
-                      AliasT aliases)
+                      InterfaceNameIndex& searchMap,
+                      const AliasT& aliases)
 {
-    auto placed = searchMap.try_emplace(key, hid);
+    auto placed = searchMap.tryInsert(key, hid);
     if (!placed.second) {
         throw std::runtime_error(std::string("duplicate ") + std::string(typeName) + " key found");
     }
     auto aliasRange = aliases.find(key);
     if (aliasRange != aliases.end()) {
         for (auto& alias : aliasRange->second) {
-            placed = searchMap.try_emplace(alias, hid);
+            placed = searchMap.tryInsert(alias, hid);
             if (!placed.second) {
                 throw std::runtime_error(std::string("duplicate ") + std::string(typeName) +
                                          " alias key(" + std::string(alias) + ") found");
@@ -598,6 +597,14 @@ void HandleManager::addSearchFields(const BasicHandleInfo& handle, int32_t index
     unique_ids.emplace(static_cast<uint64_t>(handle.handle), index);
 }
 
+void HandleManager::freezeSearchIndex()
+{
+    publications.freeze();
+    endpoints.freeze();
+    inputs.freeze();
+    filters.freeze();
+}
+
 std::string HandleManager::generateName(InterfaceType what) const
 {
     std::string base;
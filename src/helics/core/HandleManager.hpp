@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 #include "BasicHandleInfo.hpp"
 #include "Core.hpp"
+#include "InterfaceNameIndex.hpp"
 #include "helicsTime.hpp"
 
 #include <deque>
@@ -24,7 +25,7 @@ namespace helics {
 */
 class HandleManager {
   private:
-    using MapType = std::unordered_map<std::string_view, InterfaceHandle>;
+    using MapType = InterfaceNameIndex;
     /** use deque here as there are several use cases which use two properties of a deque vs vector
     namely that references are not invalidated by emplace back, which is unlike a vector
     and that the memory growth is a stable and not subject to large copy operations
@@ -111,6 +112,10 @@ class HandleManager {
     /* search for handles based on a regex string and type*/
     std::vector<GlobalHandle> regexSearch(const std::string& regexExpression,
                                           InterfaceType type) const;
+    /** freeze the name search indices
+    @details this should be called once most of the interfaces are registered, any interfaces
+    registered later are still found*/
+    void freezeSearchIndex();
     /** get all the aliases*/
     const std::unordered_map<std::string_view, std::vector<std::string_view>>& getAliases() const
     {
@@ -0,0 +1,169 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "InterfaceNameIndex.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace helics {
+
+/// the name stored in a slot whose name was removed, it never matches a valid name
+static constexpr std::string_view removedName{""};
+
+static std::uint64_t hashName(std::string_view name)
+{
+    return static_cast<std::uint64_t>(std::hash<std::string_view>{}(name));
+}
+
+/** run an operation on a set of indices split across several threads*/
+template<class Operation>
+static void runParallel(std::size_t count, std::size_t threadCount, Operation&& operation)
+{
+    if (threadCount <= 1) {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            operation(ii);
+        }
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (std::size_t tt = 1; tt < threadCount; ++tt) {
+        workers.emplace_back([&operation, tt, count, threadCount]() {
+            for (std::size_t ii = tt; ii < count; ii += threadCount) {
+                operation(ii);
+            }
+        });
+    }
+    for (std::size_t ii = 0; ii < count; ii += threadCount) {
+        operation(ii);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+const InterfaceNameIndex::Slot* InterfaceNameIndex::findFrozen(std::string_view name,
+                                                              std::uint64_t hash) const
+{
+    const auto& shard = shards[shardIndex(hash)];
+    const std::size_t mask = shard.size() - 1;
+    for (auto position = static_cast<std::size_t>(hash) & mask;;
+         position = (position + 1) & mask) {
+        const auto& slot = shard[position];
+        if (slot.name.data() == nullptr) {
+            return nullptr;
+        }
+        if (slot.hash == hash && slot.name == name) {
+            return &slot;
+        }
+    }
+}
+
+InterfaceNameIndex::Slot* InterfaceNameIndex::findFrozen(std::string_view name,
+                                                        std::uint64_t hash)
+{
+    return const_cast<Slot*>(std::as_const(*this).findFrozen(name, hash));
+}
+
+InterfaceHandle InterfaceNameIndex::find(std::string_view name) const
+{
+    if (!shards.empty()) {
+        const auto* slot = findFrozen(name, hashName(name));
+        if (slot != nullptr) {
+            return slot->handle;
+        }
+        if (overlay.empty()) {
+            return {};
+        }
+    }
+    auto fnd = overlay.find(name);
+    return (fnd != overlay.end()) ? fnd->second : InterfaceHandle{};
+}
+
+std::pair<InterfaceHandle, bool> InterfaceNameIndex::tryInsert(std::string_view name,
+                                                               InterfaceHandle handle)
+{
+    if (!shards.empty()) {
+        const auto* slot = findFrozen(name, hashName(name));
+        if (slot != nullptr) {
+            return {slot->handle, false};
+        }
+    }
+    auto res = overlay.try_emplace(name, handle);
+    return {res.first->second, res.second};
+}
+
+void InterfaceNameIndex::erase(std::string_view name)
+{
+    if (!shards.empty()) {
+        auto* slot = findFrozen(name, hashName(name));
+        if (slot != nullptr) {
+            // the slot stays occupied so searches continue past it
+            slot->name = removedName;
+            slot->handle = InterfaceHandle{};
+            --frozenCount;
+            return;
+        }
+    }
+    overlay.erase(name);
+}
+
+void InterfaceNameIndex::freeze()
+{
+    std::vector<Slot> entries;
+    entries.reserve(size());
+    forEach([&entries](std::string_view name, InterfaceHandle handle) {
+        entries.push_back(Slot{0, name, handle});
+    });
+
+    std::size_t threadCount{1};
+    std::size_t shardCount{1};
+    if (entries.size() >= parallelBuildThreshold) {
+        threadCount = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1U, 16U);
+        while (shardCount < threadCount * 4) {
+            shardCount <<= 1U;
+        }
+    }
+    const std::size_t chunk = (entries.size() + threadCount - 1) / threadCount;
+    runParallel(threadCount, threadCount, [&entries, chunk](std::size_t index) {
+        const auto end = std::min(entries.size(), (index + 1) * chunk);
+        for (auto ii = index * chunk; ii < end; ++ii) {
+            entries[ii].hash = hashName(entries[ii].name);
+        }
+    });
+
+    std::vector<std::vector<Slot>> newShards(shardCount);
+    std::vector<std::vector<const Slot*>> shardEntries(shardCount);
+    for (const auto& entry : entries) {
+        shardEntries[static_cast<std::size_t>(entry.hash >> shardShift) & (shardCount - 1)]
+            .push_back(&entry);
+    }
+    runParallel(shardCount, threadCount, [&newShards, &shardEntries](std::size_t index) {
+        const auto& source = shardEntries[index];
+        // keep the tables at most half full so searches stay short
+        std::size_t capacity{8};
+        while (capacity < source.size() * 2) {
+            capacity <<= 1U;
+        }
+        auto& shard = newShards[index];
+        shard.resize(capacity);
+        const std::size_t mask = capacity - 1;
+        for (const auto* entry : source) {
+            auto position = static_cast<std::size_t>(entry->hash) & mask;
+            while (shard[position].name.data() != nullptr) {
+                position = (position + 1) & mask;
+            }
+            shard[position] = *entry;
+        }
+    });
+    shards = std::move(newShards);
+    frozenCount = entries.size();
+    overlay.clear();
+}
+
+}  // namespace helics
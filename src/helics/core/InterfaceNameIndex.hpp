@@ -0,0 +1,83 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "LocalFederateId.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** index mapping interface names to handles
+@details names are added to a hash map while interfaces are being registered.  Freezing the index
+moves all the names into a set of flat open addressing tables, sharded by hash so the shards can
+be built in parallel, which is considerably faster to search when there are large numbers of
+interfaces.  Names added after the index is frozen go into the hash map which then acts as a small
+overlay on the frozen tables.  The names are not copied so the data they reference must remain
+valid for the lifetime of the index.
+*/
+class InterfaceNameIndex {
+  public:
+    /** find the handle associated with a name
+    @return an invalid handle if the name is not in the index*/
+    InterfaceHandle find(std::string_view name) const;
+    /** add a name to the index if it is not already present
+    @return the handle stored for the name and true if the name was inserted*/
+    std::pair<InterfaceHandle, bool> tryInsert(std::string_view name, InterfaceHandle handle);
+    /** remove a name from the index*/
+    void erase(std::string_view name);
+    /** get the number of names in the index*/
+    std::size_t size() const noexcept { return frozenCount + overlay.size(); }
+    /** move all the names into the frozen search tables*/
+    void freeze();
+    /** check if the index has frozen tables*/
+    bool isFrozen() const noexcept { return !shards.empty(); }
+    /** call a function with every name and handle in the index*/
+    template<class Callable>
+    void forEach(Callable&& callback) const
+    {
+        for (const auto& shard : shards) {
+            for (const auto& slot : shard) {
+                if (slot.name.data() != nullptr && slot.handle.isValid()) {
+                    callback(slot.name, slot.handle);
+                }
+            }
+        }
+        for (const auto& entry : overlay) {
+            callback(entry.first, entry.second);
+        }
+    }
+
+    /// the number of names below which the tables are built in a single thread
+    static constexpr std::size_t parallelBuildThreshold{65536};
+
+  private:
+    struct Slot {
+        std::uint64_t hash{0};
+        std::string_view name;  //!< the name, a null data pointer marks an empty slot
+        InterfaceHandle handle;  //!< an invalid handle marks a removed name
+    };
+    /** find the slot containing a name in the frozen tables*/
+    const Slot* findFrozen(std::string_view name, std::uint64_t hash) const;
+    Slot* findFrozen(std::string_view name, std::uint64_t hash);
+    std::size_t shardIndex(std::uint64_t hash) const noexcept
+    {
+        return static_cast<std::size_t>(hash >> shardShift) & (shards.size() - 1);
+    }
+
+    std::vector<std::vector<Slot>> shards;  //!< the frozen open addressing tables
+    std::size_t frozenCount{0};  //!< the number of live names in the frozen tables
+    /// the number of bits to shift a hash to get the shard index
+    static constexpr unsigned int shardShift{48};
+    /// names added since the last freeze
+    std::unordered_map<std::string_view, InterfaceHandle> overlay;
+};
+}  // namespace helics
@@ -0,0 +1,66 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "MessagePool.hpp"
+
+#include <utility>
+
+namespace helics {
+
+MessagePool::MessagePool(std::size_t maxMessages): maxMessageCount(maxMessages)
+{
+    messages.reserve(maxMessageCount);
+}
+
+MessagePool::~MessagePool() = default;
+
+std::unique_ptr<Message> MessagePool::acquire()
+{
+    {
+        const std::lock_guard<std::mutex> lock(poolLock);
+        if (!messages.empty()) {
+            auto message = std::move(messages.back());
+            messages.pop_back();
+            return message;
+        }
+    }
+    return std::make_unique<Message>();
+}
+
+void MessagePool::release(std::unique_ptr<Message> message)
+{
+    if (!message) {
+        return;
+    }
+    // clear the message outside the lock, the strings keep their capacity
+    message->clear();
+    message->messageValidation = 0;
+    message->backReference = nullptr;
+    if (message->data.capacity() > maxRetainedDataSize) {
+        message->data = SmallBuffer();
+    }
+    const std::lock_guard<std::mutex> lock(poolLock);
+    if (messages.size() < maxMessageCount) {
+        messages.push_back(std::move(message));
+    }
+}
+
+std::size_t MessagePool::size() const
+{
+    const std::lock_guard<std::mutex> lock(poolLock);
+    return messages.size();
+}
+
+void MessagePool::clear()
+{
+    std::vector<std::unique_ptr<Message>> released;
+    {
+        const std::lock_guard<std::mutex> lock(poolLock);
+        released.swap(messages);
+    }
+}
+
+}  // namespace helics
@@ -0,0 +1,50 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "core-data.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace helics {
+/** thread safe pool of Message objects
+@details released messages are cleared but keep the memory allocated for their strings and data so
+a recycled message can usually be filled without any allocations.  The pool holds a limited number
+of messages and anything beyond that is deleted.
+*/
+class MessagePool {
+  public:
+    /** construct a pool with a maximum number of messages to hold*/
+    explicit MessagePool(std::size_t maxMessages = defaultCapacity);
+    ~MessagePool();
+    MessagePool(const MessagePool&) = delete;
+    MessagePool& operator=(const MessagePool&) = delete;
+
+    /** get an empty message, reusing a previously released message if one is available*/
+    std::unique_ptr<Message> acquire();
+    /** return a message to the pool for later reuse*/
+    void release(std::unique_ptr<Message> message);
+    /** get the number of messages currently available for reuse*/
+    std::size_t size() const;
+    /** get the maximum number of messages the pool will hold*/
+    std::size_t capacity() const noexcept { return maxMessageCount; }
+    /** delete all the messages held in the pool*/
+    void clear();
+
+    static constexpr std::size_t defaultCapacity{256};
+    /// data buffers larger than this are freed before a message is stored
+    static constexpr std::size_t maxRetainedDataSize{16384};
+
+  private:
+    const std::size_t maxMessageCount;  //!< the maximum number of messages to store
+    mutable std::mutex poolLock;  //!< lock protecting the message storage
+    std::vector<std::unique_ptr<Message>> messages;  //!< the messages available for reuse
+};
+}  // namespace helics
@@ -97,6 +97,9 @@ void PublicationInfo::setProperty(int32_t option, int32_t value)
         case defs::Options::TIME_RESTRICTED:
             minTimeGap = Time(value, time_units::ms);
             break;
+        case defs::Options::PUBLICATION_GROUP:
+            grouped = bvalue;
+            break;
         default:
             break;
     }
@@ -124,6 +127,9 @@ int32_t PublicationInfo::getProperty(int32_t option) const
         case defs::Options::BUFFER_DATA:
             flagval = buffer_data;
             break;
+        case defs::Options::PUBLICATION_GROUP:
+            flagval = grouped;
+            break;
         case defs::Options::CONNECTIONS:
             return static_cast<int32_t>(subscribers.size());
         case defs::Options::TIME_RESTRICTED:
@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -268,7 +269,9 @@ class SmallBuffer {
         usingAllocatedBuffer = true;
         locked = false;
     }
-    /** use other managed memory */
+    /** use other managed memory
+    @details a capacity less than the size makes the span read only, any assignment or resize copies
+    the data to a new buffer before writing*/
     void spanAssign(void* data, std::size_t size, std::size_t capacity)
     {
         auto* newHeap = reinterpret_cast<std::byte*>(data);
@@ -310,7 +313,8 @@ class SmallBuffer {
                 throw(std::bad_alloc());
             }
             auto* ndata = new std::byte[size + 8];
-            std::memcpy(ndata, heap, bufferSize);
+            // a span can have less capacity than size so it is copied before any write
+            std::memcpy(ndata, heap, (std::min)(bufferSize, size));
             if (usingAllocatedBuffer && !nonOwning) {
                 delete[] heap;
             }
@@ -164,6 +164,7 @@ static TimeProcessingResult processMessage(const ActionMessage& cmd, DependencyI
             break;
         case CMD_SEND_MESSAGE:
         case CMD_PUB:
+        case CMD_PUB_BATCH:
             dep.hasData = true;
             break;
         case CMD_REQUEST_CURRENT_TIME:
@@ -350,13 +351,15 @@ DependencyInfo* TimeDependencies::getDependencyInfo(GlobalFederateId gid)
     if ((res == dependencies.end()) || (res->fedID != gid)) {
         return nullptr;
     }
-
+    // the caller may modify the dependency
+    markStale(static_cast<std::size_t>(res - dependencies.begin()));
     return &(*res);
 }
 
 bool TimeDependencies::addDependency(GlobalFederateId gid)
 
 {
+    invalidateTimeIndex();
     if (dependencies.empty()) {
         dependencies.emplace_back(gid);
         dependencies.back().dependency = true;
@@ -387,6 +390,7 @@ bool TimeDependencies::addDependency(GlobalFederateId gid)
 
 void TimeDependencies::removeDependency(GlobalFederateId gid)
 {
+    invalidateTimeIndex();
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), gid, dependencyCompare);
     if (dep != dependencies.end()) {
         if (dep->fedID == gid) {
@@ -401,6 +405,7 @@ void TimeDependencies::removeDependency(GlobalFederateId gid)
 bool TimeDependencies::addDependent(GlobalFederateId gid)
 
 {
+    invalidateTimeIndex();
     if (dependencies.empty()) {
         dependencies.emplace_back(gid);
         dependencies.back().dependent = true;
@@ -425,6 +430,7 @@ bool TimeDependencies::addDependent(GlobalFederateId gid)
 
 void TimeDependencies::removeDependent(GlobalFederateId gid)
 {
+    invalidateTimeIndex();
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), gid, dependencyCompare);
     if (dep != dependencies.end()) {
         if (dep->fedID == gid) {
@@ -438,6 +444,7 @@ void TimeDependencies::removeDependent(GlobalFederateId gid)
 
 void TimeDependencies::resetDependency(GlobalFederateId gid)
 {
+    invalidateTimeIndex();
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), gid, dependencyCompare);
     if (dep != dependencies.end()) {
         if (dep->fedID == gid) {
@@ -450,6 +457,7 @@ void TimeDependencies::resetDependency(GlobalFederateId gid)
 
 void TimeDependencies::removeInterdependence(GlobalFederateId gid)
 {
+    invalidateTimeIndex();
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), gid, dependencyCompare);
     if (dep != dependencies.end()) {
         if (dep->fedID == gid) {
@@ -560,6 +568,17 @@ bool TimeDependencies::checkIfReadyForTimeGrant(bool iterating,
                                                 Time desiredGrantTime,
                                                 GrantDelayMode delayMode) const
 {
+    if (!iterating) {
+        // the index tracks the earliest next time so most checks do not need a scan
+        refreshTimeIndex(indexSelf, indexSequence);
+        const auto minNext = timeIndex[1].minActiveNext;
+        if (minNext >= cTerminationTime || minNext > desiredGrantTime) {
+            return true;
+        }
+        if (minNext < desiredGrantTime) {
+            return false;
+        }
+    }
     if (iterating) {
         return std::all_of(dependencies.begin(),
                            dependencies.end(),
@@ -672,6 +691,7 @@ GlobalFederateId TimeDependencies::getMinDependency() const
 
 void TimeDependencies::resetIteratingExecRequests()
 {
+    invalidateTimeIndex();
     for (auto& dep : dependencies) {
         if (dep.dependency && dep.mTimeState <= TimeState::exec_requested_iterative) {
             dep.mTimeState = TimeState::initialized;
@@ -686,6 +706,7 @@ void TimeDependencies::resetIteratingExecRequests()
 
 void TimeDependencies::resetIteratingTimeRequests(helics::Time requestTime)
 {
+    invalidateTimeIndex();
     for (auto& dep : dependencies) {
         if (dep.dependency && dep.mTimeState == TimeState::time_requested_iterative) {
             if (dep.next == requestTime) {
@@ -699,6 +720,7 @@ void TimeDependencies::resetIteratingTimeRequests(helics::Time requestTime)
 
 void TimeDependencies::resetDependentEvents(helics::Time grantTime)
 {
+    invalidateTimeIndex();
     for (auto& dep : dependencies) {
         if (dep.dependency) {
             dep.Te = (std::max)(dep.next, grantTime);
@@ -727,6 +749,14 @@ std::pair<int, std::string> TimeDependencies::checkForIssues(bool waiting) const
     return {0, ""};
 }
 
+// check if the minimum dependent event reported by a dependency must be valid to be used
+static bool requiresValidMinDe(const DependencyInfo& dep, std::int32_t sequenceCode)
+{
+    return dep.connection != ConnectionType::SELF &&
+        (sequenceCode == 0 || dep.responseSequenceCounter == sequenceCode ||
+         dep.timingVersion == 0 || !dep.dependent);
+}
+
 static void generateMinTimeImplementation(TimeData& mTime,
                                           const DependencyInfo& dep,
                                           GlobalFederateId ignore,
@@ -785,9 +815,7 @@ static void generateMinTimeImplementation(TimeData& mTime,
         return;
     }
 
-    if (dep.connection != ConnectionType::SELF &&
-        (sequenceCode == 0 || dep.responseSequenceCounter == sequenceCode ||
-         dep.timingVersion == 0 || !dep.dependent)) {
+    if (requiresValidMinDe(dep, sequenceCode)) {
         if (dep.minDe >= dep.next) {
             if (dep.minDe < mTime.minDe) {
                 mTime.minDe = dep.minDe;
@@ -853,6 +881,187 @@ static void generateMinTimeImplementation(TimeData& mTime,
     // }
 }
 
+static bool isIterativeRequest(TimeState state)
+{
+    return state == TimeState::time_requested_iterative ||
+        state == TimeState::time_requested_require_iteration;
+}
+
+// generate the summary for a single dependency
+static void generateLeafSummary(DependencyTimeSummary& summary,
+                                const DependencyInfo& dep,
+                                std::int32_t responseCode)
+{
+    summary = DependencyTimeSummary{};
+    summary.count = 1;
+    summary.iterationCount = dep.sequenceCounter;
+    // dependencies before the first grant follow different rules and are left to a full scan
+    if (dep.mTimeState < TimeState::time_granted || !dep.fedID.isValid()) {
+        summary.irregularCount = 1;
+        return;
+    }
+    generateMinTimeImplementation(summary.time, dep, GlobalFederateId{}, responseCode);
+    if (isIterativeRequest(dep.mTimeState)) {
+        summary.minIterativeState = dep.mTimeState;
+    }
+    summary.grantedAtNext = (dep.mTimeState == TimeState::time_granted);
+    summary.clearsInterrupt = summary.grantedAtNext || !dep.interrupted;
+    summary.minDeInvalid = requiresValidMinDe(dep, responseCode) && dep.minDe < dep.next;
+    summary.actualTe = dep.Te;
+}
+
+/* combine the summaries of two adjacent ranges, this must produce the same result as running
+generateMinTimeImplementation over the dependencies of the first range followed by the second*/
+static void mergeSummary(DependencyTimeSummary& result,
+                         const DependencyTimeSummary& first,
+                         const DependencyTimeSummary& second)
+{
+    if (second.count == 0) {
+        result = first;
+        return;
+    }
+    if (first.count == 0) {
+        result = second;
+        return;
+    }
+    result = first;
+    result.count += second.count;
+    result.irregularCount += second.irregularCount;
+    result.iterationCount += second.iterationCount;
+    if (result.irregularCount > 0) {
+        return;
+    }
+    auto& mTime = result.time;
+    const auto& sTime = second.time;
+
+    // an invalid dependent event resets the minimum so anything before it is irrelevant
+    mTime.minDe = second.minDeInvalid ? sTime.minDe : std::min(mTime.minDe, sTime.minDe);
+    result.minDeInvalid = first.minDeInvalid || second.minDeInvalid;
+
+    if (sTime.next < mTime.next) {
+        mTime.next = sTime.next;
+        mTime.mTimeState = sTime.mTimeState;
+        mTime.interrupted = sTime.interrupted;
+        result.minIterativeState = second.minIterativeState;
+        result.grantedAtNext = second.grantedAtNext;
+        result.clearsInterrupt = second.clearsInterrupt;
+    } else if (sTime.next == mTime.next) {
+        // apply the dependencies of the second range at the same time to the first
+        if (second.minIterativeState != TimeState::error) {
+            mTime.mTimeState = isIterativeRequest(mTime.mTimeState) ?
+                std::min(mTime.mTimeState, second.minIterativeState) :
+                second.minIterativeState;
+        } else if (second.grantedAtNext && !isIterativeRequest(mTime.mTimeState)) {
+            mTime.mTimeState = TimeState::time_granted;
+        }
+        if (second.clearsInterrupt) {
+            mTime.interrupted = false;
+        }
+        result.minIterativeState = std::min(first.minIterativeState, second.minIterativeState);
+        result.grantedAtNext = first.grantedAtNext || second.grantedAtNext;
+        result.clearsInterrupt = first.clearsInterrupt || second.clearsInterrupt;
+    }
+
+    if (sTime.Te < mTime.Te) {
+        mTime.TeAlt = std::min(mTime.Te, sTime.TeAlt);
+        mTime.minFed = sTime.minFed;
+        mTime.sequenceCounter = sTime.sequenceCounter;
+        mTime.responseSequenceCounter = sTime.responseSequenceCounter;
+        // only the dependencies of the second range earlier than the first range count
+        if (sTime.minFedActual.isValid() && second.actualTe < mTime.Te) {
+            mTime.minFedActual = sTime.minFedActual;
+            result.actualTe = second.actualTe;
+        }
+        mTime.Te = sTime.Te;
+    } else if (sTime.Te == mTime.Te) {
+        mTime.minFed = GlobalFederateId{};
+        mTime.TeAlt = mTime.Te;
+    }
+}
+
+void TimeDependencies::markStale(std::size_t position) const
+{
+    if (!indexValid) {
+        return;
+    }
+    if (staleEntries.size() >= dependencies.size()) {
+        // it is cheaper to rebuild the whole index
+        indexValid = false;
+        return;
+    }
+    staleEntries.push_back(position);
+}
+
+void TimeDependencies::updateIndexLeaf(std::size_t position) const
+{
+    auto& leaf = timeIndex[leafOffset + position];
+    leaf = IndexNode{};
+    const auto& dep = dependencies[position];
+    if (!dep.dependency) {
+        return;
+    }
+    if (dep.connection != ConnectionType::SELF) {
+        leaf.minActiveNext = dep.next;
+    }
+    if (indexSelf.isValid() && dep.minFedActual == indexSelf) {
+        return;
+    }
+    auto& total = leaf.sets[static_cast<std::size_t>(TimeSet::TOTAL)];
+    generateLeafSummary(total, dep, indexSequence);
+    const auto direction =
+        (dep.connection == ConnectionType::PARENT) ? TimeSet::DOWNSTREAM : TimeSet::UPSTREAM;
+    leaf.sets[static_cast<std::size_t>(direction)] = total;
+}
+
+void TimeDependencies::mergeIndexNode(std::size_t node) const
+{
+    auto& result = timeIndex[node];
+    const auto& first = timeIndex[2 * node];
+    const auto& second = timeIndex[2 * node + 1];
+    for (std::size_t ii = 0; ii < result.sets.size(); ++ii) {
+        mergeSummary(result.sets[ii], first.sets[ii], second.sets[ii]);
+    }
+    result.minActiveNext = std::min(first.minActiveNext, second.minActiveNext);
+}
+
+void TimeDependencies::refreshTimeIndex(GlobalFederateId self, std::int32_t responseCode) const
+{
+    if (indexValid && self == indexSelf && responseCode == indexSequence) {
+        for (auto position : staleEntries) {
+            updateIndexLeaf(position);
+            for (auto node = (leafOffset + position) / 2; node > 0; node /= 2) {
+                mergeIndexNode(node);
+            }
+        }
+        staleEntries.clear();
+        return;
+    }
+    indexSelf = self;
+    indexSequence = responseCode;
+    leafOffset = 1;
+    while (leafOffset < dependencies.size()) {
+        leafOffset *= 2;
+    }
+    timeIndex.assign(2 * leafOffset, IndexNode{});
+    for (std::size_t ii = 0; ii < dependencies.size(); ++ii) {
+        updateIndexLeaf(ii);
+    }
+    for (auto node = leafOffset - 1; node > 0; --node) {
+        mergeIndexNode(node);
+    }
+    staleEntries.clear();
+    indexValid = true;
+}
+
+const DependencyTimeSummary* TimeDependencies::getTimeSummary(TimeSet set,
+                                                              GlobalFederateId self,
+                                                              std::int32_t responseCode) const
+{
+    refreshTimeIndex(self, responseCode);
+    const auto& summary = timeIndex[1].sets[static_cast<std::size_t>(set)];
+    return (summary.irregularCount == 0) ? &summary : nullptr;
+}
+
 const DependencyInfo& getExecEntryMinFederate(const TimeDependencies& dependencies,
                                               GlobalFederateId self,
                                               ConnectionType ignoreType,
@@ -902,18 +1111,26 @@ TimeData generateMinTimeUpstream(const TimeDependencies& dependencies,
 {
     TimeData mTime(Time::maxVal(), TimeState::error);
     std::int32_t iterationCount{0};
-    for (const auto& dep : dependencies) {
-        if (!dep.dependency) {
-            continue;
-        }
-        if (dep.connection == ConnectionType::PARENT) {
-            continue;
-        }
-        if (self.isValid() && dep.minFedActual == self) {
-            continue;
+    const auto* summary = ignore.isValid() ?
+        nullptr :
+        dependencies.getTimeSummary(TimeDependencies::TimeSet::UPSTREAM, self, responseCode);
+    if (summary != nullptr) {
+        mTime = summary->time;
+        iterationCount = summary->iterationCount;
+    } else {
+        for (const auto& dep : dependencies) {
+            if (!dep.dependency) {
+                continue;
+            }
+            if (dep.connection == ConnectionType::PARENT) {
+                continue;
+            }
+            if (self.isValid() && dep.minFedActual == self) {
+                continue;
+            }
+            iterationCount += dep.sequenceCounter;
+            generateMinTimeImplementation(mTime, dep, ignore, responseCode);
         }
-        iterationCount += dep.sequenceCounter;
-        generateMinTimeImplementation(mTime, dep, ignore, responseCode);
     }
     if (mTime.Te < mTime.minDe) {
         mTime.minDe = mTime.Te;
@@ -940,17 +1157,24 @@ TimeData generateMinTimeDownstream(const TimeDependencies& dependencies,
                                    std::int32_t responseCode)
 {
     TimeData mTime(Time::maxVal(), TimeState::error);
-    for (const auto& dep : dependencies) {
-        if (!dep.dependency) {
-            continue;
-        }
-        if (dep.connection != ConnectionType::PARENT) {
-            continue;
-        }
-        if (self.isValid() && dep.minFedActual == self) {
-            continue;
+    const auto* summary = ignore.isValid() ?
+        nullptr :
+        dependencies.getTimeSummary(TimeDependencies::TimeSet::DOWNSTREAM, self, responseCode);
+    if (summary != nullptr) {
+        mTime = summary->time;
+    } else {
+        for (const auto& dep : dependencies) {
+            if (!dep.dependency) {
+                continue;
+            }
+            if (dep.connection != ConnectionType::PARENT) {
+                continue;
+            }
+            if (self.isValid() && dep.minFedActual == self) {
+                continue;
+            }
+            generateMinTimeImplementation(mTime, dep, ignore, responseCode);
         }
-        generateMinTimeImplementation(mTime, dep, ignore, responseCode);
     }
     if (mTime.Te < mTime.minDe) {
         mTime.minDe = mTime.Te;
@@ -982,15 +1206,22 @@ TimeData generateMinTimeTotal(const TimeDependencies& dependencies,
                               std::int32_t responseCode)
 {
     TimeData mTime(Time::maxVal(), TimeState::error);
-    for (const auto& dep : dependencies) {
-        if (!dep.dependency) {
-            continue;
-        }
+    const auto* summary = ignore.isValid() ?
+        nullptr :
+        dependencies.getTimeSummary(TimeDependencies::TimeSet::TOTAL, self, responseCode);
+    if (summary != nullptr) {
+        mTime = summary->time;
+    } else {
+        for (const auto& dep : dependencies) {
+            if (!dep.dependency) {
+                continue;
+            }
 
-        if (self.isValid() && dep.minFedActual == self) {
-            continue;
+            if (self.isValid() && dep.minFedActual == self) {
+                continue;
+            }
+            generateMinTimeImplementation(mTime, dep, ignore, responseCode);
         }
-        generateMinTimeImplementation(mTime, dep, ignore, responseCode);
     }
 
     if (mTime.Te < mTime.minDe) {
@@ -9,6 +9,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "basic_CoreTypes.hpp"
 #include "nlohmann/json_fwd.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
@@ -125,11 +128,67 @@ class DependencyInfo: public TimeData {
     }
 };
 
-/** class for managing a set of dependencies*/
+/** summary of the minimum times over a range of dependencies
+@details contains the result of the minimum time calculation over the range along with the extra
+information needed to combine the summaries of two adjacent ranges into the same result as a single
+pass over both ranges*/
+class DependencyTimeSummary {
+  public:
+    TimeData time{Time::maxVal(), TimeState::error};  //!< the minimum times of the range
+    Time actualTe{Time::maxVal()};  //!< the event time of the dependency supplying minFedActual
+    /// the lowest iterative request state of the dependencies at time.next
+    TimeState minIterativeState{TimeState::error};
+    bool grantedAtNext{false};  //!< a dependency at time.next is granted
+    bool clearsInterrupt{false};  //!< a dependency at time.next clears the interrupted flag
+    bool minDeInvalid{false};  //!< a dependency reported a minimum dependent event before next
+    std::int32_t iterationCount{0};  //!< the sum of the sequence counters
+    std::int32_t count{0};  //!< the number of dependencies in the range
+    /// the number of dependencies in the range which are not in a state the summary can represent
+    std::int32_t irregularCount{0};
+};
+
+/** class for managing a set of dependencies
+@details in addition to the sorted dependency vector an index tree of the minimum times is
+maintained so the minimum time calculations do not need to scan every dependency on every timing
+message.  Each message updates a single leaf of the tree and the minimums are refreshed in
+logarithmic time when they are next needed.  The indexed values must only be modified through
+updateTime or getDependencyInfo so the index can track the changes.
+*/
 class TimeDependencies {
+  public:
+    /** the sets of dependencies which are tracked in the time index*/
+    enum class TimeSet : std::uint8_t {
+        TOTAL = 0,  //!< all dependencies
+        UPSTREAM = 1,  //!< dependencies other than parents
+        DOWNSTREAM = 2  //!< parent dependencies
+    };
+
   private:
+    struct IndexNode {
+        std::array<DependencyTimeSummary, 3> sets;  //!< summaries of each TimeSet
+        Time minActiveNext{Time::maxVal()};  //!< the minimum next time of active dependencies
+    };
     std::vector<DependencyInfo> dependencies;  //!< container
     mutable GlobalFederateId mDelayedDependency{};
+    /// tree of the minimum times, the leaves are stored in the second half
+    mutable std::vector<IndexNode> timeIndex;
+    /// positions of dependencies which have changed since the index was last refreshed
+    mutable std::vector<std::size_t> staleEntries;
+    mutable std::size_t leafOffset{0};  //!< the location of the first leaf in timeIndex
+    mutable GlobalFederateId indexSelf{};  //!< the federate excluded from the index
+    mutable std::int32_t indexSequence{0};  //!< the response code used to build the index
+    mutable bool indexValid{false};  //!< the index matches the dependency vector
+
+    /** mark the time index as needing a complete rebuild*/
+    void invalidateTimeIndex() { indexValid = false; }
+    /** mark a single dependency as changed*/
+    void markStale(std::size_t position) const;
+    /** bring the time index up to date with the dependencies*/
+    void refreshTimeIndex(GlobalFederateId self, std::int32_t responseCode) const;
+    /** recompute the leaf for a dependency*/
+    void updateIndexLeaf(std::size_t position) const;
+    /** recompute an interior node of the tree from its children*/
+    void mergeIndexNode(std::size_t node) const;
 
   public:
     /** default constructor*/
@@ -156,10 +215,10 @@ class TimeDependencies {
     TimeProcessingResult updateTime(const ActionMessage& cmd);
     /** get the number of dependencies*/
     auto size() const { return dependencies.size(); }
-    /** iterator to first dependency*/
-    auto begin() { return dependencies.begin(); }
+    /** iterator to first dependency, the dependencies must be modified through getDependencyInfo*/
+    auto begin() { return dependencies.cbegin(); }
     /** iterator to end point*/
-    auto end() { return dependencies.end(); }
+    auto end() { return dependencies.cend(); }
     /**  const iterator to first dependency*/
     auto begin() const { return dependencies.cbegin(); }
     /** const iterator to end point*/
@@ -174,8 +233,17 @@ class TimeDependencies {
     /** get a pointer to the dependency information for a particular object*/
     const DependencyInfo* getDependencyInfo(GlobalFederateId gid) const;
 
-    /** get a pointer to the dependency information for a particular object*/
+    /** get a pointer to the dependency information for a particular object to modify
+    @details the pointer must not be used after any other call modifying the dependencies*/
     DependencyInfo* getDependencyInfo(GlobalFederateId gid);
+    /** get the summary of the minimum times of a set of dependencies
+    @param set the set of dependencies to summarize
+    @param self dependencies whose minimum federate is self are excluded
+    @param responseCode the sequence code used to select the valid dependent event times
+    @return a pointer to the summary, nullptr if the set has dependencies that require a full
+    calculation, the pointer is valid until the dependencies are modified*/
+    const DependencyTimeSummary*
+        getTimeSummary(TimeSet set, GlobalFederateId self, std::int32_t responseCode) const;
 
     /** check if the dependencies would allow entry to exec mode*/
     bool checkIfReadyForExecEntry(bool iterating, bool waiting) const;
@@ -206,7 +274,11 @@ class TimeDependencies {
     /** get a count of the active dependencies*/
     GlobalFederateId getMinDependency() const;
 
-    void setDependencyVector(const std::vector<DependencyInfo>& deps) { dependencies = deps; }
+    void setDependencyVector(const std::vector<DependencyInfo>& deps)
+    {
+        dependencies = deps;
+        invalidateTimeIndex();
+    }
     /** check the dependency set for any issues
     @return an error code and string containing an error description */
     std::pair<int, std::string> checkForIssues(bool waiting) const;
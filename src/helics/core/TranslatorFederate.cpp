@@ -283,6 +283,21 @@ void TranslatorFederate::handleMessage(ActionMessage& command)
                 executeTranslator(command, tranI);
             }
         } break;
+        case CMD_PUB_BATCH: {
+            // the translators handle the values of a batch one at a time
+            ActionMessage pub(CMD_PUB, command.source_id, command.dest_id);
+            pub.actionTime = command.actionTime;
+            pub.counter = command.counter;
+            for (auto& entry : unpackPublicationBatch(command)) {
+                auto* tranI = getTranslatorInfo(mFedID, entry.dest_handle);
+                if (tranI != nullptr) {
+                    pub.source_handle = entry.source_handle;
+                    pub.dest_handle = entry.dest_handle;
+                    pub.setSharedPayload(std::move(entry.data));
+                    executeTranslator(pub, tranI);
+                }
+            }
+        } break;
         default:
             break;
     }
@@ -64,6 +64,8 @@ std::string to_string(CoreType type)
             return "nng_";
         case CoreType::INPROC:
             return "inproc_";
+        case CoreType::SHM:
+            return "shm_";
         case CoreType::WEBSOCKET:
             return "websocket_";
         case CoreType::NULLCORE:
@@ -74,7 +76,7 @@ std::string to_string(CoreType type)
             return {};
     }
 }
-static constexpr frozen::unordered_map<std::string_view, CoreType, 57> coreTypes{
+static constexpr frozen::unordered_map<std::string_view, CoreType, 60> coreTypes{
     {"default", CoreType::DEFAULT},
     {"def", CoreType::DEFAULT},
     {"mpi", CoreType::MPI},
@@ -123,6 +125,9 @@ static constexpr frozen::unordered_map<std::string_view, CoreType, 57> coreTypes
     {"websocket", CoreType::WEBSOCKET},
     {"web", CoreType::WEBSOCKET},
     {"inproc", CoreType::INPROC},
+    {"shm", CoreType::SHM},
+    {"SHM", CoreType::SHM},
+    {"sharedmem", CoreType::SHM},
     {"nng", CoreType::NNG},
     {"null", CoreType::NULLCORE},
     {"nullcore", CoreType::NULLCORE},
@@ -170,6 +175,9 @@ CoreType coreTypeFromString(std::string_view type) noexcept
     if (type.compare(0, 3, "ipc") == 0) {
         return CoreType::INTERPROCESS;
     }
+    if (type.compare(0, 3, "shm") == 0) {
+        return CoreType::SHM;
+    }
     if (type.compare(0, 4, "test") == 0) {
         return CoreType::TEST;
     }
@@ -231,6 +239,12 @@ static bool constexpr ipc_availability{false};
 static bool constexpr ipc_availability{true};
 #endif
 
+#ifndef HELICS_ENABLE_SHM_CORE
+static bool constexpr shm_availability{false};
+#else
+static bool constexpr shm_availability{true};
+#endif
+
 #ifndef HELICS_ENABLE_TEST_CORE
 static bool constexpr test_availability{false};
 #else
@@ -262,6 +276,9 @@ bool isCoreTypeAvailable(CoreType type) noexcept
         case CoreType::IPC:
             available = ipc_availability;
             break;
+        case CoreType::SHM:
+            available = shm_availability;
+            break;
         case CoreType::UDP:
             available = udp_availability;
             break;
@@ -171,7 +171,8 @@ namespace defs {
         INPUT_PRIORITY_LOCATION = HELICS_HANDLE_OPTION_INPUT_PRIORITY_LOCATION,
         CLEAR_PRIORITY_LIST = HELICS_HANDLE_OPTION_CLEAR_PRIORITY_LIST,
         CONNECTIONS = HELICS_HANDLE_OPTION_CONNECTIONS,
-        TIME_RESTRICTED = HELICS_HANDLE_OPTION_TIME_RESTRICTED
+        TIME_RESTRICTED = HELICS_HANDLE_OPTION_TIME_RESTRICTED,
+        PUBLICATION_GROUP = HELICS_HANDLE_OPTION_PUBLICATION_GROUP
     };
 
 }  // namespace defs
@@ -463,6 +463,19 @@ class ValueFederate: public virtual Federate {
 
     /** clear all the update flags from all federate inputs*/
     void clearUpdates() { helicsFederateClearUpdates(fed); }
+    /** get the values of a set of inputs as doubles in a single call
+    @param inputs the inputs to get the values of
+    @param values the vector to store the values in, resized to match the inputs
+    @return the number of inputs that had an update*/
+    int getInputDoubles(const std::vector<HelicsInput>& inputs, std::vector<double>& values)
+    {
+        values.resize(inputs.size());
+        if (inputs.empty()) {
+            return 0;
+        }
+        return helicsFederateGetInputDoubles(
+            fed, &inputs[0], static_cast<int>(inputs.size()), &values[0], hThrowOnError());
+    }
     /** publish data contained in a JSON file*/
     void publishJSON(const std::string& json)
     {
@@ -42,6 +42,7 @@ set(helics_shared_private_headers
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/TranslatorOperations.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/ConnectorFederateManager.hpp
     ${HELICS_LIBRARY_SOURCE_DIR}/application_api/PotentialInterfacesManager.hpp
+    ${HELICS_LIBRARY_SOURCE_DIR}/application_api/valueParsing.hpp
 )
 
 set(conv_headers
@@ -53,6 +53,9 @@ typedef enum { /* NOLINT */
                                                 memory it is pretty similar to the test core but
                   stripped from the "test" components*/
                HELICS_CORE_TYPE_INPROC = 18,
+               /** use lock free ring buffers in shared memory to transfer data (for use when all
+                  federates are on the same machine)*/
+               HELICS_CORE_TYPE_SHM = 19,
                /** an explicit core type that is recognized but explicitly doesn't
                                              exist, for testing and a few other assorted reasons*/
                HELICS_CORE_TYPE_NULL = 66,
@@ -386,7 +389,10 @@ typedef enum { /* NOLINT */
                   connections*/
                HELICS_HANDLE_OPTION_CONNECTIONS = 522,
                /** specify that the interface only sends or receives data at specified intervals*/
-               HELICS_HANDLE_OPTION_TIME_RESTRICTED = 557
+               HELICS_HANDLE_OPTION_TIME_RESTRICTED = 557,
+               /** specify that the values of a publication are sent together with the other
+                  publications in the group of the federate (only applicable to publications)*/
+               HELICS_HANDLE_OPTION_PUBLICATION_GROUP = 562
 } HelicsHandleOptions;
 
 /** enumeration of the predefined filter types*/
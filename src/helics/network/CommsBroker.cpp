@@ -16,6 +16,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #    include "ipc/IpcComms.h"
 #endif
 
+#ifdef HELICS_ENABLE_SHM_CORE
+#    include "shm/ShmComms.h"
+#endif
+
 #ifdef HELICS_ENABLE_UDP_CORE
 #    include "udp/UdpComms.h"
 #endif
@@ -48,6 +52,11 @@ template class CommsBroker<ipc::IpcComms, CoreBroker>;
 template class CommsBroker<ipc::IpcComms, CommonCore>;
 #endif
 
+#ifdef HELICS_ENABLE_SHM_CORE
+template class CommsBroker<shm::ShmComms, CoreBroker>;
+template class CommsBroker<shm::ShmComms, CommonCore>;
+#endif
+
 #ifdef HELICS_ENABLE_ZMQ_CORE
 template class CommsBroker<zeromq::ZmqComms, CoreBroker>;
 template class CommsBroker<zeromq::ZmqComms, CommonCore>;
@@ -50,5 +50,6 @@ class CommsBroker: public BrokerT {
     virtual void removeRoute(route_id rid) override;
     /** get a pointer to the comms object*/
     COMMS* getCommsObjectPointer();
+    virtual std::string commsQuery(std::string_view request) const override;
 };
 }  // namespace helics
@@ -125,4 +125,10 @@ COMMS* CommsBroker<COMMS, BrokerT>::getCommsObjectPointer()
     return comms.get();
 }
 
+template<class COMMS, class BrokerT>
+std::string CommsBroker<COMMS, BrokerT>::commsQuery(std::string_view request) const
+{
+    return (comms) ? comms->query(request) : std::string{};
+}
+
 }  // namespace helics
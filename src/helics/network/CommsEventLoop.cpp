@@ -0,0 +1,197 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "CommsEventLoop.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <utility>
+
+namespace helics {
+
+struct CommsEventLoop::WorkQueue {
+    std::mutex lock;
+    std::condition_variable available;
+    std::deque<std::function<void()>> tasks;
+    bool halt{false};
+};
+
+namespace {
+    std::mutex sharedLoopLock;
+    std::weak_ptr<CommsEventLoop> sharedLoop;
+    int sharedThreadCount{2};
+}  // namespace
+
+CommsEventLoop::CommsEventLoop(int threadCount): queue(std::make_shared<WorkQueue>())
+{
+    threadCount = std::max(threadCount, 1);
+    threads.reserve(threadCount);
+    for (int ii = 0; ii < threadCount; ++ii) {
+        // the threads hold the queue so it outlives the loop if a thread has to be detached
+        threads.emplace_back([work = queue]() {
+            std::unique_lock<std::mutex> lock(work->lock);
+            while (true) {
+                work->available.wait(lock, [&work]() { return work->halt || !work->tasks.empty(); });
+                if (work->halt) {
+                    break;
+                }
+                auto task = std::move(work->tasks.front());
+                work->tasks.pop_front();
+                lock.unlock();
+                task();
+                // release anything the task captured before waiting again
+                task = nullptr;
+                lock.lock();
+            }
+        });
+    }
+}
+
+CommsEventLoop::~CommsEventLoop()
+{
+    {
+        const std::lock_guard<std::mutex> lock(queue->lock);
+        queue->halt = true;
+        queue->tasks.clear();
+    }
+    queue->available.notify_all();
+    for (auto& thread : threads) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            // the last reference was released by a task running on the loop
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+}
+
+std::shared_ptr<CommsEventLoop> CommsEventLoop::getSharedLoop()
+{
+    const std::lock_guard<std::mutex> lock(sharedLoopLock);
+    auto loop = sharedLoop.lock();
+    if (!loop) {
+        loop = std::make_shared<CommsEventLoop>(sharedThreadCount);
+        sharedLoop = loop;
+    }
+    return loop;
+}
+
+void CommsEventLoop::setSharedThreadCount(int threadCount)
+{
+    const std::lock_guard<std::mutex> lock(sharedLoopLock);
+    sharedThreadCount = std::max(threadCount, 1);
+}
+
+void CommsEventLoop::post(std::function<void()> task)
+{
+    {
+        const std::lock_guard<std::mutex> lock(queue->lock);
+        if (queue->halt) {
+            return;
+        }
+        queue->tasks.push_back(std::move(task));
+    }
+    queue->available.notify_one();
+}
+
+namespace {
+    /// the task is not scheduled or running
+    constexpr int taskIdle{0};
+    /// a run of the task is waiting on the loop
+    constexpr int taskScheduled{1};
+    /// the task is running
+    constexpr int taskRunning{2};
+    /// the task was triggered while running and runs again before it finishes
+    constexpr int taskRerun{3};
+}  // namespace
+
+struct CommsEventTask::TaskState {
+    std::mutex runLock;  //!< held while the process function runs
+    std::function<void()> process;
+    std::atomic<int> status{taskIdle};
+    std::atomic<bool> cancelled{false};
+    std::atomic<std::chrono::steady_clock::rep> scheduleTime{0};
+    mutable std::mutex statsLock;
+    EventLoopStatistics stats;
+};
+
+CommsEventTask::CommsEventTask(std::shared_ptr<CommsEventLoop> eventLoop,
+                               std::function<void()> process):
+    state(std::make_shared<TaskState>()), loop(std::move(eventLoop))
+{
+    state->process = std::move(process);
+}
+
+CommsEventTask::~CommsEventTask()
+{
+    cancel();
+}
+
+void CommsEventTask::trigger()
+{
+    auto current = state->status.load();
+    int next{taskScheduled};
+    do {
+        if (current == taskScheduled || current == taskRerun) {
+            return;
+        }
+        next = (current == taskRunning) ? taskRerun : taskScheduled;
+    } while (!state->status.compare_exchange_weak(current, next));
+    state->scheduleTime.store(std::chrono::steady_clock::now().time_since_epoch().count());
+    if (next == taskRerun) {
+        // the running task picks this up before it finishes so it never holds a second thread
+        return;
+    }
+    loop->post([taskState = state]() {
+        const std::lock_guard<std::mutex> runLock(taskState->runLock);
+        taskState->status.store(taskRunning);
+        while (true) {
+            const auto start = std::chrono::steady_clock::now();
+            const auto latency =
+                start - std::chrono::steady_clock::time_point(
+                            std::chrono::steady_clock::duration(taskState->scheduleTime.load()));
+            if (!taskState->process || taskState->cancelled.load()) {
+                taskState->status.store(taskIdle);
+                return;
+            }
+            taskState->process();
+            const auto busy = std::chrono::steady_clock::now() - start;
+            {
+                const std::lock_guard<std::mutex> statsLock(taskState->statsLock);
+                auto& stats = taskState->stats;
+                ++stats.runs;
+                stats.totalLatency += latency;
+                stats.maxLatency =
+                    std::max(stats.maxLatency,
+                             std::chrono::duration_cast<std::chrono::nanoseconds>(latency));
+                stats.busyTime += busy;
+            }
+            int expected{taskRunning};
+            if (taskState->status.compare_exchange_strong(expected, taskIdle)) {
+                return;
+            }
+            // triggered during the run so run again
+            taskState->status.store(taskRunning);
+        }
+    });
+}
+
+void CommsEventTask::cancel()
+{
+    // stops a run that keeps getting triggered from looping
+    state->cancelled.store(true);
+    const std::lock_guard<std::mutex> runLock(state->runLock);
+    state->process = nullptr;
+}
+
+EventLoopStatistics CommsEventTask::statistics() const
+{
+    const std::lock_guard<std::mutex> statsLock(state->statsLock);
+    return state->stats;
+}
+
+}  // namespace helics
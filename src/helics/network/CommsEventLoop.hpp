@@ -0,0 +1,89 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helics {
+
+/** a small pool of threads shared by the comms objects of a process
+@details comms objects that use the event loop do not have threads of their own, they schedule
+their processing on the loop whenever there is work to do.  A single loop is shared by every comms
+object in the process, it is created when the first one needs it and stopped when the last one
+releases it*/
+class CommsEventLoop {
+  public:
+    /** create an event loop with a specific number of threads*/
+    explicit CommsEventLoop(int threadCount);
+    /** stop the threads, tasks that have not started are discarded*/
+    ~CommsEventLoop();
+    CommsEventLoop(const CommsEventLoop&) = delete;
+    CommsEventLoop& operator=(const CommsEventLoop&) = delete;
+
+    /** get the event loop shared by the comms objects of the process*/
+    static std::shared_ptr<CommsEventLoop> getSharedLoop();
+    /** set the number of threads the shared loop uses
+    @details only has an effect if the shared loop is not currently running*/
+    static void setSharedThreadCount(int threadCount);
+
+    /** queue a task to run on one of the threads*/
+    void post(std::function<void()> task);
+    /** get the number of threads in the loop*/
+    int threadCount() const { return static_cast<int>(threads.size()); }
+
+  private:
+    struct WorkQueue;
+    std::shared_ptr<WorkQueue> queue;
+    std::vector<std::thread> threads;
+};
+
+/** counters describing how quickly an event loop task is serviced*/
+struct EventLoopStatistics {
+    std::uint64_t runs{0};  //!< the number of times the task ran
+    std::chrono::nanoseconds totalLatency{0};  //!< total time between scheduling and running
+    std::chrono::nanoseconds maxLatency{0};  //!< the longest time between scheduling and running
+    std::chrono::nanoseconds busyTime{0};  //!< total time spent running the task
+};
+
+/** a repeatable unit of work scheduled on an event loop
+@details triggering the task schedules one run of the processing function, triggers while a run is
+already scheduled are merged into that run.  Triggers while the function is running make it run
+again before the task gives up its thread, so a task never occupies more than one thread of the
+loop.  Runs never overlap so the processing function does not need to be thread safe with respect
+to itself*/
+class CommsEventTask {
+  public:
+    CommsEventTask(std::shared_ptr<CommsEventLoop> loop, std::function<void()> process);
+    /** cancels the task*/
+    ~CommsEventTask();
+    CommsEventTask(const CommsEventTask&) = delete;
+    CommsEventTask& operator=(const CommsEventTask&) = delete;
+
+    /** schedule a run of the processing function if one is not already scheduled*/
+    void trigger();
+    /** stop the task from running again, waits for a run in progress to finish
+    @details must not be called from the processing function*/
+    void cancel();
+    /** get the scheduling statistics of the task*/
+    EventLoopStatistics statistics() const;
+    /** get the number of threads of the loop the task runs on*/
+    int threadCount() const { return loop->threadCount(); }
+
+  private:
+    struct TaskState;
+    std::shared_ptr<TaskState> state;
+    std::shared_ptr<CommsEventLoop> loop;
+};
+
+}  // namespace helics
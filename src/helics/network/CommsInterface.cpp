@@ -203,6 +203,7 @@ void CommsInterface::transmit(route_id rid, const ActionMessage& cmd)
     } else {
         txQueue.emplace(rid, cmd);
     }
+    transmitQueued();
 }
 
 void CommsInterface::transmit(route_id rid, ActionMessage&& cmd)
@@ -212,6 +213,14 @@ void CommsInterface::transmit(route_id rid, ActionMessage&& cmd)
     } else {
         txQueue.emplace(rid, std::move(cmd));
     }
+    transmitQueued();
+}
+
+std::size_t CommsInterface::pendingTransmissions() const
+{
+    const auto removed = txQueue.removedCount();
+    const auto queued = txQueue.queuedCount();
+    return (queued > removed) ? static_cast<std::size_t>(queued - removed) : 0U;
 }
 
 void CommsInterface::addRoute(route_id rid, std::string_view routeInfo)
@@ -476,6 +485,7 @@ void CommsInterface::disconnect()
             return;
         }
     }
+    receiverClosed();
     cnt = 0;
     while (txStatus.load() <= ConnectionStatus::CONNECTED) {
         if (txTrigger.wait_for(std::chrono::milliseconds(800))) {
@@ -619,6 +629,11 @@ void CommsInterface::setServerMode(bool serverActive)
     }
 }
 
+std::string CommsInterface::query(std::string_view /*queryString*/) const
+{
+    return {};
+}
+
 bool CommsInterface::isConnected() const
 {
     return ((txStatus == ConnectionStatus::CONNECTED) && (rxStatus == ConnectionStatus::CONNECTED));
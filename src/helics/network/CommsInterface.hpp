@@ -12,14 +12,72 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/containers/BlockingPriorityQueue.hpp"
 #include "helics/core/ActionMessage.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
 
 namespace helics {
 
+/** the queue of messages waiting to be transmitted by a comms object
+@details it keeps a count of the messages going into and out of the queue so the load of the comms
+can be observed from other threads*/
+class TransmitQueue:
+    public gmlc::containers::BlockingPriorityQueue<std::pair<route_id, ActionMessage>> {
+  public:
+    using BaseQueue = gmlc::containers::BlockingPriorityQueue<std::pair<route_id, ActionMessage>>;
+    using value_type = std::pair<route_id, ActionMessage>;
+
+    template<class... Args>
+    void emplace(Args&&... args)
+    {
+        // counted before queuing so the removed count never exceeds the queued count
+        ++queued;
+        BaseQueue::emplace(std::forward<Args>(args)...);
+    }
+    template<class... Args>
+    void emplacePriority(Args&&... args)
+    {
+        ++queued;
+        BaseQueue::emplacePriority(std::forward<Args>(args)...);
+    }
+    value_type pop()
+    {
+        auto val = BaseQueue::pop();
+        ++removed;
+        return val;
+    }
+    std::optional<value_type> pop(std::chrono::milliseconds timeout)
+    {
+        auto val = BaseQueue::pop(timeout);
+        if (val) {
+            ++removed;
+        }
+        return val;
+    }
+    std::optional<value_type> try_pop()
+    {
+        auto val = BaseQueue::try_pop();
+        if (val) {
+            ++removed;
+        }
+        return val;
+    }
+    /** get the total number of messages that have been queued*/
+    std::uint64_t queuedCount() const { return queued.load(); }
+    /** get the total number of messages that have been taken from the queue*/
+    std::uint64_t removedCount() const { return removed.load(); }
+
+  private:
+    std::atomic<std::uint64_t> queued{0};
+    std::atomic<std::uint64_t> removed{0};
+};
+
 /** implementation of a generic communications interface
  */
 class CommsInterface {
@@ -93,6 +151,14 @@ class CommsInterface {
     virtual void setFlag(std::string_view flag, bool val);
     /** enable or disable the server mode for the comms*/
     void setServerMode(bool serverActive);
+    /** query the comms object for information about its operation
+    @return a json string with the answer or an empty string if the query is not recognized*/
+    virtual std::string query(std::string_view queryString) const;
+
+    /** get the number of messages waiting to be transmitted*/
+    std::size_t pendingTransmissions() const;
+    /** get the total number of messages taken from the transmit queue for transmission*/
+    std::uint64_t processedTransmissions() const { return txQueue.removedCount(); }
 
     /** generate a log message as a warning*/
     void logWarning(std::string_view message) const;
@@ -151,8 +217,7 @@ class CommsInterface {
         ActionCallback;  //!< the callback for what to do with a received message
     std::function<void(int level, std::string_view name, std::string_view message)>
         loggingCallback;  //!< callback for logging
-    gmlc::containers::BlockingPriorityQueue<std::pair<route_id, ActionMessage>>
-        txQueue;  //!< set of messages waiting to be transmitted
+    TransmitQueue txQueue;  //!< set of messages waiting to be transmitted
     // closing the files or connection can take some time so there is a need for inter-thread
     // communication to not spit out warning messages if it is in the process of disconnecting
     std::atomic<bool> disconnecting{
@@ -170,6 +235,12 @@ class CommsInterface {
     virtual void closeReceiver();  //!< function to instruct the receiver loop to close
     virtual void reconnectTransmitter();  //!< function to reconnect the transmitter
     virtual void reconnectReceiver();  //!< function to reconnect the receiver
+    /** called by disconnect once the receiver has stopped so state gathered from received
+    messages can be stored while logging is still available*/
+    virtual void receiverClosed() {}
+    /** notification that a message was added to the transmit queue*/
+    virtual void transmitQueued() {}
+
   protected:
     void setTxStatus(ConnectionStatus status);
     void setRxStatus(ConnectionStatus status);
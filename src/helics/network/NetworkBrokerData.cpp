@@ -58,6 +58,77 @@ std::shared_ptr<helicsCLI11App> NetworkBrokerData::commandLineParser(std::string
     nbparser->add_flag("--reuse_address",
                        reuse_address,
                        "allow the server to reuse a bound address, mostly useful for tcp cores");
+    nbparser->add_flag("--parallel_send",
+                       parallelSend,
+                       "use a separate send thread for each connection, (tcp cores only)");
+    nbparser
+        ->add_option("--send_high_water_mark",
+                     sendHighWaterMark,
+                     "the number of bytes queued for a connection at which sending blocks when "
+                     "using parallel sends")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+    nbparser
+        ->add_option("--compression",
+                     compression,
+                     "the compression to use for data sent between brokers, (tcp and zmq cores "
+                     "only)")
+        ->transform(CLI::CheckedTransformer({{"none", "0"}, {"lz4", "1"}, {"zstd", "2"}},
+                                            CLI::ignore_case));
+    nbparser
+        ->add_option("--compression_threshold",
+                     compressionThreshold,
+                     "the size in bytes at which data sent between brokers is compressed")
+        ->capture_default_str();
+    nbparser->add_flag("--zero_copy_receive",
+                       zeroCopyReceive,
+                       "let large values reference the network receive buffer instead of being "
+                       "copied, (tcp and zmq cores only)");
+    nbparser->add_flag("--reliable_udp",
+                       reliableUdp,
+                       "acknowledge and retransmit datagrams and pack multiple messages into each "
+                       "datagram, (udp cores only)");
+    nbparser
+        ->add_option("--udp_datagram_size",
+                     maxDatagramSize,
+                     "the size in bytes of the datagrams messages are packed into when using "
+                     "reliable udp")
+        ->capture_default_str()
+        ->check(CLI::Range(256, 65000));
+    nbparser->add_flag("--event_loop",
+                       useEventLoop,
+                       "process the transmissions on an event loop shared by all the comms in the "
+                       "process instead of a dedicated thread, (tcpss cores only)");
+    nbparser
+        ->add_option("--event_loop_threads",
+                     eventLoopThreads,
+                     "the number of threads in the shared comms event loop")
+        ->capture_default_str()
+        ->check(CLI::PositiveNumber);
+    nbparser
+        ->add_option("--shm_senders",
+                     shmSenders,
+                     "the number of senders that can be connected to a shared memory mailbox at "
+                     "the same time, (shm cores only)")
+        ->check(CLI::PositiveNumber);
+    nbparser
+        ->add_option("--shm_ring_size",
+                     shmRingSize,
+                     "the size in bytes of the ring each sender writes to in a shared memory "
+                     "mailbox, (shm cores only)")
+        ->check(CLI::Range(4096, 1 << 30));
+    nbparser->add_flag("--direct_dispatch",
+                       directDispatch,
+                       "deliver messages to their destination from the thread sending them instead "
+                       "of a transmit thread, (inproc cores only)");
+    nbparser->add_option("--warm_start_cache",
+                         warmStartFile,
+                         "the file the broker records the ports it assigns in, cores and brokers "
+                         "with a port in the file connect without negotiating one");
+    nbparser->add_option("--federation_key",
+                         federationKey,
+                         "the key identifying the federation in the warm start cache, the cache is "
+                         "ignored if it was recorded with a different key");
     nbparser
         ->add_flag(
             "--noackconnect",
@@ -6,9 +6,11 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "NetworkCompression.hpp"
 #include "gmlc/networking/addressOperations.hpp"
 #include "gmlc/networking/interfaceOperations.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -35,6 +37,8 @@ class NetworkBrokerData {
     std::string localInterface;  //!< the interface to use for the local connection
     std::string brokerInitString;  //!< a string containing arguments for the broker initialization
     std::string connectionAddress;  //!< the address for connecting
+    std::string warmStartFile;  //!< the file holding the port assignments of a federation
+    std::string federationKey;  //!< the key identifying the federation in the warm start file
     int portNumber{-1};  //!< the port number for the local interface
     int brokerPort{-1};  //!< the port number to use for the main broker interface
     int connectionPort{-1};  //!< the port number for connecting
@@ -43,9 +47,27 @@ class NetworkBrokerData {
     int maxMessageSize{16 * 256};  //!< maximum message size
     int maxMessageCount{256};  //!< maximum message count
     int maxRetries{5};  //!< the maximum number of retries to establish a network connection
+    /// the number of bytes queued for a route at which sending blocks when using parallel sends
+    std::size_t sendHighWaterMark{4U * 1024U * 1024U};
+    /// the compression to use for frames sent to other brokers
+    CompressionType compression{CompressionType::NONE};
+    /// frames smaller than this number of bytes are not compressed
+    std::size_t compressionThreshold{1024};
+    /// the size of datagram that messages are packed into when using reliable udp
+    std::size_t maxDatagramSize{1400};
+    int eventLoopThreads{2};  //!< the number of threads in the shared comms event loop
+    /// the number of senders a shared memory mailbox has room for, 0 picks one from the role
+    int shmSenders{0};
+    /// the size in bytes of each sender ring in a shared memory mailbox, 0 to size from maxsize
+    std::size_t shmRingSize{0};
     gmlc::networking::InterfaceNetworks interfaceNetwork{
         gmlc::networking::InterfaceNetworks::LOCAL};
     bool reuse_address{false};  //!< allow reuse of binding address
+    bool parallelSend{false};  //!< use a separate send thread for each route
+    bool zeroCopyReceive{false};  //!< reference large values in the receive buffers
+    bool reliableUdp{false};  //!< sequence and retransmit udp datagrams
+    bool useEventLoop{false};  //!< process the transmissions on the shared comms event loop
+    bool directDispatch{false};  //!< deliver inproc messages from the transmitting thread
     /// specify that any automatic port allocation should use operating system allocation
     bool use_os_port{false};
     bool autobroker{false};  //!< flag for specifying an automatic broker generation
@@ -9,10 +9,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../core/CoreTypes.hpp"
 #include "../core/helicsCLI11.hpp"
 #include "NetworkBroker.hpp"
+#include "NetworkCommsInterface.hpp"
 
 #include <iostream>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace helics {
 constexpr const char* tstr[] = {"default",
@@ -78,6 +80,9 @@ bool NetworkBroker<COMMS, baseline, tcode>::brokerConnect()
     CommsBroker<COMMS, CoreBroker>::comms->setName(CoreBroker::getIdentifier());
     CommsBroker<COMMS, CoreBroker>::comms->loadNetworkInfo(netInfo);
     CommsBroker<COMMS, CoreBroker>::comms->setTimeout(BrokerBase::networkTimeout.to_ms());
+    if constexpr (std::is_base_of<NetworkCommsInterface, COMMS>::value) {
+        CoreBroker::reserveBrokerIds(CommsBroker<COMMS, CoreBroker>::comms->getWarmStartIds());
+    }
 
     auto res = CommsBroker<COMMS, CoreBroker>::comms->connect();
     if (res) {
@@ -8,16 +8,24 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "NetworkBrokerData.hpp"
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/flagOperations.hpp"
 #include "helics/helics-config.h"
 #ifndef HELICS_ENABLE_ENCRYPTION
 #    include <iostream>
 #endif
+#include <chrono>
+#include <cstdint>
 #include <fmt/format.h>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace helics {
 static constexpr char localHostString[] = "localhost";
+/// a compressed frame has to fit in a single packet which has a 24 bit size
+static constexpr std::size_t maxCompressedFrameSize{0x00FF0000U};
 
 NetworkCommsInterface::NetworkCommsInterface(gmlc::networking::InterfaceTypes type,
                                              CommsInterface::thread_generation threads) noexcept:
@@ -25,6 +33,22 @@ NetworkCommsInterface::NetworkCommsInterface(gmlc::networking::InterfaceTypes ty
 {
 }
 
+void NetworkCommsInterface::receiverClosed()
+{
+    if (warmStartModified.exchange(false)) {
+        saveWarmStartCache();
+    }
+}
+
+void NetworkCommsInterface::saveWarmStartCache()
+{
+    if (!warmStart.save(warmStartFile, federationKey)) {
+        logWarning(fmt::format("unable to write the warm start cache {}, the ports will be "
+                               "negotiated on the next start",
+                               warmStartFile));
+    }
+}
+
 NetworkCommsInterface::PortAllocator::PortAllocator()
 {
     addNewHost(localHostString);
@@ -153,9 +177,53 @@ void NetworkCommsInterface::loadNetworkInfo(const NetworkBrokerData& netInfo)
     useOsPortAllocation = netInfo.use_os_port;
     appendNameToAddress = netInfo.appendNameToAddress;
     noAckConnection = netInfo.noAckConnection;
+    warmStartFile = netInfo.warmStartFile;
+    federationKey = netInfo.federationKey;
+    if (!warmStartFile.empty()) {
+        const bool matched = warmStart.load(warmStartFile, federationKey);
+        if (mRequireBrokerConnection || !brokerTargetAddress.empty()) {
+            // only the root broker records assignments, anything else just uses its own
+            const auto assignment =
+                matched ? warmStart.find(name) : std::optional<WarmStartCache::Assignment>{};
+            if (assignment && PortNumber <= 0 && !useOsPortAllocation) {
+                // the broker has the port reserved so no port is requested, and if the file has
+                // the compression of the broker the connection does not need to be acknowledged
+                PortNumber = assignment->port;
+                autoPortNumber = false;
+                warmStartCompression = warmStart.compressionMask();
+                warmStartConnection = (warmStartCompression >= 0);
+                if (warmStartConnection && assignment->id >= gGlobalBrokerIdShift) {
+                    warmStartId = GlobalBrokerId(assignment->id);
+                }
+            }
+            warmStart.clear();
+            warmStartFile.clear();
+        } else {
+            for (const auto& [assignedName, assignment] : warmStart.assignments()) {
+                for (int ii = 0; ii < assignment.count; ++ii) {
+                    openPorts.addUsedPort(assignment.host, assignment.port + ii);
+                }
+            }
+            if (warmStart.setCompressionMask(availableCompressionMask())) {
+                // cores started before this broker disconnects read the mask from the file
+                saveWarmStartCache();
+            } else {
+                // a cache from a different federation gets replaced
+                warmStartModified = !matched;
+            }
+        }
+    }
     useJsonSerialization = netInfo.useJsonSerialization;
     encrypted = netInfo.encrypted;
     forceConnection = netInfo.forceConnection;
+    zeroCopyReceive = netInfo.zeroCopyReceive;
+    compression = netInfo.compression;
+    compressionThreshold = netInfo.compressionThreshold;
+    if (!compressionAvailable(compression)) {
+        logWarning(fmt::format("{} compression is not available in this build of HELICS",
+                               compressionTypeName(compression)));
+        compression = CompressionType::NONE;
+    }
 #ifndef HELICS_ENABLE_ENCRYPTION
     if (encrypted) {
         std::cerr
@@ -166,6 +234,17 @@ void NetworkCommsInterface::loadNetworkInfo(const NetworkBrokerData& netInfo)
     propertyUnLock();
 }
 
+std::vector<std::pair<std::string, GlobalBrokerId>> NetworkCommsInterface::getWarmStartIds() const
+{
+    std::vector<std::pair<std::string, GlobalBrokerId>> ids;
+    for (const auto& [assignedName, assignment] : warmStart.assignments()) {
+        if (assignment.id >= gGlobalBrokerIdShift) {
+            ids.emplace_back(assignedName, GlobalBrokerId(assignment.id));
+        }
+    }
+    return ids;
+}
+
 void NetworkCommsInterface::setBrokerPort(int brokerPortNumber)
 {
     if (propertyLock()) {
@@ -217,6 +296,11 @@ void NetworkCommsInterface::setFlag(std::string_view flag, bool val)
             noAckConnection = val;
             propertyUnLock();
         }
+    } else if (flag == "zero_copy_receive") {
+        if (propertyLock()) {
+            zeroCopyReceive = val;
+            propertyUnLock();
+        }
     } else {
         CommsInterface::setFlag(flag, val);
     }
@@ -240,12 +324,22 @@ ActionMessage NetworkCommsInterface::generateReplyToIncomingMessage(ActionMessag
                 portReply.messageID = PORT_DEFINITIONS;
                 portReply.source_id = GlobalFederateId(PortNumber);
                 portReply.setExtraData(openPort);
+                if (!warmStartFile.empty() &&
+                    warmStart.record(cmd.getString(2),
+                                     cmd.name().empty() ? localHostString : cmd.name(),
+                                     openPort,
+                                     cnt)) {
+                    warmStartModified = true;
+                }
                 portReply.counter = cmd.counter;
+                // let the requester know what compression can be sent over the link
+                portReply.setExtraDestData(availableCompressionMask());
                 return portReply;
             } break;
             case CONNECTION_REQUEST: {
                 ActionMessage connAck(CMD_PROTOCOL);
                 connAck.messageID = CONNECTION_ACK;
+                connAck.setExtraDestData(availableCompressionMask());
                 return connAck;
             } break;
             default:
@@ -284,7 +378,7 @@ ActionMessage NetworkCommsInterface::generatePortRequest(int cnt) const
     req.messageID = REQUEST_PORTS;
     req.payload = gmlc::networking::stripProtocol(localTargetAddress);
     req.counter = cnt;
-    req.setStringData(brokerName, brokerInitString);
+    req.setStringData(brokerName, brokerInitString, name);
     return req;
 }
 
@@ -307,4 +401,174 @@ void NetworkCommsInterface::loadPortDefinitions(const ActionMessage& cmd)
     }
 }
 
+CompressionType NetworkCommsInterface::negotiateCompression(const ActionMessage& reply) const
+{
+    return negotiateCompression(reply.getExtraDestData());
+}
+
+CompressionType NetworkCommsInterface::negotiateCompression(std::int32_t mask) const
+{
+    if (compression == CompressionType::NONE || !compressionInMask(compression, mask)) {
+        return CompressionType::NONE;
+    }
+    return compression;
+}
+
+void NetworkCommsInterface::negotiateParentCompression(const ActionMessage& reply)
+{
+    negotiateParentCompression(reply.getExtraDestData());
+}
+
+void NetworkCommsInterface::negotiateParentCompression(std::int32_t mask)
+{
+    parentCompression = negotiateCompression(mask);
+    if (compression != CompressionType::NONE && parentCompression == CompressionType::NONE) {
+        logWarning(fmt::format("broker does not support {} compression, data sent to the broker "
+                               "will not be compressed",
+                               compressionTypeName(compression)));
+    }
+}
+
+ActionMessage NetworkCommsInterface::generateConnectionInformation() const
+{
+    ActionMessage info(CMD_PROTOCOL_PRIORITY);
+    info.messageID = CONNECTION_INFORMATION;
+    info.payload = getAddress();
+    info.setStringData(brokerName, brokerInitString, name);
+    // the broker uses this in place of the reply to a connection request from its route
+    info.setExtraDestData(availableCompressionMask());
+    return info;
+}
+
+void NetworkCommsInterface::recordPeerCompression(const ActionMessage& info)
+{
+    const std::lock_guard<std::mutex> lock(peerCompressionLock);
+    peerCompression.insert_or_assign(std::string(info.payload.to_string()),
+                                     info.getExtraDestData());
+}
+
+std::int32_t NetworkCommsInterface::takePeerCompression(std::string_view address)
+{
+    const std::lock_guard<std::mutex> lock(peerCompressionLock);
+    auto peer = peerCompression.find(address);
+    if (peer == peerCompression.end()) {
+        return -1;
+    }
+    const auto mask = peer->second;
+    peerCompression.erase(peer);
+    return mask;
+}
+
+void NetworkCommsInterface::recordAssignedId(const ActionMessage& ack)
+{
+    if (warmStartFile.empty() || ack.action() != CMD_BROKER_ACK ||
+        checkActionFlag(ack, error_flag)) {
+        return;
+    }
+    if (warmStart.recordId(ack.name(), ack.dest_id.baseValue())) {
+        warmStartModified = true;
+    }
+}
+
+ActionMessage NetworkCommsInterface::generateCompressedFrame(std::string_view data,
+                                                             CompressionType type)
+{
+    if (type == CompressionType::NONE || data.size() < compressionThreshold ||
+        data.size() > maxCompressedFrameSize) {
+        return ActionMessage(CMD_IGNORE);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    ActionMessage frame(CMD_PROTOCOL);
+    frame.messageID = COMPRESSED_FRAME;
+    frame.counter = static_cast<std::uint16_t>(type);
+    frame.setExtraData(static_cast<std::int32_t>(data.size()));
+    const bool compressed = compressData(type, data, frame.payload);
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    compressionStats.compressionTime += static_cast<std::uint64_t>(elapsed.count());
+    if (!compressed || frame.payload.size() >= data.size()) {
+        return ActionMessage(CMD_IGNORE);
+    }
+    ++compressionStats.framesCompressed;
+    compressionStats.bytesIn += data.size();
+    compressionStats.bytesOut += frame.payload.size();
+    return frame;
+}
+
+bool NetworkCommsInterface::extractCompressedFrame(const ActionMessage& frame,
+                                                   std::vector<ActionMessage>& messages)
+{
+    const auto type = static_cast<CompressionType>(frame.counter);
+    if (!compressionAvailable(type)) {
+        logError(fmt::format("received a frame using {} compression which is not available in "
+                             "this build of HELICS",
+                             compressionTypeName(type)));
+        return false;
+    }
+    const auto originalSize = frame.getExtraData();
+    // the size comes from the network so it is checked before allocating anything
+    if (originalSize <= 0 || static_cast<std::size_t>(originalSize) > maxCompressedFrameSize) {
+        logError("received an invalid compressed frame");
+        return false;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    // with zero copy receive the decompressed data is shared by any large values it contains
+    auto data = std::make_shared<std::string>(static_cast<std::size_t>(originalSize), '\0');
+    if (!decompressData(type, frame.payload.to_string(), data->size(), data->data())) {
+        logError("unable to decompress frame");
+        return false;
+    }
+    std::shared_ptr<const void> owner;
+    if (zeroCopyReceive) {
+        owner = data;
+    }
+    std::size_t used{0};
+    while (used < data->size()) {
+        ActionMessage message;
+        auto packetSize = message.depacketize(data->data() + used, data->size() - used, owner);
+        if (packetSize == 0) {
+            break;
+        }
+        used += packetSize;
+        messages.push_back(std::move(message));
+    }
+    if (used == 0) {
+        // frames from message based transports hold a single serialized message
+        ActionMessage message;
+        if (message.from_string(*data, owner) > 0) {
+            messages.push_back(std::move(message));
+        }
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    compressionStats.decompressionTime += static_cast<std::uint64_t>(elapsed.count());
+    ++compressionStats.framesDecompressed;
+    return true;
+}
+
+std::string NetworkCommsInterface::query(std::string_view queryString) const
+{
+    if (queryString == "compression") {
+        const std::uint64_t bytesIn = compressionStats.bytesIn;
+        const std::uint64_t bytesOut = compressionStats.bytesOut;
+        const double ratio =
+            (bytesOut > 0) ? static_cast<double>(bytesIn) / static_cast<double>(bytesOut) : 1.0;
+        return fmt::format(
+            R"({{"type":"{}","parent":"{}","threshold":{},"frames_compressed":{},)"
+            R"("bytes_in":{},"bytes_out":{},"ratio":{},"compression_time_ms":{},)"
+            R"("frames_decompressed":{},"decompression_time_ms":{}}})",
+            compressionTypeName(compression),
+            compressionTypeName(parentCompression),
+            compressionThreshold,
+            compressionStats.framesCompressed.load(),
+            bytesIn,
+            bytesOut,
+            ratio,
+            static_cast<double>(compressionStats.compressionTime.load()) / 1.0e6,
+            compressionStats.framesDecompressed.load(),
+            static_cast<double>(compressionStats.decompressionTime.load()) / 1.0e6);
+    }
+    return CommsInterface::query(queryString);
+}
+
 }  // namespace helics
@@ -7,11 +7,19 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "CommsInterface.hpp"
+#include "NetworkCompression.hpp"
+#include "WarmStartCache.hpp"
 #include "helics/helics-config.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace helics {
 /** implementation for the communication interface that uses ZMQ messages to communicate*/
@@ -54,6 +62,9 @@ class NetworkCommsInterface: public CommsInterface {
     void setAutomaticPortStartPort(int startingPort);
     /** set a flag on the communication system*/
     virtual void setFlag(std::string_view flag, bool val) override;
+    /** answer queries about the network operation
+    @details "compression" returns the compression settings and statistics*/
+    virtual std::string query(std::string_view queryString) const override;
 
   protected:
     int brokerPort{-1};  //!< standardized broker port to use for connection to the brokers
@@ -66,13 +77,41 @@ class NetworkCommsInterface: public CommsInterface {
     /// if enabled will attempt to force the server connection and terminate any existing
     /// connections
     bool forceConnection{false};
+    /// let large values reference the receive buffers instead of copying them
+    bool zeroCopyReceive{false};
+    /// the compression to use for frames sent to other brokers
+    CompressionType compression{CompressionType::NONE};
+    /// the compression negotiated with the parent broker
+    std::atomic<CompressionType> parentCompression{CompressionType::NONE};
+    std::size_t compressionThreshold{1024};  //!< the smallest frame that gets compressed
     const gmlc::networking::InterfaceTypes networkType;
     gmlc::networking::InterfaceNetworks network{gmlc::networking::InterfaceNetworks::IPV4};
     std::atomic<bool> hasBroker{false};
     int maxRetries{5};  // the maximum number of network retries
+    /// the port, id, and broker compression come from the warm start cache so the connection to
+    /// the broker does not need to be acknowledged
+    bool warmStartConnection{false};
+    std::int32_t warmStartCompression{-1};  //!< the compression mask the broker recorded
 
   private:
     PortAllocator openPorts;  //!< a structure to deal with port allocations
+    WarmStartCache warmStart;  //!< the port assignments recorded for a warm start
+    std::string warmStartFile;  //!< the file the warm start cache is stored in
+    std::string federationKey;  //!< the key identifying the federation in the cache
+    /// the cache has assignments not yet written to the file
+    std::atomic<bool> warmStartModified{false};
+    GlobalBrokerId warmStartId;  //!< the id the broker assigned to this core in a previous run
+    /// the compression masks sent by children connecting from the warm start cache by address
+    std::map<std::string, std::int32_t, std::less<>> peerCompression;
+    std::mutex peerCompressionLock;  //!< the masks are recorded from the receive threads
+
+  protected:
+    /** writes any new port assignments to the warm start cache file*/
+    virtual void receiverClosed() override;
+
+  private:
+    /** write the warm start cache file, logging a warning if it cannot be written*/
+    void saveWarmStartCache();
 
   public:
     /** find an open port for a subBroker*/
@@ -87,10 +126,57 @@ class NetworkCommsInterface: public CommsInterface {
     std::string getAddress() const;
     /** return the default Broker port*/
     virtual int getDefaultBrokerPort() const = 0;
+    /** get the global id the root broker assigned in a previous run from the warm start cache
+    @return an invalid id if there is none*/
+    GlobalBrokerId getWarmStartId() const { return warmStartId; }
+    /** get the ids a root broker assigned in a previous run by name from the warm start cache*/
+    std::vector<std::pair<std::string, GlobalBrokerId>> getWarmStartIds() const;
 
   protected:
     ActionMessage generatePortRequest(int cnt = 1) const;
     void loadPortDefinitions(const ActionMessage& cmd);
+    /** set the compression for the link to the parent broker from a connection reply
+    @details the reply lists the compression the parent can decompress, if the configured
+    compression is not in the list the link to the parent is not compressed*/
+    void negotiateParentCompression(const ActionMessage& reply);
+    /** set the compression for the link to the parent broker from its compression mask*/
+    void negotiateParentCompression(std::int32_t mask);
+    /** get the compression to use on a link from the connection reply of the other end
+    @return the configured compression if the other end can decompress it, otherwise NONE*/
+    CompressionType negotiateCompression(const ActionMessage& reply) const;
+    /** get the compression to use on a link from the compression mask of the other end*/
+    CompressionType negotiateCompression(std::int32_t mask) const;
+    /** generate the message sent first on a connection made from the warm start cache
+    @details it carries the address and compression mask the broker would otherwise get from
+    the connection acknowledgment*/
+    ActionMessage generateConnectionInformation() const;
+    /** record the compression mask from the connection information of a child*/
+    void recordPeerCompression(const ActionMessage& info);
+    /** get and remove the compression mask a child at an address sent
+    @return -1 if the child did not send one*/
+    std::int32_t takePeerCompression(std::string_view address);
+    /** record the id in a registration acknowledgment sent to a child in the warm start cache*/
+    void recordAssignedId(const ActionMessage& ack);
+    /** generate a compressed frame from a set of serialized messages
+    @param data one or more packetized messages or a single serialized message
+    @param type the compression to use
+    @return the frame as a protocol message, or CMD_IGNORE if the data is below the compression
+    threshold or does not get smaller*/
+    ActionMessage generateCompressedFrame(std::string_view data, CompressionType type);
+    /** extract the messages contained in a compressed frame
+    @param frame the compressed frame
+    @param[out] messages the vector to add the messages to
+    @return true if the frame was decompressed, errors are logged*/
+    bool extractCompressedFrame(const ActionMessage& frame, std::vector<ActionMessage>& messages);
+
+  private:
+    CompressionStatistics compressionStats;  //!< counters for the compression activity
 };
 
+/** check if a command is a compressed frame of messages*/
+inline bool isCompressedFrame(const ActionMessage& command) noexcept
+{
+    return (command.action() == CMD_PROTOCOL && command.messageID == COMPRESSED_FRAME);
+}
+
 }  // namespace helics
@@ -0,0 +1,137 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "NetworkCompression.hpp"
+
+#include "../core/SmallBuffer.hpp"
+#include "helics/helics-config.h"
+
+#include <limits>
+
+#ifdef HELICS_HAVE_LZ4
+#    include <lz4.h>
+#endif
+#ifdef HELICS_HAVE_ZSTD
+#    include <zstd.h>
+#endif
+
+namespace helics {
+
+/// zstd level 1 keeps the cpu cost close to lz4 while still giving a good compression ratio
+static constexpr int zstdCompressionLevel{1};
+
+static constexpr std::int32_t compressionBit(CompressionType type)
+{
+    return std::int32_t{1} << static_cast<int>(type);
+}
+
+std::int32_t availableCompressionMask()
+{
+    std::int32_t mask{0};
+#ifdef HELICS_HAVE_LZ4
+    mask |= compressionBit(CompressionType::LZ4);
+#endif
+#ifdef HELICS_HAVE_ZSTD
+    mask |= compressionBit(CompressionType::ZSTD);
+#endif
+    return mask;
+}
+
+bool compressionAvailable(CompressionType type)
+{
+    return (type == CompressionType::NONE) ||
+        ((availableCompressionMask() & compressionBit(type)) != 0);
+}
+
+bool compressionInMask(CompressionType type, std::int32_t mask)
+{
+    if (mask <= 0 || type == CompressionType::NONE) {
+        return false;
+    }
+    return (mask & compressionBit(type)) != 0;
+}
+
+std::string_view compressionTypeName(CompressionType type)
+{
+    switch (type) {
+        case CompressionType::LZ4:
+            return "lz4";
+        case CompressionType::ZSTD:
+            return "zstd";
+        case CompressionType::NONE:
+        default:
+            return "none";
+    }
+}
+
+bool compressData(CompressionType type, std::string_view data, SmallBuffer& output)
+{
+    switch (type) {
+#ifdef HELICS_HAVE_LZ4
+        case CompressionType::LZ4: {
+            if (data.size() > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE)) {
+                return false;
+            }
+            const int inputSize = static_cast<int>(data.size());
+            const int bound = LZ4_compressBound(inputSize);
+            output.resize(static_cast<std::size_t>(bound));
+            const int result = LZ4_compress_default(
+                data.data(), reinterpret_cast<char*>(output.data()), inputSize, bound);
+            if (result <= 0) {
+                return false;
+            }
+            output.resize(static_cast<std::size_t>(result));
+            return true;
+        }
+#endif
+#ifdef HELICS_HAVE_ZSTD
+        case CompressionType::ZSTD: {
+            output.resize(ZSTD_compressBound(data.size()));
+            const auto result = ZSTD_compress(
+                output.data(), output.size(), data.data(), data.size(), zstdCompressionLevel);
+            if (ZSTD_isError(result) != 0U) {
+                return false;
+            }
+            output.resize(result);
+            return true;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+bool decompressData(CompressionType type,
+                    std::string_view data,
+                    std::size_t originalSize,
+                    char* output)
+{
+    switch (type) {
+#ifdef HELICS_HAVE_LZ4
+        case CompressionType::LZ4: {
+            if (data.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()) ||
+                originalSize > static_cast<std::size_t>(LZ4_MAX_INPUT_SIZE)) {
+                return false;
+            }
+            const int result = LZ4_decompress_safe(data.data(),
+                                                   output,
+                                                   static_cast<int>(data.size()),
+                                                   static_cast<int>(originalSize));
+            return (result >= 0 && static_cast<std::size_t>(result) == originalSize);
+        }
+#endif
+#ifdef HELICS_HAVE_ZSTD
+        case CompressionType::ZSTD: {
+            const auto result = ZSTD_decompress(output, originalSize, data.data(), data.size());
+            return (ZSTD_isError(result) == 0U && result == originalSize);
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+}  // namespace helics
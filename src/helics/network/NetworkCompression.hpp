@@ -0,0 +1,62 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace helics {
+class SmallBuffer;
+
+/** the compression algorithms available for frames sent between brokers*/
+enum class CompressionType : std::uint8_t {
+    NONE = 0,  //!< frames are sent uncompressed
+    LZ4 = 1,  //!< lz4 compression, fast with a moderate compression ratio
+    ZSTD = 2,  //!< zstd compression, better compression ratio at a higher cpu cost
+};
+
+/** counters describing the compression activity of a comms object*/
+struct CompressionStatistics {
+    std::atomic<std::uint64_t> framesCompressed{0};  //!< the number of frames sent compressed
+    std::atomic<std::uint64_t> bytesIn{0};  //!< the uncompressed size of the compressed frames
+    std::atomic<std::uint64_t> bytesOut{0};  //!< the compressed size of the compressed frames
+    std::atomic<std::uint64_t> compressionTime{0};  //!< nanoseconds spent compressing
+    std::atomic<std::uint64_t> framesDecompressed{0};  //!< the number of frames received
+    std::atomic<std::uint64_t> decompressionTime{0};  //!< nanoseconds spent decompressing
+};
+
+/** get a bit mask of the compression types this build can compress and decompress
+@details bit N is set if the compression type with value N is available*/
+std::int32_t availableCompressionMask();
+/** check if a compression type is available in this build*/
+bool compressionAvailable(CompressionType type);
+/** check if a compression type is included in a compression mask from a remote comms object
+@details values that do not represent a valid mask are treated as an empty mask*/
+bool compressionInMask(CompressionType type, std::int32_t mask);
+/** get the name of a compression type*/
+std::string_view compressionTypeName(CompressionType type);
+
+/** compress a block of data
+@param type the compression to use
+@param data the data to compress
+@param[out] output the buffer to store the compressed data in
+@return true if the data was compressed, false if the compression type is not available or the
+compression failed*/
+bool compressData(CompressionType type, std::string_view data, SmallBuffer& output);
+/** decompress a block of data
+@param type the compression that was used
+@param data the compressed data
+@param originalSize the size of the data before it was compressed
+@param[out] output the location to store the data, it must hold at least originalSize bytes
+@return true if the data was decompressed to exactly originalSize bytes*/
+bool decompressData(CompressionType type,
+                    std::string_view data,
+                    std::size_t originalSize,
+                    char* output);
+}  // namespace helics
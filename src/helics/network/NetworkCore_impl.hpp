@@ -7,10 +7,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "../core/helicsCLI11.hpp"
+#include "NetworkCommsInterface.hpp"
 #include "NetworkCore.hpp"
 
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace helics {
 constexpr const char* defBrokerInterface[] = {"127.0.0.1",
@@ -57,6 +59,9 @@ bool NetworkCore<COMMS, baseline>::brokerConnect()
     CommsBroker<COMMS, CommonCore>::comms->setName(CommonCore::getIdentifier());
     CommsBroker<COMMS, CommonCore>::comms->loadNetworkInfo(netInfo);
     CommsBroker<COMMS, CommonCore>::comms->setTimeout(BrokerBase::networkTimeout.to_ms());
+    if constexpr (std::is_base_of<NetworkCommsInterface, COMMS>::value) {
+        CommonCore::setWarmStartId(CommsBroker<COMMS, CommonCore>::comms->getWarmStartId());
+    }
     auto res = CommsBroker<COMMS, CommonCore>::comms->connect();
     if (res) {
         if (netInfo.portNumber < 0) {
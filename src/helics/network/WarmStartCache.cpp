@@ -0,0 +1,189 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "WarmStartCache.hpp"
+
+#include "../common/JsonProcessingFunctions.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace helics {
+
+bool WarmStartCache::load(const std::string& fileName, std::string_view federationKey)
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    assigned.clear();
+    compression = -1;
+    std::error_code errorCode;
+    if (!std::filesystem::is_regular_file(fileName, errorCode)) {
+        return false;
+    }
+    nlohmann::json cache;
+    try {
+        cache = fileops::loadJson(fileName);
+    }
+    catch (const std::invalid_argument&) {
+        return false;
+    }
+    if (!cache.is_object() || fileops::getOrDefault(cache, "federation_key", std::string_view{}) !=
+            federationKey) {
+        return false;
+    }
+    if (cache.contains("compression") && cache["compression"].is_number_integer()) {
+        compression = cache["compression"].get<std::int32_t>();
+    }
+    if (!cache.contains("assignments") || !cache["assignments"].is_object()) {
+        return true;
+    }
+    for (const auto& [name, entry] : cache["assignments"].items()) {
+        if (!entry.is_object() || !entry.contains("port") || !entry["port"].is_number_integer()) {
+            continue;
+        }
+        Assignment assignment;
+        assignment.host = fileops::getOrDefault(entry, "host", std::string_view{"localhost"});
+        assignment.port = entry["port"].get<int>();
+        if (entry.contains("count") && entry["count"].is_number_integer()) {
+            assignment.count = entry["count"].get<int>();
+        }
+        if (entry.contains("id") && entry["id"].is_number_integer()) {
+            assignment.id = entry["id"].get<std::int32_t>();
+        }
+        if (assignment.port > 0 && assignment.count > 0) {
+            assigned.emplace(name, std::move(assignment));
+        }
+    }
+    return true;
+}
+
+bool WarmStartCache::save(const std::string& fileName, std::string_view federationKey) const
+{
+    nlohmann::json cache;
+    cache["federation_key"] = std::string(federationKey);
+    cache["assignments"] = nlohmann::json::object();
+    {
+        const std::lock_guard<std::mutex> lock(cacheLock);
+        if (compression >= 0) {
+            cache["compression"] = compression;
+        }
+        for (const auto& [name, assignment] : assigned) {
+            nlohmann::json entry;
+            entry["host"] = assignment.host;
+            entry["port"] = assignment.port;
+            entry["count"] = assignment.count;
+            if (assignment.id != 0) {
+                entry["id"] = assignment.id;
+            }
+            cache["assignments"][name] = std::move(entry);
+        }
+    }
+    // write to a temporary file first so a reader never sees a partial file
+    const std::string tempName = fileName + ".tmp";
+    {
+        std::ofstream file(tempName);
+        if (!file.is_open()) {
+            return false;
+        }
+        try {
+            file << cache.dump(2);
+        }
+        catch (const nlohmann::json::exception&) {
+            // a name that is not valid UTF-8 cannot be written
+            return false;
+        }
+        if (!file.good()) {
+            return false;
+        }
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(tempName, fileName, errorCode);
+    if (errorCode) {
+        std::filesystem::remove(tempName, errorCode);
+        return false;
+    }
+    return true;
+}
+
+std::optional<WarmStartCache::Assignment> WarmStartCache::find(std::string_view name) const
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    auto assignment = assigned.find(name);
+    if (assignment == assigned.end()) {
+        return std::nullopt;
+    }
+    return assignment->second;
+}
+
+bool WarmStartCache::record(std::string_view name, std::string_view host, int port, int count)
+{
+    if (name.empty() || port <= 0) {
+        return false;
+    }
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    auto assignment = assigned.find(name);
+    if (assignment == assigned.end()) {
+        assigned.emplace(std::string(name), Assignment{std::string(host), port, count});
+        return true;
+    }
+    auto& existing = assignment->second;
+    if (existing.host == host && existing.port == port && existing.count == count) {
+        return false;
+    }
+    // the id stays with the name, the broker that assigned it reserves it
+    existing = Assignment{std::string(host), port, count, existing.id};
+    return true;
+}
+
+bool WarmStartCache::recordId(std::string_view name, std::int32_t id)
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    auto assignment = assigned.find(name);
+    if (assignment == assigned.end() || assignment->second.id == id) {
+        return false;
+    }
+    assignment->second.id = id;
+    return true;
+}
+
+std::int32_t WarmStartCache::compressionMask() const
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    return compression;
+}
+
+bool WarmStartCache::setCompressionMask(std::int32_t mask)
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    if (compression == mask) {
+        return false;
+    }
+    compression = mask;
+    return true;
+}
+
+std::map<std::string, WarmStartCache::Assignment, std::less<>> WarmStartCache::assignments() const
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    return assigned;
+}
+
+bool WarmStartCache::empty() const
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    return assigned.empty();
+}
+
+void WarmStartCache::clear()
+{
+    const std::lock_guard<std::mutex> lock(cacheLock);
+    assigned.clear();
+    compression = -1;
+}
+
+}  // namespace helics
@@ -0,0 +1,70 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace helics {
+
+/** the ports a broker assigned to the cores and brokers connecting to it
+@details a broker records the ports it assigns under the name of the core or broker requesting
+them and writes the assignments to a file.  When a federation with the same federation key is
+started again the cores and brokers look up their port in the file and connect without first
+negotiating a port with the broker, and the broker keeps the ports in the file reserved so they
+are not handed to anything else.  The file also holds the id the broker gave each core and the
+compression the broker can decompress so a core can connect without waiting on an acknowledgment*/
+class WarmStartCache {
+  public:
+    /** a block of ports assigned to a core or broker*/
+    struct Assignment {
+        std::string host;  //!< the host the ports were assigned on
+        int port{-1};  //!< the first port of the block
+        int count{1};  //!< the number of ports in the block
+        std::int32_t id{0};  //!< the global id the broker assigned, 0 if it is not known
+    };
+    /** load the assignments from a file
+    @details any existing assignments are cleared first
+    @return true if the file was read and was generated for the same federation key*/
+    bool load(const std::string& fileName, std::string_view federationKey);
+    /** write the assignments to a file
+    @return true if the file was written*/
+    bool save(const std::string& fileName, std::string_view federationKey) const;
+    /** get the assignment for a name
+    @return the assignment or an empty optional if there is none*/
+    std::optional<Assignment> find(std::string_view name) const;
+    /** record the ports assigned to a name
+    @return true if the assignment is new or different from the existing one*/
+    bool record(std::string_view name, std::string_view host, int port, int count);
+    /** record the global id the broker assigned to a name that has ports assigned
+    @return true if the id is different from the one recorded*/
+    bool recordId(std::string_view name, std::int32_t id);
+    /** get the compression mask of the broker that wrote the file, -1 if it is not known*/
+    std::int32_t compressionMask() const;
+    /** set the compression mask of the broker writing the file
+    @return true if the mask is different from the one recorded*/
+    bool setCompressionMask(std::int32_t mask);
+    /** get a copy of all the assignments*/
+    std::map<std::string, Assignment, std::less<>> assignments() const;
+    /** check if there are no assignments*/
+    bool empty() const;
+    /** remove all the assignments*/
+    void clear();
+
+  private:
+    std::map<std::string, Assignment, std::less<>> assigned;
+    std::int32_t compression{-1};  //!< the compression the broker can decompress
+    /// the assignments are recorded from the receive threads of the comms
+    mutable std::mutex cacheLock;
+};
+
+}  // namespace helics
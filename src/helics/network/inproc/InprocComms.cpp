@@ -41,6 +41,7 @@ namespace inproc {
             localTargetAddress = name;
         }
 
+        directDispatch = netInfo.directDispatch;
         // if (PortNumber > 0)
         //{
         //    autoPortNumber = false;
@@ -48,6 +49,18 @@ namespace inproc {
         propertyUnLock();
     }
 
+    void InprocComms::setFlag(std::string_view flag, bool val)
+    {
+        if (flag == "direct_dispatch") {
+            if (propertyLock()) {
+                directDispatch = val;
+                propertyUnLock();
+            }
+        } else {
+            CommsInterface::setFlag(flag, val);
+        }
+    }
+
     void InprocComms::queue_rx_function() {}
 
     void InprocComms::queue_tx_function()
@@ -72,7 +85,6 @@ namespace inproc {
             }
         }
         setRxStatus(ConnectionStatus::CONNECTED);
-        std::shared_ptr<CoreBroker> tbroker;
 
         if (brokerName.empty()) {
             if (!brokerTargetAddress.empty()) {
@@ -157,91 +169,125 @@ namespace inproc {
             }
         }
 
+        if (directDispatch) {
+            // from here on messages are delivered by the threads transmitting them
+            setTxStatus(ConnectionStatus::CONNECTED);
+            directActive.store(true);
+            // anything queued during the setup has not been dispatched
+            dispatchQueued();
+            return;
+        }
+
         setTxStatus(ConnectionStatus::CONNECTED);
-        std::map<route_id, std::shared_ptr<BrokerBase>> routes;
-        bool haltLoop{false};
-        while (!haltLoop) {
-            route_id rid;
-            ActionMessage cmd;
-
-            std::tie(rid, cmd) = txQueue.pop();
-            bool processed = false;
-            if (isProtocolCommand(cmd)) {
-                if (rid == control_route) {
-                    switch (cmd.messageID) {
-                        case NEW_ROUTE: {
-                            auto newroute = cmd.payload.to_string();
-                            bool foundRoute = false;
-                            auto core = CoreFactory::findCore(std::string(newroute));
-                            if (core) {
-                                auto tcore = std::dynamic_pointer_cast<CommonCore>(core);
-                                if (tcore) {
-                                    routes.emplace(route_id{cmd.getExtraData()}, std::move(tcore));
-                                    foundRoute = true;
-                                }
-                            }
-                            auto brk = BrokerFactory::findBroker(std::string(newroute));
-
-                            if (brk) {
-                                auto cbrk = std::dynamic_pointer_cast<CoreBroker>(brk);
-                                if (cbrk) {
-                                    routes.emplace(route_id{cmd.getExtraData()}, std::move(cbrk));
-                                    foundRoute = true;
-                                }
+        while (true) {
+            auto [rid, cmd] = txQueue.pop();
+            if (!dispatchMessage(rid, cmd)) {
+                break;
+            }
+        }
+
+        routes.clear();
+        tbroker = nullptr;
+
+        setTxStatus(ConnectionStatus::TERMINATED);
+    }
+
+    void InprocComms::transmitQueued()
+    {
+        if (directActive.load()) {
+            dispatchQueued();
+        }
+    }
+
+    void InprocComms::dispatchQueued()
+    {
+        const std::lock_guard<std::recursive_mutex> lock(dispatchLock);
+        if (!directActive.load() || dispatching) {
+            // a message transmitted while dispatching is picked up by the loop already running
+            return;
+        }
+        dispatching = true;
+        auto item = txQueue.try_pop();
+        while (item) {
+            if (!dispatchMessage(item->first, item->second)) {
+                directActive.store(false);
+                routes.clear();
+                tbroker = nullptr;
+                setTxStatus(ConnectionStatus::TERMINATED);
+                break;
+            }
+            item = txQueue.try_pop();
+        }
+        dispatching = false;
+    }
+
+    bool InprocComms::dispatchMessage(route_id rid, ActionMessage& cmd)
+    {
+        if (isProtocolCommand(cmd)) {
+            if (rid == control_route) {
+                switch (cmd.messageID) {
+                    case NEW_ROUTE: {
+                        auto newroute = cmd.payload.to_string();
+                        bool foundRoute = false;
+                        auto core = CoreFactory::findCore(std::string(newroute));
+                        if (core) {
+                            auto tcore = std::dynamic_pointer_cast<CommonCore>(core);
+                            if (tcore) {
+                                routes.emplace(route_id{cmd.getExtraData()}, std::move(tcore));
+                                foundRoute = true;
                             }
-                            if (!foundRoute) {
-                                logError(std::string("unable to establish Route to ") +
-                                         std::string(newroute));
+                        }
+                        auto brk = BrokerFactory::findBroker(std::string(newroute));
+
+                        if (brk) {
+                            auto cbrk = std::dynamic_pointer_cast<CoreBroker>(brk);
+                            if (cbrk) {
+                                routes.emplace(route_id{cmd.getExtraData()}, std::move(cbrk));
+                                foundRoute = true;
                             }
-                            processed = true;
-                        } break;
-                        case REMOVE_ROUTE:
-                            routes.erase(route_id{cmd.getExtraData()});
-                            processed = true;
-                            break;
-                        case CLOSE_RECEIVER:
-                            setRxStatus(ConnectionStatus::TERMINATED);
-                            processed = true;
-                            break;
-                        case DISCONNECT:
-                            haltLoop = true;
-                            continue;
+                        }
+                        if (!foundRoute) {
+                            logError(std::string("unable to establish Route to ") +
+                                     std::string(newroute));
+                        }
+                        return true;
                     }
+                    case REMOVE_ROUTE:
+                        routes.erase(route_id{cmd.getExtraData()});
+                        return true;
+                    case CLOSE_RECEIVER:
+                        setRxStatus(ConnectionStatus::TERMINATED);
+                        return true;
+                    case DISCONNECT:
+                        return false;
                 }
             }
-            if (processed) {
-                continue;
-            }
+        }
 
-            if (rid == parent_route_id) {
+        if (rid == parent_route_id) {
+            if (tbroker) {
+                tbroker->addActionMessage(std::move(cmd));
+            } else {
+                logWarning(fmt::format(
+                    "message directed to broker of comm system with no broker, message dropped {}",
+                    prettyPrintString(cmd)));
+            }
+        } else {
+            auto rt_find = routes.find(rid);
+            if (rt_find != routes.end()) {
+                rt_find->second->addActionMessage(std::move(cmd));
+            } else {
                 if (tbroker) {
                     tbroker->addActionMessage(std::move(cmd));
                 } else {
-                    logWarning(fmt::format(
-                        "message directed to broker of comm system with no broker, message dropped {}",
-                        prettyPrintString(cmd)));
-                }
-            } else {
-                auto rt_find = routes.find(rid);
-                if (rt_find != routes.end()) {
-                    rt_find->second->addActionMessage(std::move(cmd));
-                } else {
-                    if (tbroker) {
-                        tbroker->addActionMessage(std::move(cmd));
-                    } else {
-                        if (!isIgnoreableCommand(cmd)) {
-                            logWarning(std::string("unknown route, message dropped ") +
-                                       prettyPrintString(cmd));
-                        }
+                    if (!isIgnoreableCommand(cmd)) {
+                        logWarning(std::string("unknown route, message dropped ") +
+                                   prettyPrintString(cmd));
                     }
                 }
             }
-        }  // while (!haltLoop)
-
-        routes.clear();
-        tbroker = nullptr;
-
-        setTxStatus(ConnectionStatus::TERMINATED);
+        }
+        return true;
     }
 
     std::string InprocComms::getAddress() const
@@ -9,11 +9,18 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../CommsInterface.hpp"
 #include "helics/helics-config.h"
 
+#include <atomic>
 #include <future>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
 
 namespace helics {
+class BrokerBase;
+class CoreBroker;
 namespace inproc {
     /** implementation for the communication interface that uses ZMQ messages to communicate*/
     class InprocComms final: public CommsInterface {
@@ -24,10 +31,29 @@ namespace inproc {
         ~InprocComms();
 
         virtual void loadNetworkInfo(const NetworkBrokerData& netInfo) override;
+        /** set a flag on the communication system
+        @details "direct_dispatch" delivers messages from the thread transmitting them*/
+        virtual void setFlag(std::string_view flag, bool val) override;
 
       private:
         virtual void queue_rx_function() override;  //!< the functional loop for the receive queue
         virtual void queue_tx_function() override;  //!< the loop for transmitting data
+        virtual void transmitQueued() override;
+        /** deliver a message to its destination
+        @return false if the message ends the transmissions*/
+        bool dispatchMessage(route_id rid, ActionMessage& cmd);
+        /** deliver everything in the transmit queue from the calling thread*/
+        void dispatchQueued();
+
+        /// deliver messages from the thread transmitting them instead of the transmit thread
+        bool directDispatch{false};
+        std::atomic<bool> directActive{false};  //!< set while messages are dispatched directly
+        /// keeps the direct dispatch of messages in order, recursive since logging while
+        /// dispatching can transmit another message
+        std::recursive_mutex dispatchLock;
+        bool dispatching{false};  //!< set while a thread is dispatching messages
+        std::shared_ptr<CoreBroker> tbroker;  //!< the broker to send messages to
+        std::map<route_id, std::shared_ptr<BrokerBase>> routes;  //!< the other destinations
       public:
         /** return a dummy port number*/
         int getPort() const { return -1; }
@@ -48,6 +48,11 @@ namespace mpi {
             ->ignore_underscore();
         hApp->add_option("--broker_tag,--tag", brokerTag, "mpi tag of a broker using mpi")
             ->ignore_underscore();
+        hApp->add_flag("--inline_progress",
+                       inlineProgress,
+                       "send and receive the mpi messages from the transmit thread of the broker "
+                       "instead of waiting on the mpi service thread")
+            ->ignore_underscore();
         hApp->add_callback([this]() {
             brokerAddress = std::to_string(brokerRank) + ":" + std::to_string(brokerTag);
         });
@@ -66,6 +71,7 @@ namespace mpi {
         }
 
         comms->setName(getIdentifier());
+        comms->setFlag("inline_progress", inlineProgress);
 
         return comms->connect();
     }
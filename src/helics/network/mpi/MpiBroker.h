@@ -38,6 +38,7 @@ namespace mpi {
         std::string brokerAddress;  //!< the mpi rank:tag of the parent broker
         int brokerRank{0};
         int brokerTag{0};
+        bool inlineProgress{false};  //!< drive the mpi progress from the transmit thread
     };
 }  // namespace mpi
 }  // namespace helics
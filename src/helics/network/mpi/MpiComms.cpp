@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../../core/ActionMessage.hpp"
 #include "MpiService.h"
 
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -18,6 +19,9 @@ SPDX-License-Identifier: BSD-3-Clause
 
 namespace helics {
 namespace mpi {
+    /// how long the transmit thread waits for messages before checking for received ones
+    static constexpr std::chrono::milliseconds inlineProgressInterval{1};
+
     MpiComms::MpiComms()
     {
         auto& mpi_service = MpiService::getInstance();
@@ -39,6 +43,18 @@ namespace mpi {
         }
     }
 
+    void MpiComms::setFlag(std::string_view flag, bool val)
+    {
+        if (flag == "inline_progress") {
+            if (propertyLock()) {
+                inlineProgress = val;
+                propertyUnLock();
+            }
+        } else {
+            CommsInterface::setFlag(flag, val);
+        }
+    }
+
     int MpiComms::processIncomingMessage(ActionMessage& cmd)
     {
         if (isProtocolCommand(cmd)) {
@@ -110,11 +126,33 @@ namespace mpi {
                 brokerTargetAddress.substr(addr_delim_pos + 1, brokerTargetAddress.length()));
         }
 
+        const bool useInlineProgress = inlineProgress && mpi_service.inlineProgressAvailable();
+        if (inlineProgress && !useInlineProgress) {
+            logWarning(
+                "MPI does not support calls from multiple threads, inline progress disabled");
+        }
+        if (useInlineProgress) {
+            mpi_service.addInlineProgress();
+        }
+
         while (true) {
             route_id rid;
             ActionMessage cmd;
 
-            std::tie(rid, cmd) = txQueue.pop();
+            if (useInlineProgress) {
+                auto next = txQueue.try_pop();
+                if (!next) {
+                    // everything queued so far goes out together before waiting for more
+                    mpi_service.tryProgress();
+                    next = txQueue.pop(inlineProgressInterval);
+                    if (!next) {
+                        continue;
+                    }
+                }
+                std::tie(rid, cmd) = std::move(*next);
+            } else {
+                std::tie(rid, cmd) = txQueue.pop();
+            }
             bool processed = false;
             if (isProtocolCommand(cmd)) {
                 if (control_route == rid) {
@@ -149,7 +187,7 @@ namespace mpi {
                 if (hasBroker) {
                     // Send using MPI to broker
                     // std::cout << "send msg to brkr rt: " << prettyPrintString(cmd) << std::endl;
-                    mpi_service.sendMessage(brokerLocation, cmd.to_vector());
+                    mpi_service.sendMessage(brokerLocation, std::move(cmd));
                 }
             } else if (rid == control_route) {  // send to rx thread loop
                 // Send to ourself -- may need command line option to enable for openmpi
@@ -160,12 +198,12 @@ namespace mpi {
                 if (rt_find != routes.end()) {
                     // Send using MPI to rank given by route
                     // std::cout << "send msg to rt: " << prettyPrintString(cmd) << std::endl;
-                    mpi_service.sendMessage(rt_find->second, cmd.to_vector());
+                    mpi_service.sendMessage(rt_find->second, std::move(cmd));
                 } else {
                     if (hasBroker) {
                         // Send using MPI to broker
                         // std::cout << "send msg to brkr: " << prettyPrintString(cmd) << std::endl;
-                        mpi_service.sendMessage(brokerLocation, cmd.to_vector());
+                        mpi_service.sendMessage(brokerLocation, std::move(cmd));
                     } else {
                         if (!isIgnoreableCommand(cmd)) {
                             logWarning(
@@ -177,6 +215,9 @@ namespace mpi {
             }
         }
     CLOSE_TX_LOOP:
+        if (useInlineProgress) {
+            mpi_service.removeInlineProgress();
+        }
         logMessage(std::string("Shutdown TX Loop for ") + localTargetAddress);
         routes.clear();
         if (getRxStatus() == ConnectionStatus::CONNECTED) {
@@ -44,10 +44,16 @@ namespace mpi {
             txMessageQueue;
 
         std::atomic<bool> hasBroker{false};
+        /// send and receive the MPI messages from the transmit thread instead of waiting on the
+        /// MPI service thread
+        bool inlineProgress{false};
         virtual void closeReceiver() override;  //!< function to instruct the receiver loop to close
 
       public:
         void setBrokerAddress(const std::string& address);
+        /** set a flag on the communication system
+        @details "inline_progress" makes the transmit thread drive the MPI sends and receives*/
+        virtual void setFlag(std::string_view flag, bool val) override;
 
         std::string getAddress() { return localTargetAddress; }
         gmlc::containers::BlockingQueue<ActionMessage>& getRxMessageQueue()
@@ -35,6 +35,7 @@ namespace mpi {
         std::string brokerAddress;  //!< the mpi rank:tag of the broker
         int brokerRank{0};
         int brokerTag{0};
+        bool inlineProgress{false};  //!< drive the mpi progress from the transmit thread
         virtual bool brokerConnect() override;
     };
 
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "MpiService.h"
 
+#include <chrono>
 #include <iostream>
 #include <list>
 #include <memory>
@@ -19,11 +20,19 @@ namespace mpi {
     MPI_Comm MpiService::mpiCommunicator = MPI_COMM_NULL;
     bool MpiService::startServiceThread = true;
 
+    /// a batch for a destination is sent early once it reaches this size
+    static constexpr std::size_t maxBatchSize{4U * 1024U * 1024U};
+    /// the number of send buffers kept for reuse
+    static constexpr std::size_t maxSpareBuffers{16};
+
     MpiService& MpiService::getInstance()
     {
         static MpiService instance;
         if (startServiceThread) {
             instance.startService();
+        } else {
+            // progress is driven by the comms or the application, MPI is set up on first use
+            std::call_once(instance.setupFlag, [] { instance.setupMpi(); });
         }
         return instance;
     }
@@ -42,8 +51,12 @@ namespace mpi {
     {
         // Stop the service thread
         stop_service = true;
-        if (service_thread->joinable()) {
-            service_thread->join();
+        if (service_thread) {
+            if (service_thread->joinable()) {
+                service_thread->join();
+            }
+        } else {
+            finalizeMpi();
         }
     }
 
@@ -63,16 +76,7 @@ namespace mpi {
         // For integrating helics MPI calls with existing MPI applications, user may want to call
         // from their own thread
 
-        // Initialize MPI
-        if (initMPI()) {
-            // if mpiCommunicator isn't set by user, make it a duplicate of MPI_COMM_WORLD
-            if (mpiCommunicator == MPI_COMM_NULL) {
-                MPI_Comm_dup(MPI_COMM_WORLD, &mpiCommunicator);
-            }
-
-            // set commRank to our process rank
-            MPI_Comm_rank(mpiCommunicator, &commRank);
-        }
+        setupMpi();
 
         // signal that we have finished starting
         startup_flag = false;
@@ -83,16 +87,52 @@ namespace mpi {
         while (!stop_service || comms_connected > 0 || !(txMessageQueue.empty())) {
             // send/receive MPI messages
             sendAndReceiveMessages();
-            std::this_thread::yield();
+            if (inlineComms > 0) {
+                // the comms drive progress themselves so this is only a backstop
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            } else {
+                std::this_thread::yield();
+            }
         }
 
         MPI_Barrier(mpiCommunicator);
 
-        // Make sure that receives get posted for any remaining sends
-        drainRemainingMessages();
+        // Make sure that receives get posted for any remaining sends, keep receiving until every
+        // rank has finished its sends
+        MPI_Request finished{MPI_REQUEST_NULL};
+        bool barrierStarted{false};
+        int allFinished{0};
+        while (allFinished == 0) {
+            drainRemainingMessages();
+            completeSends();
+            if (!barrierStarted && sendRequests.empty()) {
+                MPI_Ibarrier(mpiCommunicator, &finished);
+                barrierStarted = true;
+            }
+            if (barrierStarted) {
+                MPI_Test(&finished, &allFinished, MPI_STATUS_IGNORE);
+            }
+        }
 
-        MPI_Barrier(mpiCommunicator);
+        finalizeMpi();
+    }
+
+    void MpiService::setupMpi()
+    {
+        // Initialize MPI
+        if (initMPI()) {
+            // if mpiCommunicator isn't set by user, make it a duplicate of MPI_COMM_WORLD
+            if (mpiCommunicator == MPI_COMM_NULL) {
+                MPI_Comm_dup(MPI_COMM_WORLD, &mpiCommunicator);
+            }
+
+            // set commRank to our process rank
+            MPI_Comm_rank(mpiCommunicator, &commRank);
+        }
+    }
 
+    void MpiService::finalizeMpi()
+    {
         // If HELICS initialized MPI, also finalize MPI
         if (helics_initialized_mpi) {
             // Finalize MPI
@@ -189,7 +229,8 @@ namespace mpi {
         MPI_Initialized(&mpi_initialized);
 
         if (mpi_initialized == 0) {
-            MPI_Init_thread(nullptr, nullptr, MPI_THREAD_FUNNELED, &mpi_thread_level);
+            // serialized support lets the comms make progress from their own threads
+            MPI_Init_thread(nullptr, nullptr, MPI_THREAD_SERIALIZED, &mpi_thread_level);
 
             MPI_Initialized(&mpi_initialized);
             if (mpi_initialized == 0) {
@@ -201,6 +242,7 @@ namespace mpi {
         }
 
         MPI_Query_thread(&mpi_thread_level);
+        threadLevel = mpi_thread_level;
 
         if (mpi_thread_level < MPI_THREAD_FUNNELED) {
             std::cerr << "MPI_THREAD_FUNNELED support required" << std::endl;
@@ -210,14 +252,29 @@ namespace mpi {
         return true;
     }
 
+    bool MpiService::inlineProgressAvailable() const
+    {
+        return threadLevel >= MPI_THREAD_SERIALIZED;
+    }
+
     void MpiService::sendAndReceiveMessages()
     {
-        // Eventually this entire loop should be redone
-        // Using fixed size chunks for sending messages would allow posting blocks of irecv requests
-        // If we know that a message will get received, a blocking MPI_Wait_any could be used for
-        // send requests Also, a method of doing time synchronization using MPI reductions should be
-        // added
-        std::list<std::pair<MPI_Request, std::vector<char>>> send_requests;
+        const std::lock_guard<std::mutex> lock(progressLock);
+        progress();
+    }
+
+    bool MpiService::tryProgress()
+    {
+        const std::unique_lock<std::mutex> lock(progressLock, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return false;
+        }
+        progress();
+        return true;
+    }
+
+    void MpiService::progress()
+    {
         std::unique_lock<std::mutex> mpilock(mpiDataLock);
         for (unsigned int i = 0; i < comms.size(); i++) {
             // Skip any nullptr entries
@@ -236,85 +293,102 @@ namespace mpi {
                 if (message_waiting != 0) {
                     // Get the size of the message waiting to be received
                     int recv_size;
-                    std::vector<char> buffer;
                     MPI_Get_count(&status, MPI_CHAR, &recv_size);
-                    buffer.resize(recv_size);
-
-                    // Post an asynchronous receive
-                    MPI_Request req;
-                    MPI_Irecv(buffer.data(),
-                              static_cast<int>(buffer.size()),
-                              MPI_CHAR,
-                              status.MPI_SOURCE,
-                              status.MPI_TAG,
-                              mpiCommunicator,
-                              &req);
-
-                    // Wait until the asynchronous receive request has finished
-                    int message_received = 0;
-                    while (message_received == 0) {
-                        MPI_Test(&req, &message_received, MPI_STATUS_IGNORE);
-                    }
-
-                    // Deserialized the received action message
-                    ActionMessage M(buffer);
-
-                    // Add to the received message queue for the MpiComms object
-                    if (comms[i] != nullptr) {
-                        comms[i]->getRxMessageQueue().push(M);
-                    }
+                    receiveBuffer.resize(recv_size);
+
+                    // the message is already waiting so a blocking receive returns immediately
+                    MPI_Recv(receiveBuffer.data(),
+                             recv_size,
+                             MPI_CHAR,
+                             status.MPI_SOURCE,
+                             status.MPI_TAG,
+                             mpiCommunicator,
+                             MPI_STATUS_IGNORE);
+
+                    deliverMessages(static_cast<int>(i),
+                                    receiveBuffer.data(),
+                                    receiveBuffer.size());
                 }
             }
         }
-
         mpilock.unlock();
-        // Send messages from the queue
+
+        // Collect the queued messages into a single buffer for each destination
         auto sendMsg = txMessageQueue.try_pop();
         while (sendMsg) {
-            // std::vector<char> msg;
-            // std::string address;
-            // std::tie (address, msg) = sendMsg.value ();
-
-            MPI_Request req{MPI_REQUEST_NULL};
-            std::pair<MPI_Request, std::vector<char>> sendRequestData{req,
-                                                                      std::move(sendMsg->second)};
-
-            int destRank = sendMsg->first.first;
-            int destTag = sendMsg->first.second;
-
-            if (destRank != commRank) {
-                send_requests.push_back(std::move(sendRequestData));
-                auto& sreq = send_requests.back();
-                // Send the message using asynchronous send
-                MPI_Isend(sreq.second.data(),
-                          static_cast<int>(sreq.second.size()),
-                          MPI_CHAR,
-                          destRank,
-                          destTag,
-                          mpiCommunicator,
-                          &sreq.first);
+            const auto& address = sendMsg->first;
+            if (address.first != commRank) {
+                auto& batch = sendBatches[address];
+                sendMsg->second.appendPacket(batch);
+                if (batch.size() >= maxBatchSize) {
+                    sendBatch(address, batch);
+                }
             } else {
+                // messages for comms in the same process are handed over without serialization
                 mpilock.lock();
-                if (comms[destTag] != nullptr) {
-                    // Add the message directly to the destination rx queue (same process)
-                    ActionMessage M(sendRequestData.second);
-                    comms[destTag]->getRxMessageQueue().push(M);
+                const auto destTag = static_cast<std::size_t>(address.second);
+                if (destTag < comms.size() && comms[destTag] != nullptr) {
+                    comms[destTag]->getRxMessageQueue().push(std::move(sendMsg->second));
                 }
                 mpilock.unlock();
             }
             sendMsg = txMessageQueue.try_pop();
         }
+        for (auto& [address, batch] : sendBatches) {
+            if (!batch.empty()) {
+                sendBatch(address, batch);
+            }
+        }
+        completeSends();
+    }
 
-        send_requests.remove_if([](std::pair<MPI_Request, std::vector<char>>& req) {
-            int send_finished;
-            MPI_Test(&req.first, &send_finished, MPI_STATUS_IGNORE);
+    void MpiService::sendBatch(const std::pair<int, int>& address, std::string& batch)
+    {
+        sendRequests.emplace_back(MPI_REQUEST_NULL, std::move(batch));
+        batch.clear();
+        if (!spareBuffers.empty()) {
+            batch = std::move(spareBuffers.back());
+            spareBuffers.pop_back();
+        }
+        auto& sreq = sendRequests.back();
+        MPI_Isend(sreq.second.data(),
+                  static_cast<int>(sreq.second.size()),
+                  MPI_CHAR,
+                  address.first,
+                  address.second,
+                  mpiCommunicator,
+                  &sreq.first);
+    }
 
-            if (send_finished == 1) {
-                // Any cleanup needed here? Freeing the vector or MPI_Request?
+    void MpiService::completeSends()
+    {
+        auto sreq = sendRequests.begin();
+        while (sreq != sendRequests.end()) {
+            int send_finished{0};
+            MPI_Test(&sreq->first, &send_finished, MPI_STATUS_IGNORE);
+            if (send_finished == 0) {
+                ++sreq;
+                continue;
+            }
+            if (spareBuffers.size() < maxSpareBuffers) {
+                sreq->second.clear();
+                spareBuffers.push_back(std::move(sreq->second));
             }
+            sreq = sendRequests.erase(sreq);
+        }
+    }
 
-            return (send_finished == 1);
-        });
+    void MpiService::deliverMessages(int tag, const char* data, std::size_t size)
+    {
+        std::vector<ActionMessage> messages;
+        depacketizeBatch(data, size, messages);
+        auto* comm = comms[tag];
+        if (comm == nullptr) {
+            return;
+        }
+        for (auto& message : messages) {
+            comm->getRxMessageQueue().push(std::move(message));
+        }
     }
 
     void MpiService::drainRemainingMessages()
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <atomic>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
 #include <mpi.h>
 #include <mutex>
@@ -34,6 +35,13 @@ namespace mpi {
 
         static MpiService& getInstance();
         static void setMpiCommunicator(MPI_Comm communicator);
+        /** get the communicator the service sends and receives on*/
+        static MPI_Comm getMpiCommunicator() { return mpiCommunicator; }
+        /** set whether getInstance starts the service thread, must be called before the first
+        getInstance call
+        @details without the service thread MPI is set up on the first getInstance call and
+        progress is made by the comms using inline progress or by the application calling
+        sendAndReceiveMessages*/
         static void setStartServiceThread(bool start);
 
         std::string addMpiComms(MpiComms* comm);
@@ -42,12 +50,26 @@ namespace mpi {
         int getRank();
         int getTag(MpiComms* comm);
 
-        void sendMessage(std::pair<int, int> address, std::vector<char> message)
+        /** queue a message to send to the comms at an address (rank, tag)
+        @details the messages queued for the same address between progress calls are sent
+        together in a single MPI message*/
+        void sendMessage(std::pair<int, int> address, ActionMessage message)
         {
             txMessageQueue.emplace(address, std::move(message));
         }
 
+        /** send the queued messages and receive any waiting messages*/
         void sendAndReceiveMessages();
+        /** run sendAndReceiveMessages unless another thread is already doing so
+        @return true if the messages were processed*/
+        bool tryProgress();
+        /** check if threads other than the service thread are able to make MPI calls*/
+        bool inlineProgressAvailable() const;
+        /** register a comms object driving progress from its own thread
+        @details while any are registered the service thread polls less aggressively*/
+        void addInlineProgress() { ++inlineComms; }
+        /** remove a registration made with addInlineProgress*/
+        void removeInlineProgress() { --inlineComms; }
         void drainRemainingMessages();
 
       private:
@@ -59,18 +81,40 @@ namespace mpi {
         static bool startServiceThread;
 
         std::mutex mpiDataLock;  //!< lock for the comms and send_requests
+        std::mutex progressLock;  //!< held while making MPI calls to send and receive
         std::vector<MpiComms*> comms;
-        gmlc::containers::BlockingQueue<std::pair<std::pair<int, int>, std::vector<char>>>
+        gmlc::containers::BlockingQueue<std::pair<std::pair<int, int>, ActionMessage>>
             txMessageQueue;
+        /// the buffer being filled for each destination during a progress call
+        std::map<std::pair<int, int>, std::string> sendBatches;
+        /// sends in progress along with the buffer they are sending
+        std::list<std::pair<MPI_Request, std::string>> sendRequests;
+        std::vector<std::string> spareBuffers;  //!< buffers from completed sends for reuse
+        std::vector<char> receiveBuffer;  //!< the buffer incoming messages are received into
+        int threadLevel{0};  //!< the level of thread support MPI provides
 
         bool helics_initialized_mpi{false};
         std::atomic<int> comms_connected{0};
         std::atomic<bool> startup_flag{false};
         std::atomic<bool> stop_service{false};
+        std::atomic<int> inlineComms{0};
         std::unique_ptr<std::thread> service_thread;
+        std::once_flag setupFlag;  //!< flag for setting up MPI without the service thread
 
         void startService();
         void serviceLoop();
+        /** initialize MPI if needed and get the communicator and rank*/
+        void setupMpi();
+        /** finalize MPI if HELICS initialized it*/
+        void finalizeMpi();
+        /** the work of sendAndReceiveMessages, called with the progressLock held*/
+        void progress();
+        /** send the buffer accumulated for a destination*/
+        void sendBatch(const std::pair<int, int>& address, std::string& batch);
+        /** release the buffers of the sends that have finished*/
+        void completeSends();
+        /** deliver the messages in a received buffer to a comms object*/
+        void deliverMessages(int tag, const char* data, std::size_t size);
 
         bool initMPI();
     };
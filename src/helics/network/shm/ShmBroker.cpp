@@ -0,0 +1,16 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmBroker.h"
+
+#include "../NetworkBroker_impl.hpp"
+#include "ShmComms.h"
+
+namespace helics {
+template class NetworkBroker<shm::ShmComms,
+                             gmlc::networking::InterfaceTypes::IPC,
+                             static_cast<int>(CoreType::SHM)>;
+}  // namespace helics
@@ -0,0 +1,21 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../NetworkBroker.hpp"
+
+namespace helics {
+namespace shm {
+    class ShmComms;
+
+    /** implementation for the broker that uses shared memory ring buffers to communicate*/
+    using ShmBroker = NetworkBroker<ShmComms,
+                                    gmlc::networking::InterfaceTypes::IPC,
+                                    static_cast<int>(CoreType::SHM)>;
+
+}  // namespace shm
+}  // namespace helics
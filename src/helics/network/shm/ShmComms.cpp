@@ -0,0 +1,258 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmComms.h"
+
+#include "../../core/ActionMessage.hpp"
+#include "../../core/helics_definitions.hpp"
+#include "ShmMailbox.h"
+
+#include <fmt/format.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace helics {
+namespace shm {
+    /// protocol message telling the receiver to stop accepting new connections
+    static constexpr int SET_TO_OPERATING{135111};
+    /// the ring for each sender holds this many maximum size messages
+    static constexpr std::size_t ringMessageMultiple{16};
+    /// the default number of sender slots in the mailbox of a broker
+    static constexpr int brokerSenderSlots{64};
+    /// the default number of sender slots in the mailbox of a core, its broker and a few routes
+    static constexpr int coreSenderSlots{8};
+
+    ShmComms::ShmComms()
+    {
+        // override the default value for this comm system
+        maxMessageCount = 256;
+    }
+    /** destructor*/
+    ShmComms::~ShmComms()
+    {
+        disconnect();
+    }
+
+    void ShmComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
+    {
+        CommsInterface::loadNetworkInfo(netInfo);
+        if (!propertyLock()) {
+            return;
+        }
+        shmSenders = netInfo.shmSenders;
+        shmRingSize = netInfo.shmRingSize;
+        if (localTargetAddress.empty()) {
+            if (serverMode) {
+                localTargetAddress = "_shm_broker";
+            } else {
+                localTargetAddress = name;
+            }
+        }
+        propertyUnLock();
+    }
+
+    std::size_t ShmComms::ringSize() const
+    {
+        if (shmRingSize > 0) {
+            return shmRingSize;
+        }
+        return static_cast<std::size_t>(maxMessageSize) * ringMessageMultiple;
+    }
+
+    int ShmComms::senderSlots() const
+    {
+        if (shmSenders > 0) {
+            return shmSenders;
+        }
+        return serverMode ? brokerSenderSlots : coreSenderSlots;
+    }
+
+    void ShmComms::queue_rx_function()
+    {
+        OwnedMailbox rxQueue;
+        bool connected = rxQueue.connect(localTargetAddress, senderSlots(), ringSize());
+        if (!connected) {
+            std::this_thread::sleep_for(connectionTimeout);
+            connected = rxQueue.connect(localTargetAddress, senderSlots(), ringSize());
+            if (!connected) {
+                disconnecting = true;
+                ActionMessage err(CMD_ERROR);
+                err.messageID = defs::Errors::CONNECTION_FAILURE;
+                err.payload = rxQueue.getError();
+                ActionCallback(std::move(err));
+                setRxStatus(ConnectionStatus::ERRORED);  // the connection has failed
+                return;
+            }
+        }
+        setRxStatus(
+            ConnectionStatus::CONNECTED);  // this is a atomic indicator that the rx queue is ready
+        bool shmOperating = false;
+        while (true) {
+            auto cmdopt = rxQueue.getMessage(2000);
+            if (!cmdopt) {
+                continue;
+            }
+            if (!isValidCommand(*cmdopt)) {
+                logWarning("invalid command received shm");
+                continue;
+            }
+            if (isProtocolCommand(*cmdopt)) {
+                if (cmdopt->messageID == CLOSE_RECEIVER) {
+                    disconnecting = true;
+                    break;
+                }
+                if (cmdopt->messageID == SET_TO_OPERATING) {
+                    if (!shmOperating) {
+                        rxQueue.changeState(mailbox_state_t::operating);
+                        shmOperating = true;
+                    }
+                }
+                continue;
+            }
+            if (cmdopt->action() == CMD_INIT_GRANT) {
+                if (!shmOperating) {
+                    rxQueue.changeState(mailbox_state_t::operating);
+                    shmOperating = true;
+                }
+            }
+            ActionCallback(std::move(*cmdopt));
+        }
+        rxQueue.changeState(mailbox_state_t::closing);
+        setRxStatus(ConnectionStatus::TERMINATED);
+    }
+
+    void ShmComms::queue_tx_function()
+    {
+        SendToMailbox brokerQueue;  //!< the mailbox of the broker
+        SendToMailbox rxQueue;
+        std::map<route_id, SendToMailbox> routes;  //!< table of the routes to other brokers
+        bool hasBroker = false;
+
+        if (!brokerTargetAddress.empty()) {
+            bool conn = brokerQueue.connect(brokerTargetAddress, true, 20);
+            if (!conn) {
+                std::this_thread::sleep_for(connectionTimeout);
+                conn = brokerQueue.connect(brokerTargetAddress, true, 20);
+                if (!conn) {
+                    ActionMessage err(CMD_ERROR);
+                    err.payload = fmt::format("Unable to open broker connection -> {}",
+                                              brokerQueue.getError());
+                    err.messageID = defs::Errors::CONNECTION_FAILURE;
+                    ActionCallback(std::move(err));
+                    setTxStatus(ConnectionStatus::ERRORED);
+                    return;
+                }
+            }
+            hasBroker = true;
+        }
+        // wait for the receiver to STARTUP
+        if (!rxTrigger.wait_forActivation(connectionTimeout)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::Errors::CONNECTION_FAILURE;
+            err.payload = "Unable to link with receiver";
+            ActionCallback(std::move(err));
+            setTxStatus(ConnectionStatus::ERRORED);
+            return;
+        }
+        if (getRxStatus() == ConnectionStatus::ERRORED) {
+            setTxStatus(ConnectionStatus::ERRORED);
+            return;
+        }
+        if (!rxQueue.connect(localTargetAddress, false, 3)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::Errors::CONNECTION_FAILURE;
+            err.payload =
+                fmt::format("Unable to open receiver connection -> {}", rxQueue.getError());
+            ActionCallback(std::move(err));
+            setTxStatus(ConnectionStatus::ERRORED);
+            return;
+        }
+
+        setTxStatus(ConnectionStatus::CONNECTED);
+        bool shmOperating = false;
+        bool continueLoop{true};
+        while (continueLoop) {
+            route_id rid;
+            ActionMessage cmd;
+            std::tie(rid, cmd) = txQueue.pop();
+            if (isProtocolCommand(cmd)) {
+                if (rid == control_route) {
+                    switch (cmd.messageID) {
+                        case NEW_ROUTE: {
+                            SendToMailbox newQueue;
+                            bool newQconnected =
+                                newQueue.connect(std::string(cmd.payload.to_string()), false, 3);
+                            if (newQconnected) {
+                                routes.insert_or_assign(route_id{cmd.getExtraData()},
+                                                        std::move(newQueue));
+                            }
+                            continue;
+                        }
+                        case REMOVE_ROUTE:
+                            routes.erase(route_id{cmd.getExtraData()});
+                            continue;
+                        case DISCONNECT:
+                            continueLoop = false;
+                            continue;
+                    }
+                }
+            }
+            if (cmd.action() == CMD_INIT_GRANT) {
+                if (!shmOperating) {
+                    ActionMessage op(CMD_PROTOCOL);
+                    op.messageID = SET_TO_OPERATING;
+                    rxQueue.sendMessage(op);
+                    shmOperating = true;
+                }
+            }
+            if (rid == parent_route_id) {
+                if (hasBroker) {
+                    brokerQueue.sendMessage(cmd);
+                }
+            } else if (rid == control_route) {
+                rxQueue.sendMessage(cmd);
+            } else {
+                auto routeFnd = routes.find(rid);
+                if (routeFnd != routes.end()) {
+                    routeFnd->second.sendMessage(cmd);
+                } else {
+                    if (hasBroker) {
+                        brokerQueue.sendMessage(cmd);
+                    }
+                }
+            }
+        }
+        setTxStatus(ConnectionStatus::TERMINATED);
+    }
+
+    void ShmComms::closeReceiver()
+    {
+        if ((getRxStatus() == ConnectionStatus::ERRORED) ||
+            (getRxStatus() == ConnectionStatus::TERMINATED)) {
+            return;
+        }
+        ActionMessage cmd(CMD_PROTOCOL);
+        cmd.messageID = CLOSE_RECEIVER;
+        if (getTxStatus() == ConnectionStatus::CONNECTED) {
+            transmit(control_route, cmd);
+        } else if (!disconnecting) {
+            SendToMailbox rxQueue;
+            if (rxQueue.connect(localTargetAddress, false, 0)) {
+                rxQueue.sendMessage(cmd);
+            }
+        }
+    }
+
+    std::string ShmComms::getAddress() const
+    {
+        return localTargetAddress;
+    }
+
+}  // namespace shm
+}  // namespace helics
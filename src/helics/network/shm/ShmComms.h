@@ -0,0 +1,52 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../CommsInterface.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace helics {
+namespace shm {
+    /** implementation for the core that uses lock free ring buffers in shared memory to
+    communicate
+    @details each comms object owns a mailbox with a separate single producer single consumer
+    ring for every connected sender.  The number of sender slots comes from the expected number of
+    senders, a broker takes connections from all its cores while a core usually only hears from its
+    broker, and the ring size defaults to a multiple of maxMessageSize.  Both can be set with
+    --shm_senders and --shm_ring_size*/
+    class ShmComms final: public CommsInterface {
+      public:
+        /** default constructor*/
+        ShmComms();
+        /** destructor*/
+        ~ShmComms();
+
+        virtual void loadNetworkInfo(const NetworkBrokerData& netInfo) override;
+
+      private:
+        virtual void queue_rx_function() override;  //!< the functional loop for the receive queue
+        virtual void queue_tx_function() override;  //!< the loop for transmitting data
+        virtual void closeReceiver() override;  //!< function to instruct the receiver loop to close
+        /** get the size of the ring used for each sender*/
+        std::size_t ringSize() const;
+        /** get the number of sender slots in the mailbox*/
+        int senderSlots() const;
+
+        int shmSenders{0};  //!< the requested number of sender slots, 0 for automatic
+        std::size_t shmRingSize{0};  //!< the requested ring size in bytes, 0 for automatic
+
+      public:
+        /** get the port number of the comms object to push message to*/
+        int getPort() const { return -1; }
+
+        std::string getAddress() const;
+    };
+
+}  // namespace shm
+}  // namespace helics
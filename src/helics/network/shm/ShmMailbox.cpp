@@ -0,0 +1,628 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmMailbox.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+#if defined(__linux__)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <time.h>
+#endif
+
+namespace helics {
+namespace shm {
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+                  "shared memory mailboxes require lock free 32 bit atomics");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "shared memory mailboxes require lock free 64 bit atomics");
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                  "futex words must be plain 32 bit integers");
+
+    namespace {
+        constexpr std::uint64_t mailboxMagic{0x48454C4943534D42ULL};
+        constexpr std::uint32_t slotFree{0};
+        constexpr std::uint32_t slotClaimed{1};
+        constexpr std::uint32_t slotReleased{2};
+        /// marks a record which is followed by more pieces of the same message
+        constexpr std::uint32_t fragmentFlag{0x80000000U};
+        constexpr std::size_t recordHeaderSize{sizeof(std::uint32_t)};
+        constexpr std::size_t minimumRingSize{4096};
+        constexpr std::size_t headerSize{(sizeof(MailboxHeader) + 63U) & ~std::size_t{63U}};
+
+        constexpr std::uint64_t recordSize(std::size_t length)
+        {
+            return (recordHeaderSize + length + 7U) & ~std::uint64_t{7U};
+        }
+
+        std::size_t mappingSize(std::uint32_t slotCount, std::uint64_t ringCapacity)
+        {
+            return headerSize + slotCount * (sizeof(SlotControl) + ringCapacity);
+        }
+
+        SlotControl* slotControl(std::byte* region, std::uint32_t index)
+        {
+            return reinterpret_cast<SlotControl*>(region + headerSize +
+                                                  index * sizeof(SlotControl));
+        }
+
+        std::byte* slotRing(std::byte* region, const MailboxHeader* header, std::uint32_t index)
+        {
+            return region + headerSize + header->slotCount * sizeof(SlotControl) +
+                index * header->ringCapacity;
+        }
+
+        /** copy data out of a ring handling wrap around*/
+        void copyFromRing(const std::byte* ring,
+                          std::uint64_t mask,
+                          std::uint64_t position,
+                          std::size_t length,
+                          std::byte* dest)
+        {
+            const auto start = position & mask;
+            const auto first = std::min<std::uint64_t>(length, mask + 1 - start);
+            std::memcpy(dest, ring + start, first);
+            std::memcpy(dest + first, ring, length - first);
+        }
+
+        /** copy data into a ring handling wrap around*/
+        void copyToRing(std::byte* ring,
+                        std::uint64_t mask,
+                        std::uint64_t position,
+                        const std::byte* data,
+                        std::size_t length)
+        {
+            const auto start = position & mask;
+            const auto first = std::min<std::uint64_t>(length, mask + 1 - start);
+            std::memcpy(ring + start, data, first);
+            std::memcpy(ring, data + first, length - first);
+        }
+
+#if defined(__linux__)
+        void waitOnWord(std::atomic<std::uint32_t>& word, std::uint32_t expected, int timeout)
+        {
+            timespec wait{timeout / 1000, static_cast<long>(timeout % 1000) * 1000000L};
+            syscall(SYS_futex,
+                    reinterpret_cast<std::uint32_t*>(&word),
+                    FUTEX_WAIT,
+                    expected,
+                    &wait,
+                    nullptr,
+                    0);
+        }
+
+        void wakeOnWord(std::atomic<std::uint32_t>& word)
+        {
+            syscall(SYS_futex,
+                    reinterpret_cast<std::uint32_t*>(&word),
+                    FUTEX_WAKE,
+                    1,
+                    nullptr,
+                    nullptr,
+                    0);
+        }
+#else
+        // no cross process wait primitive is available so poll the word instead
+        void waitOnWord(std::atomic<std::uint32_t>& word, std::uint32_t expected, int timeout)
+        {
+            const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+            while (word.load(std::memory_order_acquire) == expected &&
+                   std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+
+        void wakeOnWord(std::atomic<std::uint32_t>& /*word*/) {}
+#endif
+    }  // namespace
+
+    std::string mailboxName(const std::string& connection)
+    {
+        std::string name = connection;
+        std::replace_if(
+            name.begin(),
+            name.end(),
+            [](auto c) { return !(std::isalnum(static_cast<unsigned char>(c)) || (c == '_')); },
+            '_');
+        // some systems limit shared memory names to 31 characters so hash long names
+        constexpr std::size_t maxNameLength{24};
+        if (name.size() > maxNameLength) {
+            std::uint64_t hash{0xcbf29ce484222325ULL};
+            for (auto c : connection) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+            }
+            static constexpr char hexDigits[] = "0123456789abcdef";
+            name.resize(maxNameLength - 16);
+            for (int shift = 60; shift >= 0; shift -= 4) {
+                name.push_back(hexDigits[(hash >> shift) & 0xFU]);
+            }
+        }
+        return "/hshm_" + name;
+    }
+
+    OwnedMailbox::~OwnedMailbox()
+    {
+        disconnect();
+    }
+
+    void OwnedMailbox::disconnect()
+    {
+        if (!connected) {
+            return;
+        }
+        header->state.store(static_cast<std::uint32_t>(mailbox_state_t::closing),
+                            std::memory_order_release);
+        munmap(region, regionSize);
+        // senders which still have the object mapped keep it alive until they disconnect
+        shm_unlink(connectionName.c_str());
+        region = nullptr;
+        header = nullptr;
+        connected = false;
+    }
+
+    bool OwnedMailbox::connect(const std::string& connection, int maxSenders, std::size_t ringSize)
+    {
+        // remove the old mailbox if connecting again
+        disconnect();
+        connectionNameOrig = connection;
+        connectionName = mailboxName(connection);
+        shm_unlink(connectionName.c_str());
+
+        std::uint64_t capacity{minimumRingSize};
+        while (capacity < ringSize) {
+            capacity <<= 1U;
+        }
+        const auto slotCount = static_cast<std::uint32_t>(std::max(maxSenders, 1));
+        regionSize = mappingSize(slotCount, capacity);
+
+        const int fd = shm_open(connectionName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            errorString = std::string("Unable to create shared memory mailbox:") +
+                std::strerror(errno);
+            return false;
+        }
+#if defined(__linux__)
+        // reserve the pages up front, a sparse object would raise SIGBUS on the first write
+        // once /dev/shm fills up instead of failing here
+        const int allocResult = posix_fallocate(fd, 0, static_cast<off_t>(regionSize));
+        if (allocResult != 0) {
+            errorString = std::string("Unable to allocate ") + std::to_string(regionSize) +
+                " bytes for shared memory mailbox:" + std::strerror(allocResult);
+            close(fd);
+            shm_unlink(connectionName.c_str());
+            return false;
+        }
+#else
+        if (ftruncate(fd, static_cast<off_t>(regionSize)) != 0) {
+            errorString = std::string("Unable to size shared memory mailbox:") +
+                std::strerror(errno);
+            close(fd);
+            shm_unlink(connectionName.c_str());
+            return false;
+        }
+#endif
+        void* mapping = mmap(nullptr, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            errorString = std::string("Unable to map shared memory mailbox:") +
+                std::strerror(errno);
+            shm_unlink(connectionName.c_str());
+            return false;
+        }
+        region = static_cast<std::byte*>(mapping);
+        header = new (region) MailboxHeader;
+        header->state.store(static_cast<std::uint32_t>(mailbox_state_t::startup),
+                            std::memory_order_relaxed);
+        header->slotCount = slotCount;
+        header->ringCapacity = capacity;
+        header->slotsInUse.store(0, std::memory_order_relaxed);
+        header->doorbell.store(0, std::memory_order_relaxed);
+        header->readerWaiting.store(0, std::memory_order_relaxed);
+        for (std::uint32_t ii = 0; ii < slotCount; ++ii) {
+            auto* control = new (slotControl(region, ii)) SlotControl;
+            control->claim.store(slotFree, std::memory_order_relaxed);
+            control->head.store(0, std::memory_order_relaxed);
+            control->tail.store(0, std::memory_order_relaxed);
+        }
+        header->state.store(static_cast<std::uint32_t>(mailbox_state_t::connected),
+                            std::memory_order_relaxed);
+        // senders check the magic number before looking at anything else
+        header->magic.store(mailboxMagic, std::memory_order_release);
+        nextSlot = 0;
+        connected = true;
+        return true;
+    }
+
+    void OwnedMailbox::changeState(mailbox_state_t newState)
+    {
+        if (connected) {
+            header->state.store(static_cast<std::uint32_t>(newState), std::memory_order_release);
+        }
+    }
+
+    ActionMessage OwnedMailbox::getMessage()
+    {
+        if (!connected) {
+            return (CMD_ERROR);
+        }
+        while (true) {
+            auto message = getMessage(1000);
+            if (message) {
+                return std::move(*message);
+            }
+        }
+    }
+
+    std::optional<ActionMessage> OwnedMailbox::getMessage(int timeout)
+    {
+        if (!connected) {
+            return std::nullopt;
+        }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+        while (true) {
+            auto message = readMessage();
+            if (message) {
+                return message;
+            }
+            if (timeout <= 0) {
+                return std::nullopt;
+            }
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (remaining.count() <= 0) {
+                return std::nullopt;
+            }
+            waitForData(static_cast<int>(remaining.count()));
+        }
+    }
+
+    std::optional<ActionMessage> OwnedMailbox::readMessage()
+    {
+        const auto inUse = header->slotsInUse.load(std::memory_order_acquire);
+        const std::uint64_t mask = header->ringCapacity - 1;
+        for (std::uint32_t checked = 0; checked < inUse; ++checked) {
+            if (nextSlot >= inUse) {
+                nextSlot = 0;
+            }
+            const auto index = nextSlot++;
+            auto* control = slotControl(region, index);
+            const auto claim = control->claim.load(std::memory_order_acquire);
+            if (claim == slotFree) {
+                continue;
+            }
+            auto tail = control->tail.load(std::memory_order_relaxed);
+            auto head = control->head.load(std::memory_order_acquire);
+            if (head == tail) {
+                if (claim == slotReleased) {
+                    // the sender has gone and everything has been read so recycle the slot
+                    control->head.store(0, std::memory_order_relaxed);
+                    control->tail.store(0, std::memory_order_relaxed);
+                    control->claim.store(slotFree, std::memory_order_release);
+                }
+                continue;
+            }
+            const auto* ring = slotRing(region, header, index);
+            std::uint32_t length{0};
+            std::memcpy(&length, ring + (tail & mask), sizeof(length));
+            ActionMessage cmd;
+            if ((length & fragmentFlag) == 0) {
+                const auto start = (tail + recordHeaderSize) & mask;
+                if (start + length <= mask + 1) {
+                    cmd.fromByteArray(ring + start, length);
+                } else {
+                    buffer.resize(length);
+                    copyFromRing(ring, mask, tail + recordHeaderSize, length, buffer.data());
+                    cmd.fromByteArray(buffer.data(), length);
+                }
+                control->tail.store(tail + recordSize(length), std::memory_order_release);
+            } else {
+                // large messages arrive in pieces, the sender is in the middle of writing them
+                buffer.clear();
+                while (true) {
+                    const bool last = (length & fragmentFlag) == 0;
+                    length &= ~fragmentFlag;
+                    const auto offset = buffer.size();
+                    buffer.resize(offset + length);
+                    copyFromRing(
+                        ring, mask, tail + recordHeaderSize, length, buffer.data() + offset);
+                    tail += recordSize(length);
+                    control->tail.store(tail, std::memory_order_release);
+                    if (last) {
+                        break;
+                    }
+                    int spins{0};
+                    while ((head = control->head.load(std::memory_order_acquire)) == tail) {
+                        if (control->claim.load(std::memory_order_acquire) != slotClaimed) {
+                            // the sender left part way through a message
+                            return std::nullopt;
+                        }
+                        if (++spins < 64) {
+                            std::this_thread::yield();
+                        } else {
+                            std::this_thread::sleep_for(std::chrono::microseconds(50));
+                        }
+                    }
+                    std::memcpy(&length, ring + (tail & mask), sizeof(length));
+                }
+                cmd.fromByteArray(buffer.data(), buffer.size());
+            }
+            return cmd;
+        }
+        return std::nullopt;
+    }
+
+    void OwnedMailbox::waitForData(int timeout)
+    {
+        const auto bell = header->doorbell.load(std::memory_order_acquire);
+        header->readerWaiting.store(1, std::memory_order_relaxed);
+        // pairs with the fence in SendToMailbox::ringDoorbell, either the sender sees the waiting
+        // flag or the data it wrote is visible below
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto inUse = header->slotsInUse.load(std::memory_order_acquire);
+        bool pending{false};
+        for (std::uint32_t ii = 0; ii < inUse; ++ii) {
+            auto* control = slotControl(region, ii);
+            if (control->head.load(std::memory_order_acquire) !=
+                control->tail.load(std::memory_order_relaxed)) {
+                pending = true;
+                break;
+            }
+        }
+        if (!pending) {
+            waitOnWord(header->doorbell, bell, timeout);
+        }
+        header->readerWaiting.store(0, std::memory_order_relaxed);
+    }
+
+    SendToMailbox::~SendToMailbox()
+    {
+        disconnect();
+    }
+
+    SendToMailbox::SendToMailbox(SendToMailbox&& other) noexcept:
+        connectionNameOrig(std::move(other.connectionNameOrig)),
+        connectionName(std::move(other.connectionName)),
+        errorString(std::move(other.errorString)), region(std::exchange(other.region, nullptr)),
+        regionSize(other.regionSize), header(std::exchange(other.header, nullptr)),
+        slot(std::exchange(other.slot, nullptr)), ring(std::exchange(other.ring, nullptr)),
+        mask(other.mask), buffer(std::move(other.buffer)),
+        connected(std::exchange(other.connected, false))
+    {
+    }
+
+    SendToMailbox& SendToMailbox::operator=(SendToMailbox&& other) noexcept
+    {
+        if (this != &other) {
+            disconnect();
+            connectionNameOrig = std::move(other.connectionNameOrig);
+            connectionName = std::move(other.connectionName);
+            errorString = std::move(other.errorString);
+            region = std::exchange(other.region, nullptr);
+            regionSize = other.regionSize;
+            header = std::exchange(other.header, nullptr);
+            slot = std::exchange(other.slot, nullptr);
+            ring = std::exchange(other.ring, nullptr);
+            mask = other.mask;
+            buffer = std::move(other.buffer);
+            connected = std::exchange(other.connected, false);
+        }
+        return *this;
+    }
+
+    bool SendToMailbox::connect(const std::string& connection, bool initOnly, int retries)
+    {
+        disconnect();
+        connectionNameOrig = connection;
+        connectionName = mailboxName(connection);
+        int tries = 0;
+        auto retry = [&tries, retries, this](const char* error) {
+            ++tries;
+            if (tries <= retries) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                return true;
+            }
+            errorString = error;
+            return false;
+        };
+        while (true) {
+            const int fd = shm_open(connectionName.c_str(), O_RDWR, 0600);
+            if (fd < 0) {
+                // this likely means the mailbox doesn't exist yet
+                if (retry("timed out waiting for the mailbox to become available")) {
+                    continue;
+                }
+                return false;
+            }
+            struct stat info {};
+            if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < headerSize) {
+                close(fd);
+                if (retry("timed out waiting for the mailbox to be initialized")) {
+                    continue;
+                }
+                return false;
+            }
+            regionSize = static_cast<std::size_t>(info.st_size);
+            void* mapping = mmap(nullptr, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+            if (mapping == MAP_FAILED) {
+                errorString = std::string("Unable to map shared memory mailbox:") +
+                    std::strerror(errno);
+                return false;
+            }
+            region = static_cast<std::byte*>(mapping);
+            header = reinterpret_cast<MailboxHeader*>(region);
+            bool goodToConnect{false};
+            if (header->magic.load(std::memory_order_acquire) == mailboxMagic &&
+                mappingSize(header->slotCount, header->ringCapacity) == regionSize) {
+                switch (static_cast<mailbox_state_t>(header->state.load())) {
+                    case mailbox_state_t::connected:
+                    case mailbox_state_t::startup:
+                        goodToConnect = true;
+                        break;
+                    case mailbox_state_t::operating:
+                        goodToConnect = !initOnly;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            if (goodToConnect) {
+                break;
+            }
+            munmap(region, regionSize);
+            region = nullptr;
+            header = nullptr;
+            if (!retry("timed out waiting for the mailbox to become available")) {
+                return false;
+            }
+        }
+
+        for (std::uint32_t ii = 0; ii < header->slotCount; ++ii) {
+            auto* control = slotControl(region, ii);
+            auto expected = slotFree;
+            if (control->claim.compare_exchange_strong(expected,
+                                                       slotClaimed,
+                                                       std::memory_order_acq_rel)) {
+                slot = control;
+                ring = slotRing(region, header, ii);
+                auto inUse = header->slotsInUse.load(std::memory_order_relaxed);
+                while (inUse <= ii &&
+                       !header->slotsInUse.compare_exchange_weak(inUse,
+                                                                 ii + 1,
+                                                                 std::memory_order_release)) {
+                }
+                break;
+            }
+        }
+        if (slot == nullptr) {
+            errorString = "no free sender slots in the mailbox";
+            munmap(region, regionSize);
+            region = nullptr;
+            header = nullptr;
+            return false;
+        }
+        mask = header->ringCapacity - 1;
+        connected = true;
+        return true;
+    }
+
+    void SendToMailbox::disconnect()
+    {
+        if (region == nullptr) {
+            return;
+        }
+        if (slot != nullptr) {
+            slot->claim.store(slotReleased, std::memory_order_release);
+            ringDoorbell();
+        }
+        munmap(region, regionSize);
+        region = nullptr;
+        header = nullptr;
+        slot = nullptr;
+        ring = nullptr;
+        connected = false;
+    }
+
+    void SendToMailbox::ringDoorbell()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (header->readerWaiting.load(std::memory_order_relaxed) != 0) {
+            header->doorbell.fetch_add(1, std::memory_order_release);
+            wakeOnWord(header->doorbell);
+        }
+    }
+
+    bool SendToMailbox::waitForSpace(std::uint64_t head, std::uint64_t required)
+    {
+        const auto capacity = mask + 1;
+        int spins{0};
+        while (capacity - (head - slot->tail.load(std::memory_order_acquire)) < required) {
+            if (header->state.load(std::memory_order_acquire) ==
+                static_cast<std::uint32_t>(mailbox_state_t::closing)) {
+                errorString = "the receiver has closed the mailbox";
+                return false;
+            }
+            if (++spins < 64) {
+                std::this_thread::yield();
+            } else {
+                ringDoorbell();
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+        return true;
+    }
+
+    bool SendToMailbox::sendMessage(const ActionMessage& cmd)
+    {
+        if (!connected) {
+            return false;
+        }
+        if (header->state.load(std::memory_order_acquire) ==
+            static_cast<std::uint32_t>(mailbox_state_t::closing)) {
+            errorString = "the receiver has closed the mailbox";
+            return false;
+        }
+        const auto size = static_cast<std::size_t>(cmd.serializedByteCount());
+        const auto capacity = mask + 1;
+        // keep records to half the ring so the receiver can drain while the sender writes
+        const auto maxRecord = capacity / 2;
+        auto head = slot->head.load(std::memory_order_relaxed);
+        if (recordSize(size) <= maxRecord) {
+            if (!waitForSpace(head, recordSize(size))) {
+                return false;
+            }
+            const auto start = (head + recordHeaderSize) & mask;
+            if (start + size <= capacity) {
+                // serialize straight into the ring
+                cmd.toByteArray(ring + start, size);
+            } else {
+                buffer.resize(size);
+                cmd.toByteArray(buffer.data(), size);
+                copyToRing(ring, mask, head + recordHeaderSize, buffer.data(), size);
+            }
+            const auto length = static_cast<std::uint32_t>(size);
+            std::memcpy(ring + (head & mask), &length, sizeof(length));
+            slot->head.store(head + recordSize(size), std::memory_order_release);
+            ringDoorbell();
+            return true;
+        }
+        buffer.resize(size);
+        cmd.toByteArray(buffer.data(), size);
+        const auto maxPiece = static_cast<std::size_t>(maxRecord - 8);
+        std::size_t offset{0};
+        while (offset < size) {
+            const auto piece = std::min(maxPiece, size - offset);
+            if (!waitForSpace(head, recordSize(piece))) {
+                return false;
+            }
+            copyToRing(ring, mask, head + recordHeaderSize, buffer.data() + offset, piece);
+            offset += piece;
+            auto length = static_cast<std::uint32_t>(piece);
+            if (offset < size) {
+                length |= fragmentFlag;
+            }
+            std::memcpy(ring + (head & mask), &length, sizeof(length));
+            head += recordSize(piece);
+            slot->head.store(head, std::memory_order_release);
+            ringDoorbell();
+        }
+        return true;
+    }
+}  // namespace shm
+}  // namespace helics
@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "helics/core/ActionMessage.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace helics {
+namespace shm {
+    /** enumeration of mailbox states*/
+    enum class mailbox_state_t : std::uint32_t {
+        startup = 0,
+        connected = 1,
+        operating = 2,
+        closing = 3,
+    };
+
+    /** generate the name of the shared memory object used for a connection name*/
+    std::string mailboxName(const std::string& connection);
+
+    /** header placed at the start of a mailbox in shared memory*/
+    struct MailboxHeader {
+        std::atomic<std::uint64_t> magic;  //!< set once the mailbox is fully initialized
+        std::atomic<std::uint32_t> state;  //!< the mailbox_state_t of the receiver
+        std::uint32_t slotCount;  //!< the number of sender slots in the mailbox
+        std::uint64_t ringCapacity;  //!< the size of each ring in bytes (a power of 2)
+        std::atomic<std::uint32_t> slotsInUse;  //!< one past the highest slot ever claimed
+        alignas(64) std::atomic<std::uint32_t> doorbell;  //!< futex word for receiver wakeups
+        std::atomic<std::uint32_t> readerWaiting;  //!< set while the receiver is sleeping
+    };
+
+    /** control block for one single producer single consumer ring in a mailbox*/
+    struct SlotControl {
+        alignas(64) std::atomic<std::uint32_t> claim;  //!< free, claimed, or released
+        alignas(64) std::atomic<std::uint64_t> head;  //!< bytes written by the sender
+        alignas(64) std::atomic<std::uint64_t> tail;  //!< bytes consumed by the receiver
+    };
+
+    /** class owning a mailbox which receives messages from any number of senders
+    @details the mailbox is a POSIX shared memory object containing a set of lock free single
+    producer single consumer byte rings, one per connected sender, so senders never contend with
+    each other or take a lock.  The receiver sleeps on a futex in the shared memory header when all
+    the rings are empty*/
+    class OwnedMailbox {
+      private:
+        std::string connectionNameOrig;  //!< the connection name as specified
+        std::string connectionName;  //!< the name of the shared memory object
+        std::string errorString;  //!< description of the last error
+        std::byte* region{nullptr};  //!< the mapped shared memory
+        std::size_t regionSize{0};  //!< the size of the mapping
+        MailboxHeader* header{nullptr};
+        std::uint32_t nextSlot{0};  //!< the next slot to check for messages
+        /// storage for messages which wrap around the end of a ring
+        std::vector<std::byte> buffer;
+        bool connected = false;
+
+      public:
+        OwnedMailbox() = default;
+        ~OwnedMailbox();
+        OwnedMailbox(const OwnedMailbox&) = delete;
+        OwnedMailbox& operator=(const OwnedMailbox&) = delete;
+        /** create the mailbox
+        @param connection the name of the mailbox
+        @param maxSenders the number of senders which can be connected at the same time
+        @param ringSize the minimum size of each sender ring in bytes*/
+        bool connect(const std::string& connection, int maxSenders, std::size_t ringSize);
+
+        void changeState(mailbox_state_t newState);
+        /** get a message waiting up to timeout milliseconds for one to arrive, the message is not
+        checked for validity*/
+        std::optional<ActionMessage> getMessage(int timeout);
+        /** get a message waiting as long as necessary*/
+        ActionMessage getMessage();
+
+        const std::string& getError() const { return errorString; }
+
+      private:
+        /** try to read one message from the rings*/
+        std::optional<ActionMessage> readMessage();
+        /** wait for a sender to signal new data*/
+        void waitForData(int timeout);
+        void disconnect();
+    };
+
+    /** class implementing the sending side of a connection to a mailbox*/
+    class SendToMailbox {
+      private:
+        std::string connectionNameOrig;  //!< the connection name as specified
+        std::string connectionName;  //!< the name of the shared memory object
+        std::string errorString;  //!< buffer for any error code
+        std::byte* region{nullptr};  //!< the mapped shared memory
+        std::size_t regionSize{0};  //!< the size of the mapping
+        MailboxHeader* header{nullptr};
+        SlotControl* slot{nullptr};  //!< the claimed slot
+        std::byte* ring{nullptr};  //!< the data ring of the claimed slot
+        std::uint64_t mask{0};  //!< the ring capacity -1
+        std::vector<std::byte> buffer;  //!< storage for messages which wrap around the ring
+        bool connected = false;  //!< flag indicating connectivity
+
+      public:
+        SendToMailbox() = default;
+        ~SendToMailbox();
+        SendToMailbox(SendToMailbox&& other) noexcept;
+        SendToMailbox& operator=(SendToMailbox&& other) noexcept;
+        SendToMailbox(const SendToMailbox&) = delete;
+        SendToMailbox& operator=(const SendToMailbox&) = delete;
+
+        /** connect to a mailbox
+        @param connection the name of the mailbox
+        @param initOnly set to true to refuse connecting to a mailbox already operating
+        @param retries the number of times to retry if the mailbox is not available*/
+        bool connect(const std::string& connection, bool initOnly, int retries);
+        /** send a message to the mailbox
+        @return false if the mailbox is no longer available*/
+        bool sendMessage(const ActionMessage& cmd);
+        /** release the slot so it can be used by another sender*/
+        void disconnect();
+
+        const std::string& getError() const { return errorString; }
+
+      private:
+        /** wait for the receiver to free up space in the ring
+        @return false if the receiver has closed*/
+        bool waitForSpace(std::uint64_t head, std::uint64_t required);
+        void ringDoorbell();
+    };
+}  // namespace shm
+}  // namespace helics
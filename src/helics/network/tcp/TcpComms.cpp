@@ -10,10 +10,13 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../NetworkBrokerData.hpp"
 #include "../networkDefaults.hpp"
 #include "TcpCommsCommon.h"
+#include "TcpRouteSender.h"
 #include "gmlc/networking/AsioContextManager.h"
 #include "gmlc/networking/TcpHelperClasses.h"
 #include "gmlc/networking/TcpOperations.h"
 
+#include <algorithm>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -23,22 +26,19 @@ SPDX-License-Identifier: BSD-3-Clause
 namespace helics::tcp {
 using gmlc::networking::TcpConnection;
 
-template<class ErrorLogger>
-static void sendWithErrorLogging(const TcpConnection::pointer& connection,
-                                 const ActionMessage& cmd,
-                                 ErrorLogger&& errorLogger)
-{
-    try {
-        connection->send(cmd.packetize());
-    }
-    catch (const std::system_error& sendError) {
-        if (sendError.code() != asio::error::connection_aborted) {
-            if (!isDisconnectCommand(cmd)) {
-                errorLogger(sendError);
-            }
-        }
-    }
-}
+namespace {
+    /** packets accumulated for a single connection so they can be sent together*/
+    struct PendingTransmission {
+        TcpConnection::pointer connection;
+        std::string data;
+        route_id route;  //!< the route of the first command for error messages
+        action_message_def::action_t firstAction{CMD_IGNORE};  //!< the first command action
+        std::size_t messageCount{0};  //!< the number of commands in the data
+        bool logErrors{false};  //!< set if any of the commands is not a disconnect command
+    };
+    /// the number of bytes accumulated for a connection that triggers a transmission
+    constexpr std::size_t maxTransmissionBatch{64U * 1024U};
+}  // namespace
 
 TcpComms::TcpComms() noexcept: NetworkCommsInterface(gmlc::networking::InterfaceTypes::TCP) {}
 
@@ -55,6 +55,8 @@ void TcpComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
         return;
     }
     reuse_address = netInfo.reuse_address;
+    parallelSend = netInfo.parallelSend;
+    sendHighWaterMark = netInfo.sendHighWaterMark;
     encryption_config = netInfo.encryptionConfig;
     propertyUnLock();
 }
@@ -66,6 +68,11 @@ void TcpComms::setFlag(std::string_view flag, bool val)
             reuse_address = val;
             propertyUnLock();
         }
+    } else if (flag == "parallel_send") {
+        if (propertyLock()) {
+            parallelSend = val;
+            propertyUnLock();
+        }
     } else if (flag == "encrypted") {
         if (propertyLock()) {
             encrypted = val;
@@ -103,31 +110,22 @@ size_t TcpComms::dataReceive(gmlc::networking::TcpConnection* connection,
     size_t used_total = 0;
     while (used_total < bytes_received) {
         ActionMessage message;
-        auto used = message.depacketize(reinterpret_cast<const std::byte*>(data) + used_total,
-                                        bytes_received - used_total);
+        auto used = message.depacketize(data + used_total, bytes_received - used_total);
         if (used == 0) {
             break;
         }
-        if (isProtocolCommand(message)) {
-            // if the reply is not ignored respond with it otherwise
-            // forward the original message on to the receiver to handle
-            auto rep = generateReplyToIncomingMessage(message);
-            if (rep.action() != CMD_IGNORE) {
-                try {
-                    connection->send(rep.packetize());
-                }
-                catch (const std::system_error& error) {
-                    if (error.code() != asio::error::connection_aborted) {
-                        logWarning(std::string("protocol reply send failed: ") + error.what());
-                    }
+        if (isCompressedFrame(message)) {
+            std::vector<ActionMessage> messages;
+            if (extractCompressedFrame(message, messages)) {
+                for (auto& framedMessage : messages) {
+                    processReceivedMessage(connection, std::move(framedMessage));
                 }
-            } else {
-                rxMessageQueue.push(std::move(message));
             }
         } else {
-            if (ActionCallback) {
-                ActionCallback(std::move(message));
+            if (zeroCopyReceive) {
+                shareLargePayload(message);
             }
+            processReceivedMessage(connection, std::move(message));
         }
         used_total += used;
     }
@@ -135,6 +133,57 @@ size_t TcpComms::dataReceive(gmlc::networking::TcpConnection* connection,
     return used_total;
 }
 
+void TcpComms::shareLargePayload(ActionMessage& message)
+{
+    // the connection reuses its receive buffer so the data has already been copied out of it, a
+    // large value payload is moved into a shared buffer so copies of the message do not copy it
+    // again and only the buffer of that payload is retained by values referencing it
+    if ((message.action() == CMD_PUB || message.action() == CMD_PUB_BATCH) &&
+        message.payload.size() >= zeroCopyPayloadThreshold) {
+        message.setSharedPayload(message.extractSharedPayload());
+    }
+}
+
+void TcpComms::processReceivedMessage(gmlc::networking::TcpConnection* connection,
+                                      ActionMessage&& message)
+{
+    if (isProtocolCommand(message)) {
+        if (message.messageID == CONNECTION_INFORMATION) {
+            // a child connecting from the warm start cache sends this in place of a connection
+            // request, the mask is used when the route to the child is created
+            recordPeerCompression(message);
+            return;
+        }
+        // if the reply is not ignored respond with it otherwise
+        // forward the original message on to the receiver to handle
+        auto rep = generateReplyToIncomingMessage(message);
+        if (rep.action() != CMD_IGNORE) {
+            try {
+                connection->send(rep.packetize());
+            }
+            catch (const std::system_error& error) {
+                if (error.code() != asio::error::connection_aborted) {
+                    logWarning(std::string("protocol reply send failed: ") + error.what());
+                }
+            }
+        } else {
+            rxMessageQueue.push(std::move(message));
+        }
+    } else {
+        if (ActionCallback) {
+            ActionCallback(std::move(message));
+        }
+    }
+}
+
+void TcpComms::compressTransmission(std::string& data, CompressionType type)
+{
+    auto frame = generateCompressedFrame(data, type);
+    if (frame.action() != CMD_IGNORE) {
+        frame.packetize(data);
+    }
+}
+
 void TcpComms::queue_rx_function()
 {
     while (PortNumber < 0) {
@@ -225,6 +274,36 @@ void TcpComms::queue_rx_function()
     setRxStatus(ConnectionStatus::TERMINATED);
 }
 
+void TcpComms::requestRouteCompression(route_id rid, const TcpConnection::pointer& connection)
+{
+    // the route is not compressed until the other end replies with the compression it supports
+    ActionMessage request(CMD_PROTOCOL_PRIORITY);
+    request.messageID = CONNECTION_REQUEST;
+    try {
+        connection->send(request.packetize());
+    }
+    catch (const std::system_error& error) {
+        logWarning(std::string("unable to request the compression of route ") +
+                   std::to_string(rid.baseValue()) + "::" + error.what());
+        return;
+    }
+    auto receivedData = std::make_shared<std::vector<char>>(512);
+    connection->async_receive(
+        receivedData->data(),
+        128,
+        [this, rid, receivedData](const std::error_code& error, size_t bytes) {
+            if (error) {
+                return;
+            }
+            ActionMessage reply(reinterpret_cast<const std::byte*>(receivedData->data()), bytes);
+            if (isProtocolCommand(reply) && reply.messageID == CONNECTION_ACK) {
+                // the route id identifies the route the reply belongs to in the transmit loop
+                reply.setExtraData(rid.baseValue());
+                txQueue.emplace(control_route, std::move(reply));
+            }
+        });
+}
+
 void TcpComms::txReceive(const char* data, size_t bytes_received, const std::string& errorMessage)
 {
     if (errorMessage.empty()) {
@@ -314,12 +393,24 @@ bool TcpComms::establishBrokerConnection(
         bool connectionEstablished{false};
         if (PortNumber > 0 && NetworkCommsInterface::noAckConnection) {
             connectionEstablished = true;
+        } else if (PortNumber > 0 && warmStartConnection) {
+            // the compression of the broker is known from the cache so nothing is acknowledged,
+            // the broker gets the address and compression of this end in the first message
+            negotiateParentCompression(warmStartCompression);
+            try {
+                brokerConnection->send(generateConnectionInformation().packetize());
+            }
+            catch (const std::system_error& error) {
+                logError(std::string("error in initial send to broker ") + error.what());
+                return terminate(ConnectionStatus::ERRORED);
+            }
+            connectionEstablished = true;
         }
         while (!connectionEstablished) {
             ActionMessage request(CMD_PROTOCOL_PRIORITY);
             request.messageID = (PortNumber <= 0) ? REQUEST_PORTS : CONNECTION_REQUEST;
 
-            request.setStringData(brokerName, brokerInitString);
+            request.setStringData(brokerName, brokerInitString, name);
             try {
                 brokerConnection->send(request.packetize());
             }
@@ -345,6 +436,7 @@ bool TcpComms::establishBrokerConnection(
                 if (isProtocolCommand(mess->second)) {
                     if (mess->second.messageID == PORT_DEFINITIONS) {
                         if (PortNumber <= 0) {
+                            negotiateParentCompression(mess->second);
                             rxMessageQueue.push(mess->second);
                             connectionEstablished = true;
                             continue;
@@ -352,6 +444,7 @@ bool TcpComms::establishBrokerConnection(
                     }
                     if (mess->second.messageID == CONNECTION_ACK) {
                         if (PortNumber > 0) {
+                            negotiateParentCompression(mess->second);
                             connectionEstablished = true;
                             continue;
                         }
@@ -363,8 +456,8 @@ bool TcpComms::establishBrokerConnection(
                         logMessage("got new broker information");
                         brokerConnection->close();
 
-                        auto brkprt =
-                            gmlc::networking::extractInterfaceAndPort(mess->second.getString(0));
+                        auto brkprt = gmlc::networking::extractInterfaceAndPort(
+                            std::string(mess->second.getString(0)));
                         if (brkprt.second) {
                             brokerPort = *brkprt.second;
                         }
@@ -443,7 +536,99 @@ void TcpComms::queue_tx_function()
     }
     setTxStatus(ConnectionStatus::CONNECTED);
 
-    //  std::vector<ActionMessage> txlist;
+    auto routeName = [&brokerConnection](route_id rid, const TcpConnection::pointer& connection) {
+        return std::string((connection == brokerConnection) ? "broker route " : "route ") +
+            std::to_string(rid.baseValue());
+    };
+    // the compression negotiated with each route, shared with the route senders
+    std::map<TcpConnection*, std::shared_ptr<std::atomic<CompressionType>>> routeCompression;
+    auto compressionFor = [&routeCompression](const TcpConnection::pointer& connection) {
+        auto& negotiated = routeCompression[connection.get()];
+        if (!negotiated) {
+            negotiated = std::make_shared<std::atomic<CompressionType>>(CompressionType::NONE);
+        }
+        return negotiated;
+    };
+    std::vector<PendingTransmission> pending;
+    auto transmitPending = [this, &pending, &brokerConnection, &routeName, &compressionFor]() {
+        for (auto& transmission : pending) {
+            if (transmission.data.empty()) {
+                continue;
+            }
+            compressTransmission(transmission.data,
+                                 (transmission.connection == brokerConnection) ?
+                                     parentCompression.load() :
+                                     compressionFor(transmission.connection)->load());
+            try {
+                transmission.connection->send(transmission.data);
+            }
+            catch (const std::system_error& sendError) {
+                if (sendError.code() != asio::error::connection_aborted &&
+                    transmission.logErrors) {
+                    logError(std::string("tcp send failure on ") +
+                             routeName(transmission.route, transmission.connection) + " (" +
+                             std::to_string(transmission.messageCount) +
+                             " messages starting with " +
+                             actionMessageType(transmission.firstAction) + ")::" +
+                             sendError.what());
+                }
+            }
+            // the buffer is retained for the next set of packets
+            transmission.data.clear();
+            transmission.messageCount = 0;
+            transmission.logErrors = false;
+        }
+    };
+    // with parallel sends each route has its own thread and a slow connection only holds up the
+    // messages for that route until its high water mark is reached
+    std::map<TcpConnection*, std::unique_ptr<TcpRouteSender>> routeSenders;
+    auto addPending = [this,
+                       &pending,
+                       &transmitPending,
+                       &routeSenders,
+                       &brokerConnection,
+                       &routeName,
+                       &compressionFor](route_id rid,
+                                        const TcpConnection::pointer& connection,
+                                        const ActionMessage& command) {
+        if (parallelSend) {
+            auto& routeSender = routeSenders[connection.get()];
+            if (!routeSender) {
+                std::shared_ptr<std::atomic<CompressionType>> negotiated;
+                if (connection != brokerConnection) {
+                    negotiated = compressionFor(connection);
+                }
+                routeSender = std::make_unique<TcpRouteSender>(
+                    connection,
+                    sendHighWaterMark,
+                    routeName(rid, connection),
+                    [this](std::string_view message) { logError(message); },
+                    [this, negotiated](std::string& data) {
+                        compressTransmission(data,
+                                             negotiated ? negotiated->load() :
+                                                          parentCompression.load());
+                    });
+            }
+            routeSender->send(command);
+            return;
+        }
+        auto entry = std::find_if(pending.begin(), pending.end(), [&connection](const auto& tx) {
+            return tx.connection == connection;
+        });
+        if (entry == pending.end()) {
+            pending.emplace_back().connection = connection;
+            entry = std::prev(pending.end());
+        }
+        if (entry->messageCount++ == 0) {
+            entry->route = rid;
+            entry->firstAction = command.action();
+        }
+        command.appendPacket(entry->data);
+        entry->logErrors = entry->logErrors || !isDisconnectCommand(command);
+        if (entry->data.size() >= maxTransmissionBatch) {
+            transmitPending();
+        }
+    };
     bool processing{true};
     while (processing) {
         route_id rid;
@@ -453,6 +638,9 @@ void TcpComms::queue_tx_function()
         bool processed = false;
         if (isProtocolCommand(cmd)) {
             if (rid == control_route) {
+                // route changes and disconnects must come after anything already queued
+                transmitPending();
+                pending.clear();
                 switch (cmd.messageID) {
                     case NEW_ROUTE: {
                         auto newroute = cmd.payload.to_string();
@@ -465,6 +653,13 @@ void TcpComms::queue_tx_function()
                                                                      interface,
                                                                      port ? *port : "");
 
+                            const auto peerMask = takePeerCompression(newroute);
+                            if (peerMask >= 0) {
+                                // the child sent its compression when it connected
+                                compressionFor(new_connect)->store(negotiateCompression(peerMask));
+                            } else if (compression != CompressionType::NONE) {
+                                requestRouteCompression(route_id{cmd.getExtraData()}, new_connect);
+                            }
                             routes.emplace(route_id{cmd.getExtraData()}, std::move(new_connect));
                         }
                         catch (std::exception& e) {
@@ -473,10 +668,23 @@ void TcpComms::queue_tx_function()
                         }
                         processed = true;
                     } break;
-                    case REMOVE_ROUTE:
-                        routes.erase(route_id{cmd.getExtraData()});
+                    case REMOVE_ROUTE: {
+                        auto routeFnd = routes.find(route_id{cmd.getExtraData()});
+                        if (routeFnd != routes.end()) {
+                            routeSenders.erase(routeFnd->second.get());
+                            routeCompression.erase(routeFnd->second.get());
+                            routes.erase(routeFnd);
+                        }
                         processed = true;
-                        break;
+                    } break;
+                    case CONNECTION_ACK: {
+                        // the reply to the compression request sent when the route was created
+                        auto routeFnd = routes.find(route_id{cmd.getExtraData()});
+                        if (routeFnd != routes.end()) {
+                            compressionFor(routeFnd->second)->store(negotiateCompression(cmd));
+                        }
+                        processed = true;
+                    } break;
                     case CLOSE_RECEIVER:
                         rxMessageQueue.push(cmd);
                         processed = true;
@@ -496,44 +704,23 @@ void TcpComms::queue_tx_function()
             continue;
         }
 
+        if (cmd.action() == CMD_BROKER_ACK) {
+            // a child given the same id on the next start can register without waiting on it
+            recordAssignedId(cmd);
+        }
         if (rid == parent_route_id) {
             if (hasBroker) {
-                sendWithErrorLogging(brokerConnection,
-                                     cmd,
-                                     [this, &cmd](const std::system_error& sendError) {
-                                         logError(std::string("broker send 0 ") +
-                                                  actionMessageType(cmd.action()) + ':' +
-                                                  sendError.what());
-                                     });
-
-                // if (error)
-                {
-                    //     std::cerr << "transmit failure to broker " << error.message() <<
-                    //     '\n';
-                }
+                addPending(rid, brokerConnection, cmd);
             }
         } else if (rid == control_route) {  // send to rx thread loop
             rxMessageQueue.push(cmd);
         } else {
-            //  txlist.push_back(cmd);
             auto rt_find = routes.find(rid);
             if (rt_find != routes.end()) {
-                sendWithErrorLogging(rt_find->second,
-                                     cmd,
-                                     [this, rid](const std::system_error& sendError) {
-                                         logError(std::string("rt send ") +
-                                                  std::to_string(rid.baseValue()) +
-                                                  "::" + sendError.what());
-                                     });
+                addPending(rid, rt_find->second, cmd);
             } else {
                 if (hasBroker) {
-                    sendWithErrorLogging(brokerConnection,
-                                         cmd,
-                                         [this, rid](const std::system_error& sendError) {
-                                             logError(std::string("broker send") +
-                                                      std::to_string(rid.baseValue()) +
-                                                      " ::" + sendError.what());
-                                         });
+                    addPending(rid, brokerConnection, cmd);
                 } else {
                     if (!isDisconnectCommand(cmd)) {
                         logWarning(
@@ -543,7 +730,14 @@ void TcpComms::queue_tx_function()
                 }
             }
         }
+        // everything available is combined into as few transmissions as possible
+        if (txQueue.empty()) {
+            transmitPending();
+        }
     }
+    transmitPending();
+    // stopping the senders sends anything still queued
+    routeSenders.clear();
     for (auto& routeEntry : routes) {
         routeEntry.second->close();
     }
@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/containers/BlockingQueue.hpp"
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <string>
@@ -35,6 +36,9 @@ class TcpComms final: public NetworkCommsInterface {
 
   private:
     bool reuse_address{false};
+    bool parallelSend{false};  //!< use a separate send thread for each route
+    /// the number of bytes queued for a route at which sending blocks when using parallel sends
+    std::size_t sendHighWaterMark{4U * 1024U * 1024U};
     std::string encryption_config;
     virtual int getDefaultBrokerPort() const override;
     virtual void queue_rx_function() override;  //!< the functional loop for the receive queue
@@ -63,6 +67,18 @@ return code for required action 0=NONE, -1 TERMINATE*/
     size_t dataReceive(gmlc::networking::TcpConnection* connection,
                        const char* data,
                        size_t bytes_received);
+    /** ask the other end of a new route which compression it supports, the reply is handled in
+    the transmit loop*/
+    void requestRouteCompression(
+        route_id rid,
+        const std::shared_ptr<gmlc::networking::TcpConnection>& connection);
+    /** move a large value payload into a shared buffer if zero copy receive is enabled*/
+    void shareLargePayload(ActionMessage& message);
+    /** handle a single message received on a connection*/
+    void processReceivedMessage(gmlc::networking::TcpConnection* connection,
+                                ActionMessage&& message);
+    /** replace the packets in a transmission with a compressed frame if it is worthwhile*/
+    void compressTransmission(std::string& data, CompressionType type);
 
     //  bool errorHandle()
 };
@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TcpCommsSS.h"
 
 #include "../../core/ActionMessage.hpp"
+#include "../CommsEventLoop.hpp"
 #include "../NetworkBrokerData.hpp"
 #include "../networkDefaults.hpp"
 #include "TcpCommsCommon.h"
@@ -15,8 +16,14 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/networking/TcpHelperClasses.h"
 #include "gmlc/networking/TcpOperations.h"
 
+#include <asio/steady_timer.hpp>
+#include <chrono>
+#include <deque>
+#include <fmt/format.h>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -24,6 +31,140 @@ SPDX-License-Identifier: BSD-3-Clause
 namespace helics::tcp {
 using gmlc::networking::TcpConnection;
 
+/** writes the packetized messages for a connection with asynchronous sends
+@details used when the transmissions are processed on the shared event loop so its threads
+never block on a socket.  Only one send is outstanding at a time so the data goes out in
+order, and messages queued before the connection is established are held until it is*/
+class AsyncWriter: public std::enable_shared_from_this<AsyncWriter> {
+  public:
+    AsyncWriter(TcpConnection::pointer conn,
+                asio::io_context& context,
+                std::chrono::milliseconds connectionTimeout,
+                std::function<void(const std::string&)> errorLog):
+        connection(std::move(conn)), timer(context), timeout(connectionTimeout),
+        logger(std::move(errorLog))
+    {
+    }
+    /** set a function to call once the connection is established*/
+    void setConnectedCall(std::function<void()> call)
+    {
+        const std::lock_guard<std::mutex> lock(writeLock);
+        onConnected = std::move(call);
+    }
+    /** queue data to send on the connection*/
+    void send(std::string data)
+    {
+        const std::lock_guard<std::mutex> lock(writeLock);
+        queue.push_back(std::move(data));
+        if (!writing) {
+            writing = true;
+            startNext();
+        }
+    }
+    /** check if all the queued data has been sent*/
+    bool idle() const
+    {
+        const std::lock_guard<std::mutex> lock(writeLock);
+        return !writing;
+    }
+    /** stop reporting errors, the comms may be going away*/
+    void release()
+    {
+        const std::lock_guard<std::mutex> lock(writeLock);
+        logger = nullptr;
+    }
+
+  private:
+    // all the private functions are called with the writeLock held
+    void startNext()
+    {
+        if (!connection->isConnected()) {
+            if (!waiting) {
+                waiting = true;
+                deadline = std::chrono::steady_clock::now() + timeout;
+            }
+            timer.expires_after(std::chrono::milliseconds(5));
+            timer.async_wait([self = shared_from_this()](const std::error_code& error) {
+                const std::lock_guard<std::mutex> lock(self->writeLock);
+                self->connectionCheck(error);
+            });
+            return;
+        }
+        if (waiting) {
+            waiting = false;
+            if (onConnected) {
+                onConnected();
+                onConnected = nullptr;
+            }
+        }
+        const auto& data = queue.front();
+        connection->send_async(data.data() + offset,
+                               data.size() - offset,
+                               [self = shared_from_this()](const std::error_code& error,
+                                                           std::size_t bytes) {
+                                   const std::lock_guard<std::mutex> lock(self->writeLock);
+                                   self->sent(error, bytes);
+                               });
+    }
+    void connectionCheck(const std::error_code& error)
+    {
+        if (error) {
+            fail(std::string{});
+            return;
+        }
+        if (!connection->isConnected() && std::chrono::steady_clock::now() > deadline) {
+            waiting = false;
+            fail("connection timed out");
+            return;
+        }
+        startNext();
+    }
+    void sent(const std::error_code& error, std::size_t bytes)
+    {
+        if (error) {
+            if (error == asio::error::connection_aborted ||
+                error == asio::error::operation_aborted) {
+                fail(std::string{});
+            } else {
+                fail(error.message());
+            }
+            return;
+        }
+        offset += bytes;
+        if (offset >= queue.front().size()) {
+            queue.pop_front();
+            offset = 0;
+        }
+        if (queue.empty()) {
+            writing = false;
+        } else {
+            startNext();
+        }
+    }
+    /** drop the queued data, the next send tries the connection again*/
+    void fail(const std::string& error)
+    {
+        if (!error.empty() && logger) {
+            logger(fmt::format("dropped {} messages :: {}", queue.size(), error));
+        }
+        queue.clear();
+        offset = 0;
+        writing = false;
+    }
+
+    TcpConnection::pointer connection;
+    asio::steady_timer timer;  //!< timer for checking on a connection in progress
+    std::chrono::milliseconds timeout;
+    std::function<void(const std::string&)> logger;
+    std::function<void()> onConnected;
+    mutable std::mutex writeLock;
+    std::deque<std::string> queue;  //!< data waiting to be sent
+    std::size_t offset{0};  //!< the bytes of the front of the queue already sent
+    std::chrono::steady_clock::time_point deadline;
+    bool writing{false};  //!< a send or connection check is in progress
+    bool waiting{false};  //!< waiting for the connection to be established
+};
+
 TcpCommsSS::TcpCommsSS() noexcept:
     NetworkCommsInterface(gmlc::networking::InterfaceTypes::TCP,
                           CommsInterface::thread_generation::single)
@@ -34,6 +175,10 @@ TcpCommsSS::TcpCommsSS() noexcept:
 TcpCommsSS::~TcpCommsSS()
 {
     disconnect();
+    if (txTask) {
+        eventLoopActive.store(false);
+        txTask->cancel();
+    }
 }
 
 /** load network information into the comms object*/
@@ -45,6 +190,8 @@ void TcpCommsSS::loadNetworkInfo(const NetworkBrokerData& netInfo)
     }
     reuse_address = netInfo.reuse_address;
     encryption_config = netInfo.encryptionConfig;
+    useEventLoop = netInfo.useEventLoop;
+    eventLoopThreads = netInfo.eventLoopThreads;
     propertyUnLock();
 }
 
@@ -91,6 +238,11 @@ void TcpCommsSS::setFlag(std::string_view flag, bool val)
             encrypted = val;
             propertyUnLock();
         }
+    } else if (flag == "event_loop") {
+        if (propertyLock()) {
+            useEventLoop = val;
+            propertyUnLock();
+        }
     } else {
         NetworkCommsInterface::setFlag(flag, val);
     }
@@ -123,6 +275,7 @@ size_t TcpCommsSS::dataReceive(TcpConnection* connection, const char* data, size
         if (isProtocolCommand(m)) {
             m.setExtraData(connection->getIdentifier());
             txQueue.emplace(control_route, std::move(m));
+            transmitQueued();
         } else {
             if (ActionCallback) {
                 ActionCallback(std::move(m));
@@ -139,6 +292,26 @@ void TcpCommsSS::queue_rx_function()
     // this function does nothing since everything is handled in the other thread
 }
 
+/** the connections and other state used by the transmit processing*/
+struct TcpCommsSS::TxState {
+    std::shared_ptr<gmlc::networking::AsioContextManager> ioctx;
+    decltype(std::declval<gmlc::networking::AsioContextManager&>().startContextLoop()) contextLoop;
+    gmlc::networking::SocketFactory sf;
+    gmlc::networking::TcpServer::pointer server;
+    std::function<size_t(const TcpConnection::pointer&, const char*, size_t)> dataCall;
+    std::function<bool(const TcpConnection::pointer&, const std::error_code&)> errorCall;
+    std::string cstring;  //!< the packetized connection information message
+    std::vector<std::pair<std::string, TcpConnection::pointer>> made_connections;
+    std::map<std::string, route_id> established_routes;
+    TcpConnection::pointer brokerConnection;
+    std::map<route_id, TcpConnection::pointer> routes;  // for all the other possible routes
+    /// send asynchronously through the writers, set when running on the event loop
+    bool asyncSends{false};
+    std::map<const TcpConnection*, std::shared_ptr<AsyncWriter>> writers;
+    std::unique_ptr<asio::steady_timer> closeTimer;  //!< timer for waiting on the writers
+    std::chrono::steady_clock::time_point closeDeadline;  //!< the latest time to close
+};
+
 void TcpCommsSS::queue_tx_function()
 {
     if (serverMode && (PortNumber < 0)) {
@@ -150,17 +323,21 @@ void TcpCommsSS::queue_tx_function()
         setTxStatus(ConnectionStatus::ERRORED);
         return;
     }
-    gmlc::networking::TcpServer::pointer server;
-    auto ioctx = gmlc::networking::AsioContextManager::getContextPointer();
-    auto sf = encrypted ? gmlc::networking::SocketFactory(encryption_config) :
-                          gmlc::networking::SocketFactory();
-    auto contextLoop = ioctx->startContextLoop();
-    auto dataCall =
+    auto state = std::make_unique<TxState>();
+    auto& ioctx = state->ioctx;
+    auto& sf = state->sf;
+    auto& server = state->server;
+    ioctx = gmlc::networking::AsioContextManager::getContextPointer();
+    sf = encrypted ? gmlc::networking::SocketFactory(encryption_config) :
+                     gmlc::networking::SocketFactory();
+    state->contextLoop = ioctx->startContextLoop();
+    state->dataCall =
         [this](const TcpConnection::pointer& connection, const char* data, size_t datasize) {
             return dataReceive(connection.get(), data, datasize);
         };
     CommsInterface* ci = this;
-    auto errorCall = [ci](const TcpConnection::pointer& connection, const std::error_code& error) {
+    state->errorCall = [ci](const TcpConnection::pointer& connection,
+                            const std::error_code& error) {
         return commErrorHandler(ci, connection.get(), error);
     };
 
@@ -183,8 +360,8 @@ void TcpCommsSS::queue_tx_function()
                 return;
             }
         }
-        server->setDataCall(dataCall);
-        server->setErrorCall(errorCall);
+        server->setDataCall(state->dataCall);
+        server->setErrorCall(state->errorCall);
         server->start();
     }
 
@@ -192,10 +369,8 @@ void TcpCommsSS::queue_tx_function()
     ActionMessage cmessage(CMD_PROTOCOL);
     cmessage.messageID = CONNECTION_INFORMATION;
     cmessage.payload = getAddress();
-    auto cstring = cmessage.packetize();
+    state->cstring = cmessage.packetize();
 
-    std::vector<std::pair<std::string, TcpConnection::pointer>> made_connections;
-    std::map<std::string, route_id> established_routes;
     if (outgoingConnectionsAllowed) {
         for (const auto& conn : connections) {
             try {
@@ -203,12 +378,12 @@ void TcpCommsSS::queue_tx_function()
                     gmlc::networking::establishConnection(sf, ioctx->getBaseContext(), conn);
 
                 if (new_connect) {
-                    new_connect->setDataCall(dataCall);
-                    new_connect->setErrorCall(errorCall);
-                    new_connect->send(cstring);
+                    new_connect->setDataCall(state->dataCall);
+                    new_connect->setErrorCall(state->errorCall);
+                    new_connect->send(state->cstring);
                     new_connect->startReceive();
 
-                    made_connections.emplace_back(conn, std::move(new_connect));
+                    state->made_connections.emplace_back(conn, std::move(new_connect));
                 }
             }
             catch (const std::exception& e) {
@@ -218,11 +393,8 @@ void TcpCommsSS::queue_tx_function()
         }
     }
     setRxStatus(ConnectionStatus::CONNECTED);
-    std::vector<char> buffer;
 
-    TcpConnection::pointer brokerConnection;
-
-    std::map<route_id, TcpConnection::pointer> routes;  // for all the other possible routes
+    auto& brokerConnection = state->brokerConnection;
     if (!brokerTargetAddress.empty()) {
         hasBroker = true;
     }
@@ -249,10 +421,10 @@ void TcpCommsSS::queue_tx_function()
                     return;
                 }
 
-                brokerConnection->setDataCall(dataCall);
-                brokerConnection->setErrorCall(errorCall);
+                brokerConnection->setDataCall(state->dataCall);
+                brokerConnection->setErrorCall(state->errorCall);
 
-                brokerConnection->send(cstring);
+                brokerConnection->send(state->cstring);
                 brokerConnection->startReceive();
             }
             catch (std::exception& e) {
@@ -262,203 +434,381 @@ void TcpCommsSS::queue_tx_function()
                 setRxStatus(ConnectionStatus::ERRORED);
                 return;
             }
-            established_routes[gmlc::networking::makePortAddress(brokerTargetAddress, brokerPort)] =
+            state->established_routes[gmlc::networking::makePortAddress(brokerTargetAddress,
+                                                                        brokerPort)] =
                 parent_route_id;
         }
     }
 
+    if (useEventLoop) {
+        // hand the connections to the shared event loop and let this thread finish
+        CommsEventLoop::setSharedThreadCount(eventLoopThreads);
+        state->asyncSends = true;
+        txState = std::move(state);
+        txTask = std::make_unique<CommsEventTask>(CommsEventLoop::getSharedLoop(),
+                                                  [this]() { drainTransmitQueue(); });
+        eventLoopActive.store(true);
+        setTxStatus(ConnectionStatus::CONNECTED);
+        // anything queued during the setup has not triggered the task
+        txTask->trigger();
+        return;
+    }
+
     setTxStatus(ConnectionStatus::CONNECTED);
 
-    bool haltLoop{false};
-    //  std::vector<ActionMessage> txlist;
-    while (!haltLoop) {
-        route_id rid;
-        ActionMessage cmd;
-
-        std::tie(rid, cmd) = txQueue.pop();
-        bool processed = false;
-        if (isProtocolCommand(cmd)) {
-            if (rid == control_route) {
-                processed = true;
-                switch (cmd.messageID) {
-                    case CONNECTION_INFORMATION:
-                        if (server) {
-                            auto conn = server->findSocket(cmd.getExtraData());
-                            if (conn) {
-                                if (!brokerConnection) {  // check if the connection matches the
-                                                          // broker
-                                    if ((cmd.payload.to_string() == brokerName) ||
-                                        (cmd.payload.to_string() ==
-                                         gmlc::networking::makePortAddress(brokerTargetAddress,
-                                                                           brokerPort))) {
-                                        brokerConnection = std::move(conn);
-                                        break;
-                                    }
-                                }
-                                if (conn) {
-                                    made_connections.emplace_back(cmd.payload.to_string(),
-                                                                  std::move(conn));
+    while (true) {
+        auto [rid, cmd] = txQueue.pop();
+        if (!processTxMessage(*state, rid, cmd)) {
+            break;
+        }
+    }
+    closeTxState(*state);
+}
+
+void TcpCommsSS::transmitQueued()
+{
+    if (eventLoopActive.load()) {
+        txTask->trigger();
+    }
+}
+
+void TcpCommsSS::drainTransmitQueue()
+{
+    if (!eventLoopActive.load()) {
+        return;
+    }
+    try {
+        auto item = txQueue.try_pop();
+        while (item) {
+            if (!processTxMessage(*txState, item->first, item->second)) {
+                eventLoopActive.store(false);
+                closeTxState(*txState);
+                return;
+            }
+            item = txQueue.try_pop();
+        }
+    }
+    catch (const std::exception& e) {
+        eventLoopActive.store(false);
+        setTxStatus(ConnectionStatus::ERRORED);
+        logError(std::string("error in transmitter >") + e.what());
+    }
+}
+
+bool TcpCommsSS::processTxMessage(TxState& state, route_id rid, ActionMessage& cmd)
+{
+    auto& brokerConnection = state.brokerConnection;
+    auto& routes = state.routes;
+    auto& established_routes = state.established_routes;
+    if (isProtocolCommand(cmd)) {
+        if (rid == control_route) {
+            switch (cmd.messageID) {
+                case CONNECTION_INFORMATION:
+                    if (state.server) {
+                        auto conn = state.server->findSocket(cmd.getExtraData());
+                        if (conn) {
+                            if (!brokerConnection) {  // check if the connection matches the
+                                                      // broker
+                                if ((cmd.payload.to_string() == brokerName) ||
+                                    (cmd.payload.to_string() ==
+                                     gmlc::networking::makePortAddress(brokerTargetAddress,
+                                                                       brokerPort))) {
+                                    brokerConnection = std::move(conn);
+                                    break;
                                 }
-                            } else {
-                                logWarning("(tcpss) unable to locate socket");
                             }
-                        }
-                        break;
-                    case NEW_ROUTE: {
-                        bool established = false;
-
-                        for (auto& mc : made_connections) {
-                            if ((mc.second) && (cmd.payload.to_string() == mc.first)) {
-                                routes.emplace(route_id{cmd.getExtraData()}, std::move(mc.second));
-                                established = true;
-                                established_routes[mc.first] = route_id{cmd.getExtraData()};
+                            if (conn) {
+                                state.made_connections.emplace_back(cmd.payload.to_string(),
+                                                                    std::move(conn));
                             }
+                        } else {
+                            logWarning("(tcpss) unable to locate socket");
                         }
-                        if (!established) {
-                            auto efind =
-                                established_routes.find(std::string(cmd.payload.to_string()));
-                            if (efind != established_routes.end()) {
-                                established = true;
-                                if (efind->second == parent_route_id) {
-                                    routes.emplace(route_id{cmd.getExtraData()}, brokerConnection);
-                                } else {
-                                    routes.emplace(route_id{cmd.getExtraData()},
-                                                   routes[efind->second]);
-                                }
+                    }
+                    break;
+                case NEW_ROUTE: {
+                    bool established = false;
+
+                    for (auto& mc : state.made_connections) {
+                        if ((mc.second) && (cmd.payload.to_string() == mc.first)) {
+                            routes.emplace(route_id{cmd.getExtraData()}, std::move(mc.second));
+                            established = true;
+                            established_routes[mc.first] = route_id{cmd.getExtraData()};
+                        }
+                    }
+                    if (!established) {
+                        auto efind = established_routes.find(std::string(cmd.payload.to_string()));
+                        if (efind != established_routes.end()) {
+                            established = true;
+                            if (efind->second == parent_route_id) {
+                                routes.emplace(route_id{cmd.getExtraData()}, brokerConnection);
+                            } else {
+                                routes.emplace(route_id{cmd.getExtraData()}, routes[efind->second]);
                             }
                         }
+                    }
 
-                        if (!established) {
-                            if (outgoingConnectionsAllowed) {
-                                try {
-                                    auto new_connect = gmlc::networking::establishConnection(
-                                        sf,
-                                        ioctx->getBaseContext(),
+                    if (!established) {
+                        if (outgoingConnectionsAllowed) {
+                            try {
+                                TcpConnection::pointer new_connect;
+                                if (state.asyncSends) {
+                                    new_connect = startConnection(
+                                        state, std::string(cmd.payload.to_string()));
+                                } else {
+                                    new_connect = gmlc::networking::establishConnection(
+                                        state.sf,
+                                        state.ioctx->getBaseContext(),
                                         std::string(cmd.payload.to_string()));
                                     if (new_connect) {
-                                        new_connect->setDataCall(dataCall);
-                                        new_connect->setErrorCall(errorCall);
-                                        new_connect->send(cstring);
+                                        new_connect->setDataCall(state.dataCall);
+                                        new_connect->setErrorCall(state.errorCall);
+                                        new_connect->send(state.cstring);
                                         new_connect->startReceive();
-                                        routes.emplace(route_id{cmd.getExtraData()},
-                                                       std::move(new_connect));
-                                        established_routes[std::string(cmd.payload.to_string())] =
-                                            route_id{cmd.getExtraData()};
                                     }
                                 }
-                                catch (const std::exception& e) {
-                                    logWarning(std::string("unable to establish connection with ") +
-                                               std::string(cmd.payload.to_string()) +
-                                               "::" + e.what());
+                                if (new_connect) {
+                                    routes.emplace(route_id{cmd.getExtraData()},
+                                                   std::move(new_connect));
+                                    established_routes[std::string(cmd.payload.to_string())] =
+                                        route_id{cmd.getExtraData()};
                                 }
-                            } else {
-                                logWarning(std::string("outgoing connections not allowed ") +
-                                           std::string(cmd.payload.to_string()));
                             }
+                            catch (const std::exception& e) {
+                                logWarning(std::string("unable to establish connection with ") +
+                                           std::string(cmd.payload.to_string()) + "::" + e.what());
+                            }
+                        } else {
+                            logWarning(std::string("outgoing connections not allowed ") +
+                                       std::string(cmd.payload.to_string()));
                         }
-                    } break;
-                    case REMOVE_ROUTE:
-                        routes.erase(route_id{cmd.getExtraData()});
-                        processed = true;
-                        break;
-                    case CLOSE_RECEIVER:
-                        setRxStatus(ConnectionStatus::TERMINATED);
-                        break;
-                    case DISCONNECT:
-                        haltLoop = true;
-                        continue;
-                    default:
-                        logWarning("unrecognized control command");
-                        break;
-                }
+                    }
+                } break;
+                case REMOVE_ROUTE: {
+                    auto routeFnd = routes.find(route_id{cmd.getExtraData()});
+                    if (routeFnd != routes.end()) {
+                        auto connection = std::move(routeFnd->second);
+                        routes.erase(routeFnd);
+                        releaseWriter(state, connection);
+                    }
+                } break;
+                case CLOSE_RECEIVER:
+                    setRxStatus(ConnectionStatus::TERMINATED);
+                    break;
+                case DISCONNECT:
+                    return false;
+                default:
+                    logWarning("unrecognized control command");
+                    break;
             }
+            return true;
         }
-        if (processed) {
-            continue;
-        }
+    }
 
-        if (rid == parent_route_id) {
-            if ((hasBroker) && (brokerConnection)) {
-                try {
-                    brokerConnection->send(cmd.packetize());
+    if (rid == parent_route_id) {
+        if ((hasBroker) && (brokerConnection)) {
+            if (state.asyncSends) {
+                writerFor(state, brokerConnection).send(cmd.packetize());
+                return true;
+            }
+            try {
+                brokerConnection->send(cmd.packetize());
+            }
+            catch (const std::system_error& se) {
+                if (se.code() != asio::error::connection_aborted) {
+                    if (!isDisconnectCommand(cmd)) {
+                        logError(std::string("broker send 0 ") + actionMessageType(cmd.action()) +
+                                 ':' + se.what());
+                    }
                 }
-                catch (const std::system_error& se) {
-                    if (se.code() != asio::error::connection_aborted) {
-                        if (!isDisconnectCommand(cmd)) {
-                            logError(std::string("broker send 0 ") +
-                                     actionMessageType(cmd.action()) + ':' + se.what());
-                        }
+            }
+        } else {
+            logWarning(std::string("(tcpss) no route to broker for message, message dropped :") +
+                       actionMessageType(cmd.action()));
+        }
+    } else {
+        auto rt_find = routes.find(rid);
+        if (rt_find != routes.end()) {
+            if (state.asyncSends) {
+                writerFor(state, rt_find->second).send(cmd.packetize());
+                return true;
+            }
+            try {
+                rt_find->second->send(cmd.packetize());
+            }
+            catch (const std::system_error& se) {
+                if (se.code() != asio::error::connection_aborted) {
+                    if (!isDisconnectCommand(cmd)) {
+                        logError(std::string("rt send ") + std::to_string(rid.baseValue()) +
+                                 "::" + se.what());
                     }
                 }
-            } else {
-                logWarning(
-                    std::string("(tcpss) no route to broker for message, message dropped :") +
-                    actionMessageType(cmd.action()));
             }
         } else {
-            //  txlist.push_back(cmd);
-            auto rt_find = routes.find(rid);
-            if (rt_find != routes.end()) {
+            if (hasBroker && state.asyncSends && brokerConnection) {
+                writerFor(state, brokerConnection).send(cmd.packetize());
+            } else if (hasBroker) {
                 try {
-                    rt_find->second->send(cmd.packetize());
+                    brokerConnection->send(cmd.packetize());
                 }
                 catch (const std::system_error& se) {
                     if (se.code() != asio::error::connection_aborted) {
                         if (!isDisconnectCommand(cmd)) {
-                            logError(std::string("rt send ") + std::to_string(rid.baseValue()) +
-                                     "::" + se.what());
+                            logError(std::string("broker send ") +
+                                     std::to_string(rid.baseValue()) + " ::" + se.what());
                         }
                     }
                 }
             } else {
-                if (hasBroker) {
-                    try {
-                        brokerConnection->send(cmd.packetize());
-                    }
-                    catch (const std::system_error& se) {
-                        if (se.code() != asio::error::connection_aborted) {
-                            if (!isDisconnectCommand(cmd)) {
-                                logError(std::string("broker send ") +
-                                         std::to_string(rid.baseValue()) + " ::" + se.what());
-                            }
-                        }
-                    }
-                } else {
-                    if (!isDisconnectCommand(cmd)) {
-                        logWarning(
-                            std::string("(tcpss) unknown message destination message dropped ") +
-                            prettyPrintString(cmd));
-                    }
+                if (!isDisconnectCommand(cmd)) {
+                    logWarning(
+                        std::string("(tcpss) unknown message destination message dropped ") +
+                        prettyPrintString(cmd));
                 }
             }
         }
-    }  // while (!haltLoop)
+    }
+    return true;
+}
+
+AsyncWriter& TcpCommsSS::writerFor(TxState& state, const TcpConnection::pointer& connection)
+{
+    auto& writer = state.writers[connection.get()];
+    if (!writer) {
+        writer = std::make_shared<AsyncWriter>(connection,
+                                               state.ioctx->getBaseContext(),
+                                               connectionTimeout,
+                                               [this](const std::string& error) {
+                                                   logError("(tcpss) send " + error);
+                                               });
+    }
+    return *writer;
+}
+
+void TcpCommsSS::releaseWriter(TxState& state, const TcpConnection::pointer& connection)
+{
+    if (connection == state.brokerConnection) {
+        return;
+    }
+    for (const auto& route : state.routes) {
+        if (route.second == connection) {
+            return;
+        }
+    }
+    auto writer = state.writers.find(connection.get());
+    if (writer != state.writers.end()) {
+        // anything still queued goes out, the writer keeps itself alive until then
+        writer->second->release();
+        state.writers.erase(writer);
+    }
+}
+
+TcpConnection::pointer TcpCommsSS::startConnection(TxState& state, const std::string& address)
+{
+    auto [interface, port] = gmlc::networking::extractInterfaceAndPortString(address);
+    auto connection = TcpConnection::create(state.sf,
+                                            state.ioctx->getBaseContext(),
+                                            interface,
+                                            port ? *port : std::string{});
+    if (!connection) {
+        return connection;
+    }
+    connection->setDataCall(state.dataCall);
+    connection->setErrorCall(state.errorCall);
+    // the connection completes on the network context, the writer holds the messages until then
+    auto& writer = writerFor(state, connection);
+    writer.setConnectedCall([connection]() { connection->startReceive(); });
+    writer.send(state.cstring);
+    return connection;
+}
 
-    for (auto& rt : made_connections) {
+void TcpCommsSS::closeTxState(TxState& state)
+{
+    if (!state.writers.empty()) {
+        // give the asynchronous sends a chance to finish without holding an event loop thread
+        state.closeTimer = std::make_unique<asio::steady_timer>(state.ioctx->getBaseContext());
+        state.closeDeadline = std::chrono::steady_clock::now() + connectionTimeout;
+        finishWrites(state);
+        return;
+    }
+    closeConnections(state);
+}
+
+void TcpCommsSS::finishWrites(TxState& state)
+{
+    bool idle{true};
+    for (const auto& writer : state.writers) {
+        if (!writer.second->idle()) {
+            idle = false;
+            break;
+        }
+    }
+    if (idle || std::chrono::steady_clock::now() > state.closeDeadline) {
+        // closing waits on the network context so it cannot be done from a timer callback
+        CommsEventLoop::getSharedLoop()->post([this, &state]() { closeConnections(state); });
+        return;
+    }
+    state.closeTimer->expires_after(std::chrono::milliseconds(5));
+    state.closeTimer->async_wait(
+        [this, &state](const std::error_code& /*error*/) { finishWrites(state); });
+}
+
+void TcpCommsSS::closeConnections(TxState& state)
+{
+    for (auto& writer : state.writers) {
+        writer.second->release();
+    }
+    state.writers.clear();
+    for (auto& rt : state.made_connections) {
         if (rt.second) {
             rt.second->close();
         }
     }
-    made_connections.clear();
-    for (auto& rt : routes) {
+    state.made_connections.clear();
+    for (auto& rt : state.routes) {
         if (rt.second) {
             rt.second->close();
         }
     }
-    if (brokerConnection) {
-        brokerConnection->close();
+    if (state.brokerConnection) {
+        state.brokerConnection->close();
     }
-    routes.clear();
-    brokerConnection = nullptr;
+    state.routes.clear();
+    state.brokerConnection = nullptr;
     setTxStatus(ConnectionStatus::TERMINATED);
-    if (server) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
-        server->close();
-        server = nullptr;
+    if (state.server) {
+        // the event loop has waited for its sends to finish, the dedicated thread gives the
+        // peers a moment with the last ones instead
+        if (!state.asyncSends) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        state.server->close();
+        state.server = nullptr;
     }
     if (getRxStatus() == ConnectionStatus::CONNECTED) {
         setRxStatus(ConnectionStatus::TERMINATED);
     }
 }
 
+std::string TcpCommsSS::query(std::string_view queryString) const
+{
+    if (queryString == "event_loop") {
+        if (!txTask) {
+            return {};
+        }
+        const auto stats = txTask->statistics();
+        const double meanLatency = (stats.runs > 0) ?
+            static_cast<double>(stats.totalLatency.count()) / static_cast<double>(stats.runs) :
+            0.0;
+        return fmt::format(
+            R"({{"threads":{},"runs":{},"mean_latency_us":{},"max_latency_us":{},"busy_ms":{}}})",
+            txTask->threadCount(),
+            stats.runs,
+            meanLatency / 1.0e3,
+            static_cast<double>(stats.maxLatency.count()) / 1.0e3,
+            static_cast<double>(stats.busyTime.count()) / 1.0e6);
+    }
+    return NetworkCommsInterface::query(queryString);
+}
+
 }  // namespace helics::tcp
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../NetworkCommsInterface.hpp"
 
 #include <atomic>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -18,7 +19,10 @@ class TcpConnection;
 }
 
 namespace helics {
+class CommsEventTask;
+
 namespace tcp {
+    class AsyncWriter;
 
     /** implementation for the communication interface that uses TCP messages to communicate*/
     class TcpCommsSS final: public NetworkCommsInterface {
@@ -37,6 +41,8 @@ namespace tcp {
 
         /** load network information into the comms object*/
         virtual void loadNetworkInfo(const NetworkBrokerData& netInfo) override;
+        /** query the comms object, "event_loop" returns the event loop statistics*/
+        virtual std::string query(std::string_view queryString) const override;
 
       private:
         /// disable all outgoing connections- allow only incoming connections
@@ -44,9 +50,40 @@ namespace tcp {
         bool reuse_address{false};
         std::string encryption_config;
         std::vector<std::string> connections;  //!< list of connections to make
+        /// run the transmit processing on the shared event loop instead of a dedicated thread
+        bool useEventLoop{false};
+        int eventLoopThreads{2};  //!< the number of threads the shared event loop uses
+        struct TxState;
+        std::unique_ptr<TxState> txState;  //!< the transmit state when run on the event loop
+        std::unique_ptr<CommsEventTask> txTask;  //!< the task processing the transmit queue
+        std::atomic<bool> eventLoopActive{false};  //!< set while the event loop task is active
         virtual int getDefaultBrokerPort() const override;
         virtual void queue_rx_function() override;  //!< the functional loop for the receive queue
         virtual void queue_tx_function() override;  //!< the loop for transmitting data
+        virtual void transmitQueued() override;
+
+        /** process a message from the transmit queue
+        @return false if the transmit processing should halt*/
+        bool processTxMessage(TxState& state, route_id rid, ActionMessage& cmd);
+        /** close all the connections of the transmit processing
+        @details on the event loop the connections are closed once the pending sends finish*/
+        void closeTxState(TxState& state);
+        /** check if the asynchronous sends are done and close the connections if they are*/
+        void finishWrites(TxState& state);
+        /** close the connections and the server*/
+        void closeConnections(TxState& state);
+        /** get the asynchronous writer of a connection, creating it if needed*/
+        AsyncWriter& writerFor(TxState& state,
+                               const std::shared_ptr<gmlc::networking::TcpConnection>& connection);
+        /** drop the writer of a connection once no route uses the connection*/
+        void releaseWriter(TxState& state,
+                           const std::shared_ptr<gmlc::networking::TcpConnection>& connection);
+        /** start a connection without waiting for it to complete
+        @details messages sent to it are held by its writer until it is connected*/
+        std::shared_ptr<gmlc::networking::TcpConnection>
+            startConnection(TxState& state, const std::string& address);
+        /** process everything in the transmit queue, run from the event loop*/
+        void drainTransmitQueue();
 
         /** process an incoming message
     return code for required action 0=NONE, -1 TERMINATE*/
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "TcpRouteSender.h"
+
+#include "../../core/ActionMessage.hpp"
+#include "gmlc/networking/TcpConnection.h"
+
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace helics::tcp {
+
+TcpRouteSender::TcpRouteSender(std::shared_ptr<gmlc::networking::TcpConnection> connectionPtr,
+                               std::size_t highWater,
+                               std::string name,
+                               std::function<void(std::string_view)> errorCallback,
+                               std::function<void(std::string&)> encoderCallback):
+    connection(std::move(connectionPtr)), routeName(std::move(name)),
+    errorCall(std::move(errorCallback)), encoder(std::move(encoderCallback)),
+    highWaterMark(highWater),
+    sender([this]() { sendLoop(); })
+{
+}
+
+TcpRouteSender::~TcpRouteSender()
+{
+    {
+        const std::lock_guard<std::mutex> lock(queueLock);
+        closing = true;
+    }
+    dataAvailable.notify_one();
+    spaceAvailable.notify_all();
+    sender.join();
+}
+
+void TcpRouteSender::send(const ActionMessage& cmd)
+{
+    std::unique_lock<std::mutex> lock(queueLock);
+    // apply backpressure to the caller rather than letting a slow connection grow without bound
+    spaceAvailable.wait(lock, [this]() { return pending.size() < highWaterMark || closing; });
+    const bool wasEmpty = pending.empty();
+    cmd.appendPacket(pending);
+    if (messageCount++ == 0) {
+        firstAction = cmd.action();
+    }
+    logErrors = logErrors || !isDisconnectCommand(cmd);
+    lock.unlock();
+    if (wasEmpty) {
+        dataAvailable.notify_one();
+    }
+}
+
+void TcpRouteSender::sendLoop()
+{
+    std::string buffer;
+    while (true) {
+        bool reportErrors{false};
+        std::size_t count{0};
+        auto action{action_message_def::action_t::cmd_ignore};
+        {
+            std::unique_lock<std::mutex> lock(queueLock);
+            dataAvailable.wait(lock, [this]() { return !pending.empty() || closing; });
+            if (pending.empty()) {
+                break;
+            }
+            // the buffers are swapped so both keep their capacity
+            buffer.swap(pending);
+            reportErrors = logErrors;
+            logErrors = false;
+            count = std::exchange(messageCount, 0);
+            action = firstAction;
+        }
+        spaceAvailable.notify_all();
+        if (encoder) {
+            encoder(buffer);
+        }
+        try {
+            connection->send(buffer);
+        }
+        catch (const std::system_error& sendError) {
+            if (sendError.code() != asio::error::connection_aborted && reportErrors) {
+                errorCall(std::string("tcp send failure on ") + routeName + " (" +
+                          std::to_string(count) + " messages starting with " +
+                          actionMessageType(action) + ")::" + sendError.what());
+            }
+        }
+        buffer.clear();
+    }
+}
+
+}  // namespace helics::tcp
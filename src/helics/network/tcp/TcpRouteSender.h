@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../../core/ActionMessageDefintions.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace gmlc::networking {
+class TcpConnection;
+}  // namespace gmlc::networking
+
+namespace helics {
+class ActionMessage;
+
+namespace tcp {
+    /** class sending the messages for a single route on a dedicated thread
+    @details messages are packetized into a pending buffer which the send thread swaps out and
+    writes as a single transmission, so everything queued while a write is in progress goes out in
+    the next write.  Once the pending buffer reaches the high water mark queuing a message blocks
+    until the send thread catches up*/
+    class TcpRouteSender {
+      public:
+        /** create the sender and start its thread
+        @param connection the connection to send the data on
+        @param highWaterMark the number of pending bytes at which queuing a message blocks
+        @param routeName the name of the route used in error messages
+        @param errorCall callback for reporting send errors
+        @param encoder optional callback to transform each block of data before it is written,
+        it runs on the send thread*/
+        TcpRouteSender(std::shared_ptr<gmlc::networking::TcpConnection> connection,
+                       std::size_t highWaterMark,
+                       std::string routeName,
+                       std::function<void(std::string_view)> errorCall,
+                       std::function<void(std::string&)> encoder = {});
+        /** send anything pending and stop the thread*/
+        ~TcpRouteSender();
+        TcpRouteSender(const TcpRouteSender&) = delete;
+        TcpRouteSender& operator=(const TcpRouteSender&) = delete;
+
+        /** queue a message for transmission*/
+        void send(const ActionMessage& cmd);
+
+      private:
+        void sendLoop();
+
+        std::shared_ptr<gmlc::networking::TcpConnection> connection;
+        std::string routeName;
+        std::function<void(std::string_view)> errorCall;
+        std::function<void(std::string&)> encoder;
+        const std::size_t highWaterMark;
+        std::mutex queueLock;  //!< lock protecting the pending data and flags
+        std::condition_variable dataAvailable;  //!< signal to the send thread
+        std::condition_variable spaceAvailable;  //!< signal to threads waiting to queue
+        std::string pending;  //!< packetized messages waiting to be sent
+        /// the action of the first pending message for error messages
+        action_message_def::action_t firstAction{action_message_def::action_t::cmd_ignore};
+        std::size_t messageCount{0};  //!< the number of pending messages
+        bool logErrors{false};  //!< set if any pending message is not a disconnect command
+        bool closing{false};  //!< set when the sender is shutting down
+        std::thread sender;  //!< the send thread, declared last so it starts after the rest
+    };
+}  // namespace tcp
+}  // namespace helics
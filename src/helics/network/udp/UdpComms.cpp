@@ -7,20 +7,46 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "UdpComms.h"
 
 #include "../../core/ActionMessage.hpp"
+#include "../../core/MessageTimer.hpp"
+#include "../../core/helics_definitions.hpp"
 #include "../NetworkBrokerData.hpp"
 #include "../networkDefaults.hpp"
+#include "UdpReliability.h"
 #include "gmlc/networking/AsioContextManager.h"
 
+#include <algorithm>
+#include <asio/io_context.hpp>
 #include <asio/ip/udp.hpp>
+#include <chrono>
 #include <fmt/format.h>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 namespace helics::udp {
 using asio::ip::udp;
+
+namespace {
+    /** the reliable transmission state for a single destination*/
+    struct ReliableRoute {
+        ReliableRoute(std::uint32_t session,
+                      std::size_t datagramSize,
+                      ReliableSender::SendFunction sendFunction):
+            sender(session, datagramSize), send(std::move(sendFunction))
+        {
+        }
+        ReliableSender sender;
+        ReliableSender::SendFunction send;
+    };
+    /// the number of messages batched before the partially filled datagrams are sent anyway
+    constexpr int maxBatchedMessages{64};
+    /// how long to wait for outstanding datagrams to be acknowledged when closing
+    constexpr std::chrono::milliseconds reliableLingerTime{1000};
+}  // namespace
 UdpComms::UdpComms(): NetworkCommsInterface(gmlc::networking::InterfaceTypes::UDP)
 {
     futurePort = promisePort.get_future();
@@ -41,9 +67,22 @@ void UdpComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
 
     promisePort = std::promise<int>();
     futurePort = promisePort.get_future();
-
+    reliable = netInfo.reliableUdp;
+    maxDatagramSize = netInfo.maxDatagramSize;
     propertyUnLock();
 }
+
+void UdpComms::setFlag(std::string_view flag, bool val)
+{
+    if (flag == "reliable_udp") {
+        if (propertyLock()) {
+            reliable = val;
+            propertyUnLock();
+        }
+    } else {
+        NetworkCommsInterface::setFlag(flag, val);
+    }
+}
 /** destructor*/
 UdpComms::~UdpComms()
 {
@@ -125,10 +164,34 @@ void UdpComms::queue_rx_function()
         }
     }
 
-    std::vector<char> data(10192);
+    // large enough for any datagram
+    std::vector<char> data(65536);
     udp::endpoint remote_endp;
     std::error_code error;
     std::error_code ignored_error;
+    std::map<udp::endpoint, ReliableReceiver> receivers;
+    // returns false if the receiver should close
+    auto processCommand = [&](ActionMessage&& cmd) {
+        if (!isValidCommand(cmd)) {
+            logWarning("invalid command received udp");
+            return true;
+        }
+        if (isProtocolCommand(cmd)) {
+            if (cmd.messageID == CLOSE_RECEIVER) {
+                return false;
+            }
+            auto reply = generateReplyToIncomingMessage(cmd);
+            if (reply.messageID == DISCONNECT) {
+                return false;
+            }
+            if (reply.action() != CMD_IGNORE) {
+                socket.send_to(asio::buffer(reply.to_string()), remote_endp, 0, ignored_error);
+            }
+        } else {
+            ActionCallback(std::move(cmd));
+        }
+        return true;
+    };
     setRxStatus(ConnectionStatus::CONNECTED);
     while (true) {
         auto len = socket.receive_from(asio::buffer(data), remote_endp, 0, error);
@@ -142,24 +205,25 @@ void UdpComms::queue_rx_function()
                 break;
             }
         }
-        ActionMessage cmd(reinterpret_cast<std::byte*>(data.data()), len);
-        if (!isValidCommand(cmd)) {
-            logWarning("invalid command received udp");
-            continue;
-        }
-        if (isProtocolCommand(cmd)) {
-            if (cmd.messageID == CLOSE_RECEIVER) {
-                break;
+        const auto* rxData = reinterpret_cast<const std::byte*>(data.data());
+        if (isReliableData(rxData, len)) {
+            bool closing{false};
+            auto ack = receivers[remote_endp].processDatagram(
+                rxData, len, [&processCommand, &closing](ActionMessage&& cmd) {
+                    if (!closing && !processCommand(std::move(cmd))) {
+                        closing = true;
+                    }
+                });
+            if (!ack.empty()) {
+                socket.send_to(asio::buffer(ack), remote_endp, 0, ignored_error);
             }
-            auto reply = generateReplyToIncomingMessage(cmd);
-            if (reply.messageID == DISCONNECT) {
+            if (closing) {
                 break;
             }
-            if (reply.action() != CMD_IGNORE) {
-                socket.send_to(asio::buffer(reply.to_string()), remote_endp, 0, ignored_error);
-            }
-        } else {
-            ActionCallback(std::move(cmd));
+            continue;
+        }
+        if (!processCommand(ActionMessage(rxData, len))) {
+            break;
         }
     }
     disconnecting = true;
@@ -172,7 +236,10 @@ void UdpComms::queue_tx_function()
     auto ioctx = gmlc::networking::AsioContextManager::getContextPointer();
     udp::resolver resolver(ioctx->getBaseContext());
     bool closingRx = false;
-    udp::socket transmitSocket(ioctx->getBaseContext());
+    // the transmit socket has its own context so the thread can block on it waiting for the
+    // acknowledgments of reliable datagrams
+    asio::io_context txContext;
+    udp::socket transmitSocket(txContext);
     transmitSocket.open(udpnet(interfaceNetwork));
     if (PortNumber >= 0) {
         promisePort.set_value(PortNumber);
@@ -215,7 +282,7 @@ void UdpComms::queue_tx_function()
                 }
                 ActionMessage cmd(CMD_PROTOCOL_PRIORITY);
                 cmd.messageID = (PortNumber <= 0) ? REQUEST_PORTS : CONNECTION_REQUEST;
-                cmd.setStringData(brokerName, brokerInitString);
+                cmd.setStringData(brokerName, brokerInitString, name);
                 transmitSocket.send_to(asio::buffer(cmd.to_string()), broker_endpoint, 0, error);
                 if (error) {
                     logError(fmt::format("error in initial send to broker {}", error.message()));
@@ -290,7 +357,8 @@ void UdpComms::queue_tx_function()
                         }
                     } else if (cmd.messageID == NEW_BROKER_INFORMATION) {
                         logMessage("got new broker information");
-                        auto brkprt = gmlc::networking::extractInterfaceAndPort(cmd.getString(0));
+                        auto brkprt = gmlc::networking::extractInterfaceAndPort(
+                            std::string(cmd.getString(0)));
                         if (brkprt.second) {
                             brokerPort = *brkprt.second;
                         }
@@ -350,12 +418,149 @@ void UdpComms::queue_tx_function()
     }
 
     setTxStatus(ConnectionStatus::CONNECTED);
+
+    // the acknowledgments of reliable datagrams come back to the transmit socket, they are
+    // processed whenever the queue is drained or the retransmit timer fires
+    std::map<udp::endpoint, ReliableRoute> reliableRoutes;
+    std::shared_ptr<MessageTimer> retransmitTimer;
+    std::int32_t retransmitTimerIndex{-1};
+    auto retransmitTimerExpiration = ReliableSender::time_type::max();
+    std::uint32_t reliableSession{0};
+    int batchedMessages{0};
+    std::vector<char> ackData(512);
+    if (reliable) {
+        reliableSession = std::random_device{}();
+        retransmitTimer = std::make_shared<MessageTimer>(
+            [this](ActionMessage&& timeout) { transmit(control_route, std::move(timeout)); });
+    }
+
+    auto reliableRoute = [&](const udp::endpoint& endpoint) -> ReliableRoute& {
+        auto route = reliableRoutes.find(endpoint);
+        if (route == reliableRoutes.end()) {
+            // send errors are not reported since the datagram is retransmitted anyway
+            auto send = [&transmitSocket, endpoint](std::string_view datagram) {
+                std::error_code sendError;
+                transmitSocket.send_to(asio::buffer(datagram.data(), datagram.size()),
+                                       endpoint,
+                                       0,
+                                       sendError);
+            };
+            route = reliableRoutes
+                        .emplace(std::piecewise_construct,
+                                 std::forward_as_tuple(endpoint),
+                                 std::forward_as_tuple(reliableSession, maxDatagramSize, send))
+                        .first;
+        }
+        return route->second;
+    };
+
+    // process the acknowledgments, send the batched datagrams, and retransmit anything overdue
+    auto serviceReliableRoutes = [&]() {
+        const auto now = std::chrono::steady_clock::now();
+        while (transmitSocket.available(error) > 0 && !error) {
+            udp::endpoint source;
+            auto len = transmitSocket.receive_from(asio::buffer(ackData), source, 0, error);
+            if (error) {
+                break;
+            }
+            auto route = reliableRoutes.find(source);
+            if (route != reliableRoutes.end()) {
+                route->second.sender.processAck(reinterpret_cast<const std::byte*>(ackData.data()),
+                                                len,
+                                                now,
+                                                route->second.send);
+            }
+        }
+        auto nextRetransmit = ReliableSender::time_type::max();
+        for (auto& [endpoint, route] : reliableRoutes) {
+            route.sender.flush(now, route.send);
+            if (!route.sender.retransmit(now, route.send)) {
+                // later messages cannot be delivered either so the link has failed
+                ActionMessage err(CMD_ERROR);
+                err.messageID = defs::Errors::CONNECTION_FAILURE;
+                err.payload = fmt::format("(udp) datagram to {}:{} was not acknowledged after the "
+                                          "maximum number of retransmissions",
+                                          endpoint.address().to_string(),
+                                          endpoint.port());
+                logError(err.payload.to_string());
+                ActionCallback(std::move(err));
+            }
+            nextRetransmit = std::min(nextRetransmit, route.sender.nextRetransmitTime());
+        }
+        batchedMessages = 0;
+        if (nextRetransmit < retransmitTimerExpiration) {
+            ActionMessage timeout(CMD_PROTOCOL_PRIORITY);
+            timeout.messageID = RETRANSMIT_TIMER;
+            if (retransmitTimerIndex < 0) {
+                retransmitTimerIndex = retransmitTimer->addTimer(nextRetransmit, timeout);
+            } else {
+                retransmitTimer->updateTimer(retransmitTimerIndex, nextRetransmit, timeout);
+            }
+            retransmitTimerExpiration = nextRetransmit;
+        }
+    };
+
+    // block until an acknowledgment arrives or the next retransmission is due
+    auto waitForAcknowledgment = [&](ReliableSender::time_type deadline) {
+        transmitSocket.async_wait(udp::socket::wait_read, [](const std::error_code& /*error*/) {});
+        txContext.restart();
+        const auto timeout = std::clamp<std::chrono::nanoseconds>(
+            deadline - std::chrono::steady_clock::now(),
+            std::chrono::milliseconds(1),
+            std::chrono::milliseconds(200));
+        if (txContext.run_one_for(timeout) == 0) {
+            // complete the cancelled wait so the next one starts clean
+            transmitSocket.cancel();
+            txContext.restart();
+            txContext.run();
+        }
+    };
+    auto nextDeadline = [&reliableRoutes](ReliableSender::time_type limit) {
+        for (const auto& route : reliableRoutes) {
+            limit = std::min(limit, route.second.sender.nextRetransmitTime());
+        }
+        return limit;
+    };
+
+    // returns false if the message could not be sent
+    auto sendCommand = [&](const udp::endpoint& endpoint, const ActionMessage& command) {
+        if (!reliable) {
+            transmitSocket.send_to(asio::buffer(command.to_string()), endpoint, 0, error);
+            return !error;
+        }
+        auto& route = reliableRoute(endpoint);
+        route.sender.addMessage(command);
+        ++batchedMessages;
+        if (route.sender.hasCompleted()) {
+            route.sender.sendCompleted(std::chrono::steady_clock::now(), route.send);
+        }
+        while (route.sender.windowFull()) {
+            // wait for the receiver to catch up
+            waitForAcknowledgment(nextDeadline(ReliableSender::time_type::max()));
+            serviceReliableRoutes();
+        }
+        return true;
+    };
+
     bool continueProcessing{true};
     while (continueProcessing) {
         route_id rid;
         ActionMessage cmd;
 
-        std::tie(rid, cmd) = txQueue.pop();
+        bool popped{false};
+        if (batchedMessages > 0 && batchedMessages < maxBatchedMessages) {
+            // keep filling datagrams while more messages are waiting
+            if (auto next = txQueue.try_pop()) {
+                std::tie(rid, cmd) = std::move(*next);
+                popped = true;
+            }
+        }
+        if (!popped) {
+            if (batchedMessages > 0) {
+                serviceReliableRoutes();
+            }
+            std::tie(rid, cmd) = txQueue.pop();
+        }
         bool processed = false;
         if (isProtocolCommand(cmd)) {
             if (rid == control_route) {
@@ -396,6 +601,13 @@ void UdpComms::queue_tx_function()
                         continueProcessing = false;
                         processed = true;
                         break;
+                    case RETRANSMIT_TIMER:
+                        retransmitTimerExpiration = ReliableSender::time_type::max();
+                        if (reliable) {
+                            serviceReliableRoutes();
+                        }
+                        processed = true;
+                        break;
                     default:
                         break;
                 }
@@ -407,8 +619,7 @@ void UdpComms::queue_tx_function()
 
         if (rid == parent_route_id) {
             if (hasBroker) {
-                transmitSocket.send_to(asio::buffer(cmd.to_string()), broker_endpoint, 0, error);
-                if (error) {
+                if (!sendCommand(broker_endpoint, cmd)) {
                     logWarning(
                         fmt::format("transmit failure sending to broker  {}", error.message()));
                 }
@@ -426,19 +637,14 @@ void UdpComms::queue_tx_function()
         } else {
             auto rt_find = routes.find(rid);
             if (rt_find != routes.end()) {
-                transmitSocket.send_to(asio::buffer(cmd.to_string()), rt_find->second, 0, error);
-                if (error) {
+                if (!sendCommand(rt_find->second, cmd)) {
                     logWarning(fmt::format("transmit failure sending to route {}:{}",
                                            rid.baseValue(),
                                            error.message()));
                 }
             } else {
                 if (hasBroker) {
-                    transmitSocket.send_to(asio::buffer(cmd.to_string()),
-                                           broker_endpoint,
-                                           0,
-                                           error);
-                    if (error) {
+                    if (!sendCommand(broker_endpoint, cmd)) {
                         logWarning(
                             fmt::format("transmit failure sending to broker  {}", error.message()));
                     }
@@ -451,6 +657,22 @@ void UdpComms::queue_tx_function()
             }
         }
     }
+    if (reliable) {
+        // give the last messages a chance to be acknowledged
+        const auto lingerEnd = std::chrono::steady_clock::now() + reliableLingerTime;
+        serviceReliableRoutes();
+        auto waiting = [&reliableRoutes]() {
+            return std::any_of(reliableRoutes.begin(), reliableRoutes.end(), [](const auto& route) {
+                return route.second.sender.outstanding() > 0;
+            });
+        };
+        while (waiting() && std::chrono::steady_clock::now() < lingerEnd) {
+            waitForAcknowledgment(nextDeadline(lingerEnd));
+            serviceReliableRoutes();
+        }
+        retransmitTimer->cancelAll();
+        reliableRoutes.clear();
+    }
     routes.clear();
     if (getRxStatus() == ConnectionStatus::CONNECTED) {
         if (closingRx) {
@@ -22,6 +22,7 @@ class UdpComms final: public NetworkCommsInterface {
     ~UdpComms();
 
     virtual void loadNetworkInfo(const NetworkBrokerData& netInfo) override;
+    virtual void setFlag(std::string_view flag, bool val) override;
 
   private:
     virtual int getDefaultBrokerPort() const override;
@@ -32,6 +33,9 @@ class UdpComms final: public NetworkCommsInterface {
     // promise and future for communicating port number from tx_thread to rx_thread
     std::promise<int> promisePort;
     std::future<int> futurePort;
+    /// sequence, acknowledge, and retransmit the datagrams and pack several messages into each
+    bool reliable{false};
+    std::size_t maxDatagramSize{1400};  //!< the size of datagram messages are packed into
 
   public:
 };
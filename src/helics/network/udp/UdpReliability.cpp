@@ -0,0 +1,293 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "UdpReliability.h"
+
+#include "../../core/ActionMessage.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace helics::udp {
+
+namespace {
+    constexpr std::chrono::nanoseconds minRetransmitTimeout{std::chrono::milliseconds(10)};
+    constexpr std::chrono::nanoseconds maxRetransmitTimeout{std::chrono::seconds(2)};
+
+    /** check if sequence number a comes before b allowing for wrap around*/
+    bool sequenceBefore(std::uint32_t seqA, std::uint32_t seqB)
+    {
+        return static_cast<std::int32_t>(seqA - seqB) < 0;
+    }
+
+    void writeValue(char* location, std::uint64_t value, int bytes)
+    {
+        for (int ii = 0; ii < bytes; ++ii) {
+            location[ii] = static_cast<char>((value >> (8 * ii)) & 0xFFU);
+        }
+    }
+
+    std::uint64_t readValue(const std::byte* location, int bytes)
+    {
+        std::uint64_t value{0};
+        for (int ii = 0; ii < bytes; ++ii) {
+            value |= static_cast<std::uint64_t>(location[ii]) << (8 * ii);
+        }
+        return value;
+    }
+
+    /** write the marker and session of a reliable datagram into its first 8 bytes*/
+    void writeHeader(char* location, std::byte marker, std::uint32_t session)
+    {
+        location[0] = static_cast<char>(marker);
+        location[1] = '\0';
+        location[2] = '\0';
+        location[3] = '\0';
+        writeValue(location + 4, session, 4);
+    }
+}  // namespace
+
+ReliableSender::ReliableSender(std::uint32_t sessionId, std::size_t maxDatagramSize):
+    session(sessionId), maxSize(maxDatagramSize)
+{
+}
+
+void ReliableSender::addMessage(const ActionMessage& cmd)
+{
+    if (failed) {
+        return;
+    }
+    if (building.empty()) {
+        building.resize(reliableDataHeaderSize);
+    }
+    const auto start = building.size();
+    cmd.appendPacket(building);
+    if (building.size() > maxSize && start > reliableDataHeaderSize) {
+        // the message did not fit so it starts the next datagram
+        std::string packet = building.substr(start);
+        building.resize(start);
+        seal();
+        building.resize(reliableDataHeaderSize);
+        building.append(packet);
+    }
+}
+
+void ReliableSender::seal()
+{
+    if (building.size() <= reliableDataHeaderSize) {
+        return;
+    }
+    writeHeader(building.data(), reliableDataMarker, session);
+    writeValue(building.data() + 8, nextSequence, 4);
+    Datagram datagram;
+    datagram.sequence = nextSequence++;
+    datagram.data = std::move(building);
+    datagrams.push_back(std::move(datagram));
+    building.clear();
+    ++unsent;
+}
+
+void ReliableSender::sendDatagram(Datagram& datagram, time_type now, const SendFunction& send)
+{
+    send(datagram.data);
+    datagram.sendTime = now;
+    ++datagram.transmissions;
+}
+
+void ReliableSender::flush(time_type now, const SendFunction& send)
+{
+    seal();
+    sendCompleted(now, send);
+}
+
+void ReliableSender::sendCompleted(time_type now, const SendFunction& send)
+{
+    for (auto it = datagrams.end() - static_cast<std::ptrdiff_t>(unsent); it != datagrams.end();
+         ++it) {
+        sendDatagram(*it, now, send);
+    }
+    unsent = 0;
+}
+
+bool ReliableSender::processAck(const std::byte* data,
+                                std::size_t size,
+                                time_type now,
+                                const SendFunction& send)
+{
+    if (!isReliableAck(data, size) || readValue(data + 4, 4) != session) {
+        return false;
+    }
+    if (failed) {
+        return true;
+    }
+    const auto cumulative = static_cast<std::uint32_t>(readValue(data + 8, 4));
+    const auto received = readValue(data + 12, 8);
+
+    for (auto& datagram : datagrams) {
+        if (datagram.transmissions == 0 || datagram.acknowledged) {
+            continue;
+        }
+        bool acked = sequenceBefore(datagram.sequence, cumulative);
+        if (!acked) {
+            const std::uint32_t offset = datagram.sequence - cumulative - 1U;
+            acked = (offset < selectiveAckRange && ((received >> offset) & 1U) != 0U);
+        }
+        if (acked) {
+            datagram.acknowledged = true;
+            if (datagram.transmissions == 1) {
+                // only datagrams sent once give an unambiguous round trip time
+                updateRoundTrip(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - datagram.sendTime));
+            }
+        }
+    }
+    if (received != 0U) {
+        // anything sent before a datagram the receiver has was lost, don't wait for the timeout
+        std::uint32_t highestOffset{selectiveAckRange - 1U};
+        while (((received >> highestOffset) & 1U) == 0U) {
+            --highestOffset;
+        }
+        const std::uint32_t highestReceived = cumulative + 1U + highestOffset;
+        const auto resendInterval = std::max(srtt, minRetransmitTimeout);
+        for (auto& datagram : datagrams) {
+            if (!sequenceBefore(datagram.sequence, highestReceived)) {
+                break;
+            }
+            if (!datagram.acknowledged && datagram.transmissions > 0 &&
+                now - datagram.sendTime >= resendInterval) {
+                sendDatagram(datagram, now, send);
+            }
+        }
+    }
+    while (!datagrams.empty() && datagrams.front().acknowledged) {
+        datagrams.pop_front();
+    }
+    return true;
+}
+
+bool ReliableSender::retransmit(time_type now, const SendFunction& send)
+{
+    for (auto& datagram : datagrams) {
+        if (datagram.transmissions == 0 || datagram.acknowledged) {
+            continue;
+        }
+        if (now - datagram.sendTime >= backoff(datagram)) {
+            if (datagram.transmissions >= maxTransmissions) {
+                // the receiver would wait for this datagram forever so nothing after it can be
+                // delivered
+                failed = true;
+                datagrams.clear();
+                building.clear();
+                unsent = 0;
+                return false;
+            }
+            sendDatagram(datagram, now, send);
+        }
+    }
+    while (!datagrams.empty() && datagrams.front().acknowledged) {
+        datagrams.pop_front();
+    }
+    return true;
+}
+
+ReliableSender::time_type ReliableSender::nextRetransmitTime() const
+{
+    auto next = time_type::max();
+    for (const auto& datagram : datagrams) {
+        if (datagram.transmissions > 0 && !datagram.acknowledged) {
+            next = std::min(next, datagram.sendTime + backoff(datagram));
+        }
+    }
+    return next;
+}
+
+std::chrono::nanoseconds ReliableSender::backoff(const Datagram& datagram) const
+{
+    auto timeout = rto;
+    for (int ii = 1; ii < datagram.transmissions && timeout < maxRetransmitTimeout; ++ii) {
+        timeout *= 2;
+    }
+    return std::min(timeout, maxRetransmitTimeout);
+}
+
+void ReliableSender::updateRoundTrip(std::chrono::nanoseconds sample)
+{
+    // smoothing as in RFC 6298
+    if (srtt.count() == 0) {
+        srtt = sample;
+        rttvar = sample / 2;
+    } else {
+        const auto deviation = (srtt > sample) ? srtt - sample : sample - srtt;
+        rttvar = (3 * rttvar + deviation) / 4;
+        srtt = (7 * srtt + sample) / 8;
+    }
+    rto = std::clamp(srtt + 4 * rttvar, minRetransmitTimeout, maxRetransmitTimeout);
+}
+
+std::string ReliableReceiver::processDatagram(const std::byte* data,
+                                              std::size_t size,
+                                              const DeliverFunction& deliver)
+{
+    if (!isReliableData(data, size)) {
+        return {};
+    }
+    const auto datagramSession = static_cast<std::uint32_t>(readValue(data + 4, 4));
+    const auto sequence = static_cast<std::uint32_t>(readValue(data + 8, 4));
+    if (!active || datagramSession != session) {
+        // a new sender or the sender restarted
+        session = datagramSession;
+        nextExpected = 0;
+        held.clear();
+        active = true;
+    }
+
+    auto deliverMessages = [&deliver](const void* messages, std::size_t messageSize) {
+        std::vector<ActionMessage> batch;
+        depacketizeBatch(messages, messageSize, batch);
+        for (auto& message : batch) {
+            deliver(std::move(message));
+        }
+    };
+
+    const std::uint32_t offset = sequence - nextExpected;
+    if (offset == 0) {
+        deliverMessages(data + reliableDataHeaderSize, size - reliableDataHeaderSize);
+        ++nextExpected;
+        auto next = held.find(nextExpected);
+        while (next != held.end()) {
+            deliverMessages(next->second.data(), next->second.size());
+            held.erase(next);
+            ++nextExpected;
+            next = held.find(nextExpected);
+        }
+    } else if (offset < reliableWindowSize) {
+        held.try_emplace(sequence,
+                         reinterpret_cast<const char*>(data + reliableDataHeaderSize),
+                         size - reliableDataHeaderSize);
+    }
+    // anything else is a duplicate of a datagram already delivered which still gets acknowledged
+    return generateAck();
+}
+
+std::string ReliableReceiver::generateAck() const
+{
+    std::uint64_t received{0};
+    if (!held.empty()) {
+        for (std::uint32_t ii = 0; ii < selectiveAckRange; ++ii) {
+            if (held.find(nextExpected + 1U + ii) != held.end()) {
+                received |= std::uint64_t{1} << ii;
+            }
+        }
+    }
+    std::string ack(reliableAckSize, '\0');
+    writeHeader(ack.data(), reliableAckMarker, session);
+    writeValue(ack.data() + 8, nextExpected, 4);
+    writeValue(ack.data() + 12, received, 8);
+    return ack;
+}
+
+}  // namespace helics::udp
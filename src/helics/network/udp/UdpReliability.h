@@ -0,0 +1,146 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace helics {
+class ActionMessage;
+
+namespace udp {
+    /// the first byte of a datagram carrying sequenced messages
+    constexpr std::byte reliableDataMarker{0xE7};
+    /// the first byte of a datagram acknowledging sequenced messages
+    constexpr std::byte reliableAckMarker{0xE8};
+    /// the size of the header in front of the messages of a data datagram
+    constexpr std::size_t reliableDataHeaderSize{12};
+    /// the size of an acknowledgment datagram
+    constexpr std::size_t reliableAckSize{20};
+    /// the number of datagrams beyond the next expected one that a receiver reports individually
+    constexpr std::uint32_t selectiveAckRange{64};
+    /// the maximum number of unacknowledged datagrams a sender keeps
+    constexpr std::size_t reliableWindowSize{1024};
+
+    /** check if a datagram is a data datagram of the reliable udp protocol*/
+    inline bool isReliableData(const std::byte* data, std::size_t size)
+    {
+        return size >= reliableDataHeaderSize && data[0] == reliableDataMarker;
+    }
+    /** check if a datagram is an acknowledgment of the reliable udp protocol*/
+    inline bool isReliableAck(const std::byte* data, std::size_t size)
+    {
+        return size == reliableAckSize && data[0] == reliableAckMarker;
+    }
+
+    /** class managing the reliable transmission of messages to a single destination
+    @details messages are packed into datagrams of up to a maximum size, each datagram gets a
+    sequence number and is kept until the receiver acknowledges it.  Acknowledgments carry the next
+    sequence number the receiver expects and a bitmap of the datagrams received after it, datagrams
+    missing from the bitmap are retransmitted right away, any others not acknowledged within the
+    retransmission timeout are retransmitted when /ref retransmit is called.  The receiver delivers
+    messages in order so it cannot skip a datagram, if one is never acknowledged the sender fails
+    and drops everything after it.  The class does no socket operations of its own so it must be
+    used from a single thread*/
+    class ReliableSender {
+      public:
+        using time_type = std::chrono::steady_clock::time_point;
+        using SendFunction = std::function<void(std::string_view)>;
+        /** constructor
+        @param session identifier for the sender so a receiver can detect a restart
+        @param maxDatagramSize the size of datagram that messages are packed into*/
+        ReliableSender(std::uint32_t session, std::size_t maxDatagramSize);
+        /** add a message to the datagram being built
+        @details if the message does not fit the current datagram is completed first, a message
+        larger than the maximum datagram size is sent in a datagram of its own, messages added
+        after the sender failed are dropped*/
+        void addMessage(const ActionMessage& cmd);
+        /** send all datagrams that have not been sent yet including the one being built*/
+        void flush(time_type now, const SendFunction& send);
+        /** send the datagrams that are complete but have not been sent yet*/
+        void sendCompleted(time_type now, const SendFunction& send);
+        /** check if there are complete datagrams that have not been sent*/
+        bool hasCompleted() const { return unsent > 0; }
+        /** process an acknowledgment datagram
+        @return false if the acknowledgment does not belong to this sender*/
+        bool processAck(const std::byte* data,
+                        std::size_t size,
+                        time_type now,
+                        const SendFunction& send);
+        /** retransmit the datagrams whose acknowledgment is overdue
+        @return false if a datagram reached the maximum number of transmissions without being
+        acknowledged, the sender has then failed and all its datagrams are dropped*/
+        bool retransmit(time_type now, const SendFunction& send);
+        /** check if the sender failed to get a datagram acknowledged*/
+        bool hasFailed() const { return failed; }
+        /** get the time the next retransmission is due, time_type::max() if nothing is waiting*/
+        time_type nextRetransmitTime() const;
+        /** get the number of datagrams waiting for acknowledgment*/
+        std::size_t outstanding() const { return datagrams.size(); }
+        /** check if the sender should wait for acknowledgments before sending more*/
+        bool windowFull() const { return !failed && datagrams.size() >= reliableWindowSize; }
+        /** get the current retransmission timeout*/
+        std::chrono::nanoseconds retransmitTimeout() const { return rto; }
+        /** set the maximum number of times a datagram is sent before the sender fails*/
+        void setMaxTransmissions(int transmissions) { maxTransmissions = transmissions; }
+
+      private:
+        struct Datagram {
+            std::uint32_t sequence{0};
+            std::string data;
+            time_type sendTime;
+            int transmissions{0};
+            bool acknowledged{false};
+        };
+        /** complete the datagram being built*/
+        void seal();
+        void sendDatagram(Datagram& datagram, time_type now, const SendFunction& send);
+        void updateRoundTrip(std::chrono::nanoseconds sample);
+        std::chrono::nanoseconds backoff(const Datagram& datagram) const;
+
+        std::deque<Datagram> datagrams;  //!< datagrams in sequence order waiting for ack
+        std::string building;  //!< the datagram being built
+        std::size_t unsent{0};  //!< the number of datagrams at the back not yet sent
+        const std::uint32_t session;
+        std::uint32_t nextSequence{0};
+        const std::size_t maxSize;
+        int maxTransmissions{12};
+        bool failed{false};  //!< a datagram was never acknowledged
+        std::chrono::nanoseconds srtt{0};  //!< smoothed round trip time
+        std::chrono::nanoseconds rttvar{0};  //!< round trip time variation
+        std::chrono::nanoseconds rto{std::chrono::milliseconds(200)};  //!< retransmit timeout
+    };
+
+    /** class reassembling the sequenced datagrams from a single sender
+    @details datagrams received out of order are held until the missing ones arrive so the
+    messages are delivered in the order they were sent and exactly once*/
+    class ReliableReceiver {
+      public:
+        using DeliverFunction = std::function<void(ActionMessage&&)>;
+        /** process a data datagram
+        @param deliver called for every message that can now be delivered in order
+        @return the acknowledgment to send back to the sender, empty if the datagram was
+        invalid*/
+        std::string processDatagram(const std::byte* data,
+                                    std::size_t size,
+                                    const DeliverFunction& deliver);
+
+      private:
+        std::string generateAck() const;
+        std::map<std::uint32_t, std::string> held;  //!< datagrams received ahead of sequence
+        std::uint32_t session{0};
+        std::uint32_t nextExpected{0};
+        bool active{false};
+    };
+}  // namespace udp
+}  // namespace helics
@@ -22,6 +22,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -76,11 +77,29 @@ int ZmqComms::processIncomingMessage(zmq::message_t& msg)
             return (-1);
         }
     }
-    ActionMessage message(static_cast<std::byte*>(msg.data()), msg.size());
+    ActionMessage message;
+    loadActionMessage(message, msg, zeroCopyReceive);
     if (!isValidCommand(message)) {
         logError("invalid command received");
         return 0;
     }
+    if (isCompressedFrame(message)) {
+        std::vector<ActionMessage> messages;
+        if (extractCompressedFrame(message, messages)) {
+            for (auto& framedMessage : messages) {
+                auto status = processRxMessage(std::move(framedMessage));
+                if (status < 0) {
+                    return status;
+                }
+            }
+        }
+        return 0;
+    }
+    return processRxMessage(std::move(message));
+}
+
+int ZmqComms::processRxMessage(ActionMessage&& message)
+{
     if (isProtocolCommand(message)) {
         switch (message.messageID) {
             case CLOSE_RECEIVER:
@@ -429,6 +448,7 @@ int ZmqComms::initializeBrokerConnections(zmq::socket_t& controlSocket)
                     const ActionMessage rxcmd(static_cast<std::byte*>(msg.data()), msg.size());
                     if (isProtocolCommand(rxcmd)) {
                         if (rxcmd.messageID == PORT_DEFINITIONS) {
+                            negotiateParentCompression(rxcmd);
                             controlSocket.send(msg, zmq::send_flags::none);
                             return 0;
                         }
@@ -446,8 +466,8 @@ int ZmqComms::initializeBrokerConnections(zmq::socket_t& controlSocket)
                             logMessage("got new broker information");
                             brokerReq.disconnect(
                                 makePortAddress(brokerTargetAddress, brokerPort + 1));
-                            auto brkprt =
-                                gmlc::networking::extractInterfaceAndPort(rxcmd.getString(0));
+                            auto brkprt = gmlc::networking::extractInterfaceAndPort(
+                                std::string(rxcmd.getString(0)));
                             if (brkprt.second) {
                                 brokerPort = *brkprt.second;
                             }
@@ -481,6 +501,20 @@ int ZmqComms::initializeBrokerConnections(zmq::socket_t& controlSocket)
                     return (-1);
                 }
             }
+        } else if (compression != CompressionType::NONE) {
+            // without a port request the broker has to be asked what it can decompress
+            ActionMessage request(CMD_PROTOCOL);
+            request.messageID = CONNECTION_REQUEST;
+            brokerReq.send(request.to_string());
+            poller.socket = static_cast<void*>(brokerReq);
+            poller.events = ZMQ_POLLIN;
+            if (zmq::poll(&poller, 1, connectionTimeout) > 0) {
+                brokerReq.recv(msg);
+                negotiateParentCompression(ActionMessage(msg.data(), msg.size()));
+            } else {
+                logWarning("broker did not reply to the compression request, data sent to the "
+                           "broker will not be compressed");
+            }
         }
     } else {
         if (PortNumber < 0) {
@@ -603,6 +637,18 @@ void ZmqComms::queue_tx_function()
 
         } else {
             cmd.to_vector(buffer);
+            if (rid != control_route) {
+                // the route sockets only push data so the compression can only be negotiated with
+                // the broker, messages on the other routes are sent uncompressed
+                auto frame = generateCompressedFrame(
+                    std::string_view(buffer.data(), buffer.size()),
+                    (rid == parent_route_id || routes.find(rid) == routes.end()) ?
+                        parentCompression.load() :
+                        CompressionType::NONE);
+                if (frame.action() != CMD_IGNORE) {
+                    frame.to_vector(buffer);
+                }
+            }
         }
         if (rid == parent_route_id) {
             if (hasBroker) {
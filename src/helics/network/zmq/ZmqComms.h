@@ -39,6 +39,9 @@ namespace zeromq {
         /** process an incoming message
     return code for required action 0=NONE, -1 TERMINATE*/
         int processIncomingMessage(zmq::message_t& msg);
+        /** process a message after it has been loaded from the network
+    return code for required action 0=NONE, -1 TERMINATE*/
+        int processRxMessage(ActionMessage&& message);
         /** process an incoming message and send and ack in response
     return code for required action 0=NONE, -1 TERMINATE*/
         int replyToIncomingMessage(zmq::message_t& msg, zmq::socket_t& sock);
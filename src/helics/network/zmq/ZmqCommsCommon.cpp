@@ -6,11 +6,15 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "ZmqCommsCommon.h"
 
+#include "../../core/ActionMessage.hpp"
 #include "../NetworkBrokerData.hpp"
 #include "cppzmq/zmq.hpp"
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <utility>
 
 namespace helics::zeromq {
 using std::chrono::milliseconds;
@@ -42,6 +46,17 @@ bool bindzmqSocket(zmq::socket_t& socket,
     return bindsuccess;
 }
 
+std::size_t loadActionMessage(ActionMessage& message, zmq::message_t& msg, bool adoptBuffer)
+{
+    if (!adoptBuffer || msg.size() < zeroCopyPayloadThreshold) {
+        return message.from_string(
+            std::string_view(static_cast<const char*>(msg.data()), msg.size()));
+    }
+    auto buffer = std::make_shared<zmq::message_t>(std::move(msg));
+    return message.from_string(
+        std::string_view(static_cast<const char*>(buffer->data()), buffer->size()), buffer);
+}
+
 std::string getZMQVersion()
 {
     auto vers = zmq::version();
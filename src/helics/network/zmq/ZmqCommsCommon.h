@@ -10,12 +10,18 @@ SPDX-License-Identifier: BSD-3-Clause
 @details function in this file are common function used between the different TCP comms */
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 class AsioContextManager;
 
 namespace zmq {
 class socket_t;
-}
+class message_t;
+}  // namespace zmq
+
+namespace helics {
+class ActionMessage;
+}  // namespace helics
 
 namespace helics::zeromq {
 static const std::chrono::milliseconds defaultPeriod(200);
@@ -26,6 +32,13 @@ bool bindzmqSocket(zmq::socket_t& socket,
                    int port,
                    std::chrono::milliseconds timeout,
                    std::chrono::milliseconds period = defaultPeriod);
+/** load an action message from a received zmq message
+@param[out] message the action message to load
+@param msg the received message
+@param adoptBuffer if true the zmq message buffer is taken over so large values can reference it
+instead of being copied, msg is left empty in that case
+@return the number of bytes used*/
+std::size_t loadActionMessage(ActionMessage& message, zmq::message_t& msg, bool adoptBuffer);
 /** get the ZeroMQ version currently in use*/
 std::string getZMQVersion();
 }  // namespace helics::zeromq
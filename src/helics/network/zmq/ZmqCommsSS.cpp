@@ -87,7 +87,8 @@ int ZmqCommsSS::processIncomingMessage(zmq::message_t& msg,
             return (-1);
         }
     }
-    ActionMessage message(static_cast<std::byte*>(msg.data()), msg.size());
+    ActionMessage message;
+    loadActionMessage(message, msg, zeroCopyReceive);
 
     if (!isValidCommand(message)) {
         std::cerr << "invalid command received" << message.action() << '\n';
@@ -127,7 +128,7 @@ int ZmqCommsSS::processIncomingMessage(zmq::message_t& msg,
                 break;
             case CONNECTION_INFORMATION:
                 if (serverMode) {
-                    auto sdata = message.getStringData();
+                    const auto& sdata = message.getStringData();
                     if (sdata.size() == 3) {
                         connection_info.emplace(message.name(), sdata[2]);
                     } else {
@@ -138,7 +139,8 @@ int ZmqCommsSS::processIncomingMessage(zmq::message_t& msg,
                 break;
             case NEW_BROKER_INFORMATION: {
                 logMessage("got new broker information");
-                auto brkprt = gmlc::networking::extractInterfaceAndPort(message.getString(0));
+                auto brkprt = gmlc::networking::extractInterfaceAndPort(
+                    std::string(message.getString(0)));
                 if (brkprt.second) {
                     brokerPort = *brkprt.second;
                 }
@@ -496,12 +496,12 @@ Message* MessageHolder::newMessage()
     if (!freeMessageSlots.empty()) {
         auto index = freeMessageSlots.back();
         freeMessageSlots.pop_back();
-        messages[index] = std::make_unique<Message>();
+        messages[index] = messagePool.acquire();
         message = messages[index].get();
         message->counter = index;
 
     } else {
-        messages.push_back(std::make_unique<Message>());
+        messages.push_back(messagePool.acquire());
         message = messages.back().get();
         message->counter = static_cast<int32_t>(messages.size()) - 1;
     }
@@ -528,9 +528,7 @@ void MessageHolder::freeMessage(int index)
 {
     if (isValidIndex(index, messages)) {
         if (messages[index]) {
-            messages[index]->backReference = nullptr;
-            messages[index]->messageValidation = 0;
-            messages[index].reset();
+            messagePool.release(std::move(messages[index]));
             freeMessageSlots.push_back(index);
         }
     }
@@ -281,6 +281,24 @@ HELICS_EXPORT HelicsInput helicsFederateGetInputByTarget(HelicsFederate fed, con
  */
 HELICS_EXPORT void helicsFederateClearUpdates(HelicsFederate fed);
 
+/**
+ * Get the values of a set of inputs as doubles in a single call.
+ *
+ * @details Updated inputs carrying double or integer data are decoded directly into the value array, other inputs are
+ * converted as with helicsInputGetDouble.  The update flag of each input is cleared.
+ *
+ * @param fed The value federate object the inputs belong to.
+ * @param inputs An array of inputs to get the values of.
+ * @param inputCount The number of inputs in the array.
+ * @param[out] values The location to store the values, must have room for inputCount values.
+ *
+ * @param[in,out] err The error object to complete if there is an error.
+ *
+ * @return The number of inputs that had an update.
+ */
+HELICS_EXPORT int
+    helicsFederateGetInputDoubles(HelicsFederate fed, const HelicsInput inputs[], int inputCount, double values[], HelicsError* err);
+
 /**
  * Register the publications via JSON publication string.
  *
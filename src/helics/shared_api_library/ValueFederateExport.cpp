@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -518,6 +519,44 @@ void helicsFederateClearUpdates(HelicsFederate fed)
     // LCOV_EXCL_STOP
 }
 
+int helicsFederateGetInputDoubles(HelicsFederate fed, const HelicsInput inputs[], int inputCount, double values[], HelicsError* err)
+{
+    static constexpr char invalidArrayString[] = "input or value array is invalid";
+    static constexpr char otherFederateString[] = "input does not belong to the federate";
+    auto fedObj = getValueFedSharedPtr(fed, err);
+    if (!fedObj) {
+        return 0;
+    }
+    if (inputCount <= 0) {
+        return 0;
+    }
+    if (inputs == nullptr || values == nullptr) {
+        assignError(err, HELICS_ERROR_INVALID_ARGUMENT, invalidArrayString);
+        return 0;
+    }
+    std::vector<helics::Input*> inputList(inputCount);
+    for (int ii = 0; ii < inputCount; ++ii) {
+        auto* inpObj = verifyInput(inputs[ii], err);
+        if (inpObj == nullptr) {
+            return 0;
+        }
+        if (inpObj->fedptr != fedObj) {
+            assignError(err, HELICS_ERROR_INVALID_ARGUMENT, otherFederateString);
+            return 0;
+        }
+        inputList[ii] = inpObj->inputPtr;
+    }
+    try {
+        return fedObj->getDoubles(inputList, std::span<double>(values, inputCount));
+    }
+    // LCOV_EXCL_START
+    catch (...) {
+        helicsErrorHandler(err);
+        return 0;
+    }
+    // LCOV_EXCL_STOP
+}
+
 /* getting and publishing values */
 void helicsPublicationPublishBytes(HelicsPublication pub, const void* data, int datalen, HelicsError* err)
 {
@@ -79,6 +79,9 @@ typedef enum { /* NOLINT */
                                                 memory it is pretty similar to the test core but
                   stripped from the "test" components*/
                HELICS_CORE_TYPE_INPROC = 18,
+               /** use lock free ring buffers in shared memory to transfer data (for use when all
+                  federates are on the same machine)*/
+               HELICS_CORE_TYPE_SHM = 19,
                /** an explicit core type that is recognized but explicitly doesn't
                                              exist, for testing and a few other assorted reasons*/
                HELICS_CORE_TYPE_NULL = 66,
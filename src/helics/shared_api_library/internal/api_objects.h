@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "../../application_api/helicsTypes.hpp"
 #include "../../common/GuardedTypes.hpp"
+#include "../../core/MessagePool.hpp"
 #include "../../core/core-data.hpp"
 #include "../api-data.h"
 #include "gmlc/concurrency/TripWire.hpp"
@@ -92,6 +93,7 @@ class MessageHolder {
   private:
     std::vector<std::unique_ptr<Message>> messages;
     std::vector<int> freeMessageSlots;
+    MessagePool messagePool;  //!< freed messages kept for reuse by newMessage
 
   public:
     Message* addMessage(std::unique_ptr<Message>& mess);
@@ -370,6 +370,40 @@ TEST_P(new_converter_tests_vector, double_star_tests)
     }
 }
 
+/** reverse the bytes of each 8 byte value after the header and mark the data as big endian*/
+static void toOppositeByteOrder(std::string& convString, std::size_t count)
+{
+    convString[0] = static_cast<char>(convString[0] | 0x01);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        std::reverse(convString.begin() + 8 + ii * 8, convString.begin() + 16 + ii * 8);
+    }
+}
+
+TEST_P(new_converter_tests_vector, swapped_order_tests)
+{
+    auto v2 = GetParam();
+    std::string convString;
+    convString.resize(v2.size() * 8 + 20U);
+    helics::detail::convertToBinary(reinterpret_cast<std::byte*>(convString.data()), v2);
+    toOppositeByteOrder(convString, v2.size());
+
+    decltype(v2) v3;
+    helics::detail::convertFromBinary(reinterpret_cast<const std::byte*>(convString.data()), v3);
+    decltype(v2) v4(v2.size());
+    helics::detail::convertFromBinary(reinterpret_cast<const std::byte*>(convString.data()),
+                                      v4.data());
+    ASSERT_EQ(v3.size(), v2.size());
+    for (size_t ii = 0; ii < v2.size(); ++ii) {
+        if (std::isnan(v2[ii])) {
+            EXPECT_TRUE(std::isnan(v3[ii]));
+            EXPECT_TRUE(std::isnan(v4[ii]));
+        } else {
+            EXPECT_EQ(v2[ii], v3[ii]);
+            EXPECT_EQ(v2[ii], v4[ii]);
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     vector_testing,
     new_converter_tests_vector,
@@ -423,6 +457,19 @@ TEST_P(new_converter_tests_cvector, cvector_tests)
     }
 }
 
+TEST(valueConverter_tests, cvector_swapped_order)
+{
+    const std::vector<std::complex<double>> v2{{1.5, -2.25}, {0.0, 7.125}, {-3e10, 4e-10}};
+    std::string convString;
+    convString.resize(v2.size() * 16 + 20U);
+    helics::detail::convertToBinary(reinterpret_cast<std::byte*>(convString.data()), v2);
+    toOppositeByteOrder(convString, v2.size() * 2);
+
+    std::vector<std::complex<double>> v3;
+    helics::detail::convertFromBinary(reinterpret_cast<const std::byte*>(convString.data()), v3);
+    EXPECT_EQ(v3, v2);
+}
+
 using cv = std::vector<std::complex<double>>;
 using cplx = std::complex<double>;
 
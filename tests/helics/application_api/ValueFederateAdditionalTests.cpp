@@ -9,12 +9,14 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/CoreApp.hpp"
 #include "helics/application_api/Publications.hpp"
 #include "helics/application_api/Subscriptions.hpp"
+#include "helics/application_api/TypedInterfaces.hpp"
 #include "helics/application_api/ValueFederate.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "testFixtures.hpp"
 
 #include <algorithm>
+#include <complex>
 #include <cstdint>
 #include <fstream>
 #include <future>
@@ -1546,6 +1548,207 @@ TEST(valuefederate, duplicate_targets)
     Fed1->finalize();
 }
 
+TEST(valuefederate, bulk_doubles)
+{
+    helics::FederateInfo fedInfo(helics::CoreType::TEST);
+    fedInfo.coreName = "core_bulk";
+    fedInfo.coreInitString = "-f 1 --autobroker";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fedInfo);
+    auto& pub1 = Fed1->registerGlobalPublication<double>("pub1");
+    auto& pub2 = Fed1->registerGlobalPublication<int64_t>("pub2");
+    auto& pub3 = Fed1->registerGlobalPublication<std::string>("pub3");
+    auto& pub4 = Fed1->registerGlobalPublication<double>("pub4", "km");
+
+    auto& inp1 = Fed1->registerSubscription("pub1");
+    auto& inp2 = Fed1->registerSubscription("pub2");
+    auto& inp3 = Fed1->registerSubscription("pub3");
+    auto& inp4 = Fed1->registerSubscription("pub4", "m");
+    std::vector<helics::Input*> inputs{&inp1, &inp2, &inp3, &inp4};
+    std::vector<double> values(inputs.size(), 0.0);
+    Fed1->enterExecutingMode();
+
+    pub1.publish(3.5);
+    pub2.publish(int64_t{7});
+    pub3.publish("2.25");
+    pub4.publish(1.5);
+    Fed1->requestTime(1.0);
+    EXPECT_EQ(Fed1->getDoubles(inputs, values), 4);
+    EXPECT_DOUBLE_EQ(values[0], 3.5);
+    EXPECT_DOUBLE_EQ(values[1], 7.0);
+    EXPECT_DOUBLE_EQ(values[2], 2.25);
+    EXPECT_DOUBLE_EQ(values[3], 1500.0);
+    for (const auto* inp : inputs) {
+        EXPECT_FALSE(inp->isUpdated());
+    }
+    // the values retrieved in bulk are the same the individual calls get
+    EXPECT_DOUBLE_EQ(inp1.getValue<double>(), 3.5);
+    EXPECT_DOUBLE_EQ(inp4.getValue<double>(), 1500.0);
+
+    pub2.publish(int64_t{-4});
+    Fed1->requestTime(2.0);
+    std::fill(values.begin(), values.end(), 0.0);
+    EXPECT_EQ(Fed1->getDoubles(inputs, values), 1);
+    EXPECT_DOUBLE_EQ(values[0], 3.5);
+    EXPECT_DOUBLE_EQ(values[1], -4.0);
+    EXPECT_DOUBLE_EQ(values[2], 2.25);
+    EXPECT_DOUBLE_EQ(values[3], 1500.0);
+
+    std::vector<double> shortValues(2);
+    EXPECT_THROW(Fed1->getDoubles(inputs, shortValues), helics::InvalidParameter);
+    Fed1->finalize();
+}
+
+TEST(valuefederate, vector_unit_conversion)
+{
+    helics::FederateInfo fedInfo(helics::CoreType::TEST);
+    fedInfo.coreName = "core_vunits";
+    fedInfo.coreInitString = "-f 1 --autobroker";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fedInfo);
+    auto& pub1 = Fed1->registerGlobalPublication<std::vector<double>>("pub1", "km");
+    auto& pub2 = Fed1->registerGlobalPublication<std::vector<double>>("pub2", "degC");
+    auto& pub3 = Fed1->registerGlobalPublication<std::vector<std::complex<double>>>("pub3", "kV");
+
+    auto& inp1 = Fed1->registerSubscription("pub1", "m");
+    auto& inp2 = Fed1->registerSubscription("pub2", "degF");
+    auto& inp3 = Fed1->registerSubscription("pub3", "V");
+    // other requested types see the converted values as well
+    auto& inp4 = Fed1->registerSubscription("pub1", "m");
+    auto& inp5 = Fed1->registerSubscription("pub3", "V");
+    Fed1->enterExecutingMode();
+
+    pub1.publish(std::vector<double>{1.5, -2.0, 0.0});
+    pub2.publish(std::vector<double>{0.0, 100.0});
+    pub3.publish(std::vector<std::complex<double>>{{1.0, -0.5}});
+    Fed1->requestTime(1.0);
+
+    auto val1 = inp1.getValue<std::vector<double>>();
+    ASSERT_EQ(val1.size(), 3U);
+    EXPECT_NEAR(val1[0], 1500.0, 1e-9);
+    EXPECT_NEAR(val1[1], -2000.0, 1e-9);
+    EXPECT_NEAR(val1[2], 0.0, 1e-9);
+
+    const auto& val2 = inp2.getValueRef<std::vector<double>>();
+    ASSERT_EQ(val2.size(), 2U);
+    EXPECT_NEAR(val2[0], 32.0, 1e-9);
+    EXPECT_NEAR(val2[1], 212.0, 1e-9);
+
+    auto val3 = inp3.getValue<std::vector<std::complex<double>>>();
+    ASSERT_EQ(val3.size(), 1U);
+    EXPECT_NEAR(val3[0].real(), 1000.0, 1e-9);
+    EXPECT_NEAR(val3[0].imag(), -500.0, 1e-9);
+
+    EXPECT_NEAR(inp4.getDouble(), 2500.0, 1e-9);
+    auto val5 = inp5.getValue<std::complex<double>>();
+    EXPECT_NEAR(val5.real(), 1000.0, 1e-9);
+    EXPECT_NEAR(val5.imag(), -500.0, 1e-9);
+    Fed1->finalize();
+}
+
+TEST(valuefederate, publication_group)
+{
+    helics::FederateInfo fedInfo(helics::CoreType::TEST);
+    fedInfo.coreName = "core_pubgroup";
+    fedInfo.coreInitString = "-f 1 --autobroker";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fedInfo);
+    auto& pub1 = Fed1->registerGlobalPublication<double>("pub1");
+    auto& pub2 = Fed1->registerGlobalPublication<std::string>("pub2");
+    auto& pub3 = Fed1->registerGlobalPublication<int64_t>("pub3");
+    Fed1->addToPublicationGroup(pub1);
+    Fed1->addToPublicationGroup(pub2);
+    pub3.setOption(HELICS_HANDLE_OPTION_PUBLICATION_GROUP);
+    pub3.setOption(HELICS_HANDLE_OPTION_ONLY_TRANSMIT_ON_CHANGE);
+    EXPECT_EQ(pub1.getOption(HELICS_HANDLE_OPTION_PUBLICATION_GROUP), 1);
+
+    auto& inp1 = Fed1->registerSubscription("pub1");
+    auto& inp2 = Fed1->registerSubscription("pub2");
+    auto& inp3 = Fed1->registerSubscription("pub3");
+    auto& inp4 = Fed1->registerSubscription("pub3");
+    Fed1->enterExecutingMode();
+
+    pub1.publish(2.5);
+    pub2.publish("grouped");
+    pub3.publish(int64_t{4});
+    Fed1->requestTime(1.0);
+    EXPECT_TRUE(inp1.isUpdated());
+    EXPECT_DOUBLE_EQ(inp1.getValue<double>(), 2.5);
+    EXPECT_EQ(inp2.getValue<std::string>(), "grouped");
+    EXPECT_EQ(inp3.getValue<int64_t>(), 4);
+    EXPECT_EQ(inp4.getValue<int64_t>(), 4);
+
+    // the unchanged value of pub3 is not sent again
+    pub1.publish(3.5);
+    pub3.publish(int64_t{4});
+    Fed1->requestTime(2.0);
+    EXPECT_TRUE(inp1.isUpdated());
+    EXPECT_DOUBLE_EQ(inp1.getValue<double>(), 3.5);
+    EXPECT_FALSE(inp2.isUpdated());
+    EXPECT_FALSE(inp3.isUpdated());
+    EXPECT_FALSE(inp4.isUpdated());
+
+    pub3.publish(int64_t{-9});
+    Fed1->requestTime(3.0);
+    EXPECT_FALSE(inp1.isUpdated());
+    EXPECT_TRUE(inp3.isUpdated());
+    EXPECT_EQ(inp3.getValue<int64_t>(), -9);
+    EXPECT_EQ(inp4.getValue<int64_t>(), -9);
+    Fed1->finalize();
+}
+
+TEST(valuefederate, typed_interfaces)
+{
+    helics::FederateInfo fedInfo(helics::CoreType::TEST);
+    fedInfo.coreName = "core_typed";
+    fedInfo.coreInitString = "-f 1 --autobroker";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fedInfo);
+    helics::TypedPublication<double> pubD(Fed1.get(), "pubd", "m");
+    helics::TypedPublication<int64_t> pubI(Fed1.get(), "pubi");
+    helics::TypedPublication<std::vector<double>> pubV(Fed1.get(), "pubv");
+
+    helics::TypedInput<double> inpD(Fed1->registerSubscription("vfed1/pubd"));
+    helics::TypedInput<double> inpCm(Fed1->registerSubscription("vfed1/pubd", "cm"));
+    helics::TypedInput<double> inpI(Fed1->registerSubscription("vfed1/pubi"));
+    helics::TypedInput<std::vector<double>> inpV(Fed1->registerSubscription("vfed1/pubv"));
+    inpD.setDefault(-1.0);
+    Fed1->enterExecutingMode();
+    EXPECT_DOUBLE_EQ(inpD.getValue(), -1.0);
+
+    pubD.publish(2.5);
+    pubI.publish(7);
+    pubV.publish({1.0, 2.0, 3.0});
+    Fed1->requestTime(1.0);
+    EXPECT_TRUE(inpD.isUpdated());
+    EXPECT_DOUBLE_EQ(inpD.getValue(), 2.5);
+    EXPECT_TRUE(inpD.isDirect());
+    EXPECT_FALSE(inpD.isUpdated());
+    EXPECT_DOUBLE_EQ(inpCm.getValue(), 250.0);
+    EXPECT_FALSE(inpCm.isDirect());
+    EXPECT_DOUBLE_EQ(inpI.getValue(), 7.0);
+    EXPECT_FALSE(inpI.isDirect());
+    EXPECT_EQ(inpV.getValue(), std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_TRUE(inpV.isDirect());
+
+    // the value is kept until the next update
+    pubV.publish({4.0});
+    Fed1->requestTime(2.0);
+    EXPECT_FALSE(inpD.isUpdated());
+    EXPECT_DOUBLE_EQ(inpD.getValue(), 2.5);
+    EXPECT_EQ(inpV.getValue(), std::vector<double>({4.0}));
+
+    // change detection on the publication goes through the general publish
+    pubD.getPublication().setMinimumChange(1.0);
+    pubD.publish(4.0);
+    Fed1->requestTime(3.0);
+    EXPECT_DOUBLE_EQ(inpD.getValue(), 4.0);
+    pubD.publish(4.5);
+    Fed1->requestTime(4.0);
+    EXPECT_FALSE(inpD.isUpdated());
+    Fed1->finalize();
+}
+
 class vfedPermutation: public ::testing::TestWithParam<int>, public FederateTestFixture {};
 
 TEST_P(vfedPermutation, value_linking_order_permutations_nosan)
@@ -73,6 +73,29 @@ TEST(helics_types, complex_cvector_string)
     EXPECT_EQ(v.imag(), 0);
 }
 
+TEST(helics_types, complex_string_forms)
+{
+    auto v = helicsGetComplex("3+4j");
+    EXPECT_EQ(v, std::complex<double>(3, 4));
+    v = helicsGetComplex(" -2.5 - 1.5i ");
+    EXPECT_EQ(v, std::complex<double>(-2.5, -1.5));
+    v = helicsGetComplex("1e3+2.5e-2j");
+    EXPECT_EQ(v, std::complex<double>(1e3, 2.5e-2));
+    v = helicsGetComplex("-7j");
+    EXPECT_EQ(v, std::complex<double>(0, -7));
+    v = helicsGetComplex("value: 3+4j");
+    EXPECT_EQ(v, std::complex<double>(3, 4));
+    v = helicsGetComplex("45.2");
+    EXPECT_EQ(v, std::complex<double>(45.2, 0));
+    v = helicsGetComplex("[1.5,-2]");
+    EXPECT_EQ(v, std::complex<double>(1.5, -2));
+
+    v = helicsGetComplex("invalid");
+    EXPECT_GT(std::abs(v.real()), 1e40);
+    v = helicsGetComplex("1e400");
+    EXPECT_GT(std::abs(v.real()), 1e40);
+}
+
 TEST(helics_types, double_string)
 {
     auto v = getDoubleFromString(std::string{});
@@ -203,3 +226,37 @@ TEST(json_type_conversion, to_json)
     EXPECT_EQ(result.index(), int_loc);
     EXPECT_EQ(std::get<std::int64_t>(result), 1);
 }
+
+TEST(json_type_conversion, json_layout)
+{
+    // the json blocks are written directly so check they match the json library output
+    nlohmann::json json;
+    json["type"] = typeNameStringRef(DataType::HELICS_DOUBLE);
+    json["value"] = 0.1;
+    auto res = typeConvert(DataType::HELICS_JSON, 0.1);
+    EXPECT_EQ(res.to_string(), fileops::generateJsonString(json));
+
+    json["type"] = typeNameStringRef(DataType::HELICS_VECTOR);
+    json["value"] = std::vector<double>{1.0, -2.5e-12, 1e100};
+    res = typeConvert(DataType::HELICS_JSON, std::vector<double>{1.0, -2.5e-12, 1e100});
+    EXPECT_EQ(res.to_string(), fileops::generateJsonString(json));
+
+    json["type"] = typeNameStringRef(DataType::HELICS_STRING);
+    json["value"] = "quote\"tab\t";
+    res = typeConvert(DataType::HELICS_JSON, std::string_view("quote\"tab\t"));
+    EXPECT_EQ(res.to_string(), fileops::generateJsonString(json));
+    auto result = readJsonValue(res);
+    ASSERT_EQ(result.index(), string_loc);
+    EXPECT_EQ(std::get<std::string>(result), "quote\"tab\t");
+
+    json["name"] = "pt";
+    json["type"] = typeNameStringRef(DataType::HELICS_NAMED_POINT);
+    json["value"] = -17.25;
+    res = typeConvert(DataType::HELICS_JSON, NamedPoint("pt", -17.25));
+    EXPECT_EQ(res.to_string(), fileops::generateJsonString(json));
+
+    json.erase("type");
+    EXPECT_EQ(helicsNamedPointString("pt", -17.25), fileops::generateJsonString(json));
+    auto point = helicsGetNamedPoint(helicsNamedPointString("pt", -17.25));
+    EXPECT_EQ(point, NamedPoint("pt", -17.25));
+}
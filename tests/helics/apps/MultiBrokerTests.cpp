@@ -7,16 +7,20 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/BrokerApp.hpp"
 #include "helics/application_api/CoreApp.hpp"
 #include "helics/application_api/ValueFederate.hpp"
+#include "helics/apps/LinkBalancer.hpp"
 #include "helics/apps/MultiBroker.hpp"
+#include "helics/common/JsonProcessingFunctions.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/core/core-exceptions.hpp"
 
 #include "gtest/gtest.h"
+#include <chrono>
 #include <cstdio>
 #include <filesystem>
 #include <future>
 #include <string>
+#include <vector>
 
 static const bool amb = helics::allowMultiBroker();
 
@@ -50,6 +54,74 @@ TEST(MultiBroker, connect1)
     helics::CoreFactory::terminateAllCores();
 }
 
+TEST(MultiBroker, link_balancer_least_loaded)
+{
+    using namespace std::chrono_literals;
+    helics::LinkBalancer balancer;
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<helics::LinkBalancer::LinkLoad> loads{{5, 0}, {0, 0}, {2, 0}};
+    EXPECT_EQ(balancer.selectLink(helics::GlobalFederateId(131072), loads, now), 1U);
+    loads[1].available = false;
+    EXPECT_EQ(balancer.selectLink(helics::GlobalFederateId(131073), loads, now), 2U);
+}
+
+TEST(MultiBroker, link_balancer_source_order)
+{
+    using namespace std::chrono_literals;
+    helics::LinkBalancer balancer;
+    const helics::GlobalFederateId source(131072);
+    auto now = std::chrono::steady_clock::now();
+    std::vector<helics::LinkBalancer::LinkLoad> loads{{0, 0}, {0, 0}};
+    auto link = balancer.selectLink(source, loads, now);
+    EXPECT_EQ(link, 0U);
+    loads[0].pending = 1;
+    balancer.recordQueued(source, link, 1);
+
+    // the first link is busier but the marker after the message has not been acknowledged
+    loads[0].pending = 10;
+    now += 50ms;
+    EXPECT_EQ(balancer.selectLink(source, loads, now), 0U);
+    // another source is free to use the idle link
+    EXPECT_EQ(balancer.selectLink(helics::GlobalFederateId(131073), loads, now), 1U);
+    // sending the message is not enough, it has to have arrived
+    loads[0].processed = 1;
+    EXPECT_EQ(balancer.selectLink(source, loads, now), 0U);
+
+    // once the marker is acknowledged the source can move right away
+    loads[0].acknowledged = 1;
+    EXPECT_EQ(balancer.selectLink(source, loads, now), 1U);
+    balancer.recordQueued(source, 1, 3);
+    loads[1].pending = 20;
+    loads[0].pending = 0;
+    // an earlier marker on the new link does not cover the message
+    loads[1].acknowledged = 2;
+    EXPECT_EQ(balancer.selectLink(source, loads, now), 1U);
+    loads[1].acknowledged = 3;
+    EXPECT_EQ(balancer.selectLink(source, loads, now), 0U);
+}
+
+TEST(MultiBroker, link_balancer_rate)
+{
+    using namespace std::chrono_literals;
+    helics::LinkBalancer balancer;
+    const helics::GlobalFederateId source(131072);
+    auto now = std::chrono::steady_clock::now();
+    std::vector<helics::LinkBalancer::LinkLoad> loads{{100, 0}, {100, 0}};
+    balancer.selectLink(source, loads, now);
+    // the second link sends ten times as fast as the first
+    now += 100ms;
+    loads[0].processed = 100;
+    loads[1].processed = 1000;
+    EXPECT_EQ(balancer.selectLink(source, loads, now), 1U);
+    EXPECT_NEAR(balancer.sendRate(0), 1000.0, 1.0);
+    EXPECT_NEAR(balancer.sendRate(1), 10000.0, 10.0);
+    // with the same number waiting the faster link has the shorter delay
+    EXPECT_LT(balancer.expectedDelay(1), balancer.expectedDelay(0));
+    loads[0].pending = 5;
+    loads[1].pending = 20;
+    EXPECT_EQ(balancer.selectLink(helics::GlobalFederateId(131073), loads, now), 1U);
+}
+
 #if defined(HELICS_ENABLE_ZMQ_CORE)
 TEST(MultiBroker, file2)
 {
@@ -190,3 +262,53 @@ TEST(MultiBroker, link2)
 
 #    endif
 #endif
+
+#if defined(HELICS_ENABLE_TCP_CORE)
+TEST(MultiBroker, parent_links)
+{
+    using helics::CoreType;
+    helics::BrokerApp root(CoreType::TCP, "rootpl", "-f 2");
+    EXPECT_TRUE(root.isConnected());
+
+    const std::string config = "--config=" + std::string(TEST_DIR) + "multiBroker5.json";
+    helics::BrokerApp App(CoreType::MULTI, "brkpl", config);
+    EXPECT_TRUE(App.isConnected());
+
+    helics::CoreApp c1(CoreType::TEST, "--brokername=brkpl --name=corepl1");
+    EXPECT_TRUE(c1.connect());
+    helics::CoreApp c2(CoreType::TCP, "--name=corepl2");
+    EXPECT_TRUE(c2.connect());
+
+    helics::ValueFederate fedA("fedpla", c1);
+    auto& pub = fedA.registerGlobalPublication<double>("plkey");
+    helics::ValueFederate fedB("fedplb", c2);
+    auto& sub = fedB.registerSubscription("plkey");
+    fedA.enterExecutingModeAsync();
+    fedB.enterExecutingMode();
+    fedA.enterExecutingModeComplete();
+
+    for (int ii = 1; ii <= 20; ++ii) {
+        pub.publish(static_cast<double>(ii));
+        fedA.requestTimeAsync(ii);
+        fedB.requestTime(ii);
+        fedA.requestTimeComplete();
+        EXPECT_DOUBLE_EQ(sub.getValue<double>(), static_cast<double>(ii));
+    }
+    auto links = helics::fileops::loadJsonStr(App.query("root", "parent_links"));
+    ASSERT_EQ(links.size(), 2U);
+    EXPECT_EQ(links[1]["index"].get<int>(), 1);
+    // the parent acknowledges the markers so no fence waits for the timeout
+    EXPECT_GT(links[0]["acknowledged"].get<int>(), 0);
+    EXPECT_EQ(links[0]["fence_timeouts"].get<int>(), 0);
+
+    fedA.finalize();
+    fedB.finalize();
+    c1.reset();
+    c2.reset();
+    EXPECT_TRUE(App.waitForDisconnect(std::chrono::milliseconds(1000)));
+    EXPECT_TRUE(root.waitForDisconnect(std::chrono::milliseconds(1000)));
+    App.reset();
+    root.reset();
+    helics::cleanupHelicsLibrary();
+}
+#endif
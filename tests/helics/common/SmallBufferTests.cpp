@@ -367,6 +367,26 @@ TEST(small_buffer_tests, buffer_borrow_full)
     // the Smallbuffer should not delete the object
 }
 
+TEST(small_buffer_tests, buffer_borrow_read_only)
+{
+    const std::string data(300, 'r');
+    SmallBuffer buffer1;
+    buffer1.spanAssign(const_cast<char*>(data.data()), data.size(), 0);
+    EXPECT_EQ(buffer1.size(), 300U);
+    EXPECT_EQ(buffer1.to_string(), data);
+
+    // a shorter assignment copies to a new buffer instead of writing into the span
+    buffer1 = std::string_view("abc");
+    EXPECT_EQ(buffer1.to_string(), "abc");
+    EXPECT_EQ(data, std::string(300, 'r'));
+
+    SmallBuffer buffer2;
+    buffer2.spanAssign(const_cast<char*>(data.data()), data.size(), 0);
+    buffer2.resize(10);
+    EXPECT_NE(buffer2.data(), reinterpret_cast<const std::byte*>(data.data()));
+    EXPECT_EQ(buffer2.to_string(), std::string(10, 'r'));
+}
+
 TEST(small_buffer_tests, buffer_borrow_locked)
 {
     SmallBuffer buffer1(std::string(2354, 'b'));
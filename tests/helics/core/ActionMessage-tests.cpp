@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace helics;
 
@@ -574,3 +575,333 @@ TEST(ActionMessage, jsonconversion_test_binary_strings2)
     EXPECT_EQ(cmd.flags, cmd2.flags);
     EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
 }
+
+TEST(ActionMessage, string_data_aliasing)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.setStringData("target", "source", "original_source");
+    // setting a string from another string in the same message must not corrupt the data
+    cmd.setString(targetStringLoc, cmd.getString(sourceStringLoc));
+    cmd.setString(sourceStringLoc, "a much longer replacement source string");
+    EXPECT_EQ(cmd.getString(targetStringLoc), "source");
+    EXPECT_EQ(cmd.getString(sourceStringLoc), "a much longer replacement source string");
+    EXPECT_EQ(cmd.getString(origSourceStringLoc), "original_source");
+
+    cmd.setStringData(cmd.getString(origSourceStringLoc), cmd.getString(targetStringLoc));
+    EXPECT_EQ(cmd.getStringData().size(), 2U);
+    EXPECT_EQ(cmd.getString(0), "original_source");
+    EXPECT_EQ(cmd.getString(1), "source");
+    EXPECT_TRUE(cmd.getString(2).empty());
+}
+
+TEST(ActionMessage, string_data_copy_move)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.setStringData("target", "", "original_source", "original_dest");
+
+    helics::ActionMessage cmd2(helics::CMD_PUB);
+    cmd2.setStringData("a string that is longer than all the others in the first message");
+    cmd2 = cmd;
+    EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
+    EXPECT_TRUE(cmd2.getString(sourceStringLoc).empty());
+
+    helics::ActionMessage cmd3(std::move(cmd2));
+    EXPECT_TRUE(cmd.getStringData() == cmd3.getStringData());
+    cmd3.setString(7, "seven");
+    EXPECT_EQ(cmd3.getStringData().size(), 8U);
+    EXPECT_EQ(cmd3.getString(origDestStringLoc), "original_dest");
+    EXPECT_TRUE(cmd3.getString(5).empty());
+    EXPECT_EQ(cmd3.getString(7), "seven");
+    EXPECT_FALSE(cmd.getStringData() == cmd3.getStringData());
+}
+
+TEST(ActionMessage, multi_message_strings)
+{
+    helics::ActionMessage multi(helics::CMD_MULTI_MESSAGE);
+    std::vector<helics::ActionMessage> messages;
+    for (int ii = 0; ii < 200; ++ii) {
+        helics::ActionMessage cmd(helics::CMD_PUB);
+        cmd.source_id = GlobalFederateId(ii);
+        cmd.payload = std::string(static_cast<std::size_t>(ii % 17), 'a');
+        EXPECT_EQ(appendMessage(multi, cmd), ii + 1);
+        messages.push_back(std::move(cmd));
+    }
+
+    auto load = multi.to_string();
+    helics::ActionMessage multi2(load);
+    ASSERT_EQ(multi2.counter, 200);
+    ASSERT_EQ(multi2.getStringData().size(), 200U);
+    for (int ii = 0; ii < 200; ++ii) {
+        helics::ActionMessage cmd;
+        cmd.from_string(multi2.getString(ii));
+        EXPECT_EQ(cmd.source_id, messages[ii].source_id);
+        EXPECT_EQ(cmd.payload, messages[ii].payload);
+    }
+}
+
+TEST(ActionMessage, coalesce_timing)
+{
+    std::vector<helics::ActionMessage> batch;
+    auto timeRequest = [](int32_t source, int32_t dest, helics::Time request) {
+        helics::ActionMessage treq(helics::CMD_TIME_REQUEST);
+        treq.source_id = GlobalFederateId(source);
+        treq.dest_id = GlobalFederateId(dest);
+        treq.actionTime = request;
+        return treq;
+    };
+    batch.push_back(timeRequest(1, 2, 1.0));
+    batch.push_back(timeRequest(3, 2, 1.0));
+    batch.push_back(timeRequest(1, 2, 2.0));
+    batch.push_back(timeRequest(1, 4, 2.0));
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.source_id = GlobalFederateId(1);
+    pub.dest_id = GlobalFederateId(2);
+    batch.push_back(pub);
+    batch.push_back(timeRequest(1, 2, 3.0));
+    batch.push_back(timeRequest(1, 2, 4.0));
+    auto iterating = timeRequest(1, 2, 4.0);
+    setActionFlag(iterating, iteration_requested_flag);
+    batch.push_back(iterating);
+
+    EXPECT_EQ(coalesceTimingMessages(batch), 2U);
+    ASSERT_EQ(batch.size(), 6U);
+    EXPECT_EQ(batch[0].source_id, GlobalFederateId(3));
+    EXPECT_EQ(batch[1].actionTime, 2.0);
+    EXPECT_EQ(batch[1].dest_id, GlobalFederateId(2));
+    EXPECT_EQ(batch[2].dest_id, GlobalFederateId(4));
+    EXPECT_EQ(batch[3].action(), helics::CMD_PUB);
+    // the request after the publication cannot be merged with the one before it
+    EXPECT_EQ(batch[4].actionTime, 4.0);
+    EXPECT_FALSE(checkActionFlag(batch[4], iteration_requested_flag));
+    EXPECT_TRUE(checkActionFlag(batch[5], iteration_requested_flag));
+}
+
+TEST(ActionMessage, shared_payload)
+{
+    const std::string value(200, 'a');
+    auto buffer = std::make_shared<const helics::SmallBuffer>(value);
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.setSharedPayload(buffer);
+    EXPECT_TRUE(pub.hasSharedPayload());
+    EXPECT_EQ(pub.payload.to_string(), value);
+
+    // copies view the same data
+    helics::ActionMessage copy(pub);
+    EXPECT_TRUE(copy.hasSharedPayload());
+    EXPECT_EQ(copy.payload.data(), buffer->data());
+    helics::ActionMessage assigned(helics::CMD_PUB);
+    assigned.payload = std::string(20, 'b');
+    assigned = pub;
+    EXPECT_EQ(assigned.payload.data(), buffer->data());
+
+    // assigning over a shared payload must not write into the shared buffer
+    helics::ActionMessage other(helics::CMD_PUB);
+    other.payload = std::string(200, 'c');
+    assigned = other;
+    EXPECT_FALSE(assigned.hasSharedPayload());
+    EXPECT_EQ(assigned.payload.to_string(), other.payload.to_string());
+    EXPECT_EQ(buffer->to_string(), value);
+
+    // modifying a copy of a shared payload copies the data first
+    {
+        helics::ActionMessage shrunk(pub);
+        shrunk.payload = std::string(10, 'd');
+        EXPECT_NE(shrunk.payload.data(), buffer->data());
+        helics::ActionMessage appended(pub);
+        appended.payload.append(std::string_view("xyz"));
+        EXPECT_EQ(appended.payload.size(), 203U);
+        helics::ActionMessage resized(pub);
+        resized.payload.resize(5);
+        resized.payload.append(std::string_view("e"));
+        EXPECT_EQ(resized.payload.to_string(), "aaaaae");
+        helics::ActionMessage cleared(pub);
+        cleared.payload.clear();
+        cleared.payload.append(std::string_view("f"));
+        EXPECT_EQ(cleared.payload.to_string(), "f");
+        EXPECT_EQ(buffer->to_string(), value);
+        EXPECT_EQ(copy.payload.to_string(), value);
+    }
+
+    // serialization carries the data
+    helics::ActionMessage rt(pub.to_string());
+    EXPECT_FALSE(rt.hasSharedPayload());
+    EXPECT_EQ(rt.payload.to_string(), value);
+
+    auto extracted = copy.extractSharedPayload();
+    EXPECT_EQ(extracted, buffer);
+    EXPECT_TRUE(copy.payload.empty());
+    EXPECT_EQ(buffer.use_count(), 3);
+
+    pub.detachPayload();
+    EXPECT_FALSE(pub.hasSharedPayload());
+    EXPECT_NE(pub.payload.data(), buffer->data());
+    EXPECT_EQ(pub.payload.to_string(), value);
+    pub.payload[0] = std::byte{'z'};
+    EXPECT_EQ(buffer->to_string(), value);
+
+    // an unshared payload is moved into a new buffer
+    auto unshared = other.extractSharedPayload();
+    EXPECT_EQ(unshared->size(), 200U);
+    EXPECT_TRUE(other.payload.empty());
+}
+
+TEST(ActionMessage, shared_receive_buffer)
+{
+    const std::string value(2000, 'v');
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.payload = value;
+    pub.setStringData("type", "units");
+    helics::ActionMessage small(helics::CMD_PUB);
+    small.payload = std::string(100, 's');
+    helics::ActionMessage message(helics::CMD_SEND_MESSAGE);
+    message.payload = value;
+
+    auto data = std::make_shared<const std::string>(pub.packetize() + small.packetize() +
+                                                    message.packetize());
+    const auto* bytes = data->data();
+    std::size_t used{0};
+    helics::ActionMessage rx;
+    used += rx.depacketize(bytes, data->size(), data);
+    // the value is a view of the receive buffer and keeps it alive
+    EXPECT_TRUE(rx.hasSharedPayload());
+    EXPECT_GE(rx.payload.char_data(), bytes);
+    EXPECT_LT(rx.payload.char_data(), bytes + data->size());
+    EXPECT_EQ(rx.payload.to_string(), value);
+    EXPECT_EQ(rx.getString(1), "units");
+    EXPECT_EQ(data.use_count(), 2);
+
+    helics::ActionMessage rxSmall;
+    used += rxSmall.depacketize(bytes + used, data->size() - used, data);
+    EXPECT_FALSE(rxSmall.hasSharedPayload());
+    EXPECT_EQ(rxSmall.payload, small.payload);
+
+    // only value payloads reference the buffer
+    helics::ActionMessage rxMessage;
+    used += rxMessage.depacketize(bytes + used, data->size() - used, data);
+    EXPECT_EQ(used, data->size());
+    EXPECT_FALSE(rxMessage.hasSharedPayload());
+    EXPECT_EQ(rxMessage.payload.to_string(), value);
+
+    auto extracted = rx.extractSharedPayload();
+    EXPECT_EQ(extracted->to_string(), value);
+    rx = helics::ActionMessage(helics::CMD_IGNORE);
+    EXPECT_EQ(data.use_count(), 2);
+    extracted.reset();
+    EXPECT_EQ(data.use_count(), 1);
+
+    // binary serialization works the same way
+    auto binary = std::make_shared<const std::string>(pub.to_string());
+    helics::ActionMessage rx2;
+    EXPECT_EQ(rx2.from_string(*binary, binary), binary->size());
+    EXPECT_TRUE(rx2.hasSharedPayload());
+    EXPECT_EQ(rx2.payload.to_string(), value);
+}
+
+TEST(ActionMessage, shared_payload_from_copied_packet)
+{
+    const std::string value(2000, 'v');
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.payload = value;
+    auto packet = pub.packetize() + helics::ActionMessage(helics::CMD_PROTOCOL).packetize();
+
+    helics::ActionMessage rx;
+    auto used = rx.depacketize(packet.data(), packet.size());
+    EXPECT_LT(used, packet.size());
+    EXPECT_FALSE(rx.hasSharedPayload());
+    // moving the payload into a shared buffer keeps its memory and retains only the payload
+    const auto* payloadData = rx.payload.data();
+    rx.setSharedPayload(rx.extractSharedPayload());
+    EXPECT_TRUE(rx.hasSharedPayload());
+    EXPECT_EQ(rx.payload.data(), payloadData);
+    EXPECT_EQ(rx.payload.to_string(), value);
+    auto shared = rx.extractSharedPayload();
+    EXPECT_EQ(shared->size(), value.size());
+
+    helics::ActionMessage copy(helics::CMD_PUB);
+    copy.setSharedPayload(shared);
+    helics::ActionMessage copy2(copy);
+    EXPECT_EQ(copy2.payload.data(), payloadData);
+}
+
+TEST(ActionMessage, batch_packetization)
+{
+    std::vector<helics::ActionMessage> batch;
+    helics::ActionMessage treq(helics::CMD_TIME_REQUEST);
+    treq.source_id = GlobalFederateId(5);
+    treq.actionTime = 2.0;
+    treq.Te = 3.0;
+    batch.push_back(treq);
+    helics::ActionMessage message(helics::CMD_SEND_MESSAGE);
+    message.payload = std::string(300, 'p');
+    message.setStringData("target", "source");
+    batch.push_back(message);
+    batch.emplace_back(helics::CMD_PING);
+
+    std::string data;
+    helics::packetizeBatch(batch, data);
+    std::string individual;
+    for (const auto& cmd : batch) {
+        individual.append(cmd.packetize());
+    }
+    EXPECT_EQ(data, individual);
+
+    // a partial packet at the end is not used
+    data.append(batch[1].packetize().substr(0, 20));
+    std::vector<helics::ActionMessage> received;
+    auto used = helics::depacketizeBatch(data.data(), data.size(), received);
+    EXPECT_EQ(used, individual.size());
+    ASSERT_EQ(received.size(), 3U);
+    EXPECT_EQ(received[0].action(), helics::CMD_TIME_REQUEST);
+    EXPECT_EQ(received[0].Te, treq.Te);
+    EXPECT_EQ(received[1].payload, message.payload);
+    EXPECT_EQ(received[1].getString(1), "source");
+    EXPECT_EQ(received[2].action(), helics::CMD_PING);
+
+    // appending does not disturb existing packets
+    std::string appended = batch[0].packetize();
+    batch[2].appendPacket(appended);
+    received.clear();
+    EXPECT_EQ(helics::depacketizeBatch(appended.data(), appended.size(), received),
+              appended.size());
+    ASSERT_EQ(received.size(), 2U);
+    EXPECT_EQ(received[1].action(), helics::CMD_PING);
+}
+
+TEST(ActionMessage, publication_batch)
+{
+    std::vector<helics::PublicationBatchEntry> entries;
+    entries.push_back({helics::InterfaceHandle(3),
+                       helics::InterfaceHandle(7),
+                       std::make_shared<const helics::SmallBuffer>(std::string_view("value1"))});
+    entries.push_back({helics::InterfaceHandle(4),
+                       helics::InterfaceHandle(70000),
+                       std::make_shared<const helics::SmallBuffer>()});
+    entries.push_back({helics::InterfaceHandle(5),
+                       helics::InterfaceHandle(9),
+                       std::make_shared<const helics::SmallBuffer>(std::string(2000, 'b'))});
+
+    helics::ActionMessage batch(helics::CMD_PUB_BATCH);
+    batch.source_id = GlobalFederateId(12);
+    batch.actionTime = 4.0;
+    helics::packPublicationBatch(batch, entries);
+    EXPECT_EQ(batch.payload.size(), 4U + 3U * 12U + 2006U);
+
+    // the batch survives serialization including a view of the receive buffer
+    auto data = std::make_shared<const std::string>(batch.packetize());
+    helics::ActionMessage rx;
+    EXPECT_EQ(rx.depacketize(data->data(), data->size(), data), data->size());
+    EXPECT_EQ(rx.action(), helics::CMD_PUB_BATCH);
+    auto received = helics::unpackPublicationBatch(rx);
+    ASSERT_EQ(received.size(), entries.size());
+    for (std::size_t ii = 0; ii < entries.size(); ++ii) {
+        EXPECT_EQ(received[ii].source_handle, entries[ii].source_handle);
+        EXPECT_EQ(received[ii].dest_handle, entries[ii].dest_handle);
+        EXPECT_EQ(*received[ii].data, *entries[ii].data);
+    }
+
+    // a truncated payload produces no values
+    batch.payload.resize(batch.payload.size() - 1);
+    EXPECT_TRUE(helics::unpackPublicationBatch(batch).empty());
+    batch.payload.resize(10);
+    EXPECT_TRUE(helics::unpackPublicationBatch(batch).empty());
+}
@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/ActionQueue.hpp"
+
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+TEST(lockFreeQueue, basic)
+{
+    LockFreeActionQueue queue(8);
+    EXPECT_EQ(queue.capacity(), 8U);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop());
+
+    ActionMessage cmd(CMD_PUB);
+    cmd.messageID = 1;
+    queue.push(cmd);
+    cmd.messageID = 2;
+    queue.push(std::move(cmd));
+    EXPECT_FALSE(queue.empty());
+
+    auto res = queue.try_pop();
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->messageID, 1);
+    EXPECT_EQ(queue.pop().messageID, 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(lockFreeQueue, priority)
+{
+    LockFreeActionQueue queue(8);
+    queue.push(ActionMessage(CMD_PUB));
+    queue.pushPriority(ActionMessage(CMD_PING));
+    EXPECT_EQ(queue.pop().action(), CMD_PING);
+    EXPECT_EQ(queue.pop().action(), CMD_PUB);
+}
+
+TEST(lockFreeQueue, overflow_ordering)
+{
+    LockFreeActionQueue queue(4);
+    for (int ii = 0; ii < 20; ++ii) {
+        ActionMessage cmd(CMD_PUB);
+        cmd.messageID = ii;
+        queue.push(std::move(cmd));
+        if (ii == 9) {
+            // drain part of the queue while the overflow is in use
+            EXPECT_EQ(queue.pop().messageID, 0);
+            EXPECT_EQ(queue.pop().messageID, 1);
+        }
+    }
+    for (int ii = 2; ii < 20; ++ii) {
+        EXPECT_EQ(queue.pop().messageID, ii);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(lockFreeQueue, multi_producer)
+{
+    static constexpr int producers{6};
+    static constexpr int messageCount{20000};
+    LockFreeActionQueue queue(64);
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    for (int pp = 0; pp < producers; ++pp) {
+        threads.emplace_back([&queue, pp]() {
+            for (int ii = 0; ii < messageCount; ++ii) {
+                ActionMessage cmd(CMD_PUB);
+                cmd.source_id = GlobalFederateId(pp);
+                cmd.messageID = ii;
+                if (ii % 1000 == 999) {
+                    std::this_thread::yield();
+                }
+                queue.push(std::move(cmd));
+            }
+        });
+    }
+    // the messages from each producer must arrive in order
+    std::vector<int32_t> next(producers, 0);
+    for (int ii = 0; ii < producers * messageCount; ++ii) {
+        auto cmd = queue.pop();
+        auto& expected = next[cmd.source_id.baseValue()];
+        EXPECT_EQ(cmd.messageID, expected);
+        expected = cmd.messageID + 1;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(queue.empty());
+    for (auto count : next) {
+        EXPECT_EQ(count, messageCount);
+    }
+}
+
+TEST(lockFreeQueue, multi_producer_small_ring)
+{
+    // a tiny ring keeps the producers switching between the ring and the overflow so the
+    // consumer regularly finds a claimed but unpublished head slot
+    static constexpr int producers{4};
+    static constexpr int messageCount{20000};
+    LockFreeActionQueue queue(2);
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    for (int pp = 0; pp < producers; ++pp) {
+        threads.emplace_back([&queue, pp]() {
+            for (int ii = 0; ii < messageCount; ++ii) {
+                ActionMessage cmd(CMD_PUB);
+                cmd.source_id = GlobalFederateId(pp);
+                cmd.messageID = ii;
+                queue.push(std::move(cmd));
+            }
+        });
+    }
+    std::vector<int32_t> next(producers, 0);
+    for (int ii = 0; ii < producers * messageCount; ++ii) {
+        auto cmd = queue.pop();
+        auto& expected = next[cmd.source_id.baseValue()];
+        EXPECT_EQ(cmd.messageID, expected);
+        expected = cmd.messageID + 1;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(actionQueue, type_switch)
+{
+    ActionQueue queue;
+    EXPECT_EQ(queue.getQueueType(), ActionQueue::QueueType::BLOCKING);
+    ActionMessage cmd(CMD_PUB);
+    cmd.messageID = 1;
+    queue.push(cmd);
+    queue.setQueueType(ActionQueue::QueueType::LOCK_FREE);
+    EXPECT_EQ(queue.getQueueType(), ActionQueue::QueueType::LOCK_FREE);
+    cmd.messageID = 2;
+    queue.push(cmd);
+    queue.pushPriority(ActionMessage(CMD_PING));
+
+    EXPECT_EQ(queue.pop().action(), CMD_PING);
+    EXPECT_EQ(queue.pop().messageID, 1);
+    cmd.messageID = 3;
+    queue.push(cmd);
+    queue.setQueueType(ActionQueue::QueueType::BLOCKING);
+    EXPECT_EQ(queue.pop().messageID, 2);
+    EXPECT_EQ(queue.pop().messageID, 3);
+    EXPECT_TRUE(queue.empty());
+}
@@ -605,3 +605,54 @@ TEST(handleManager, aliasCascadeFutureManyOther)
     p1 = h1.getInterfaceHandle("publisher", InterfaceType::PUBLICATION);
     ASSERT_NE(p1, nullptr);
 }
+
+TEST(handleManager, frozenIndex)
+{
+    auto h1 = generateExampleHandleManager();
+    h1.addAlias("p1", "pub1");
+    h1.freezeSearchIndex();
+
+    const auto* p1 = h1.getInterfaceHandle("pub1", InterfaceType::PUBLICATION);
+    ASSERT_NE(p1, nullptr);
+    EXPECT_EQ(p1->key, "p1");
+    EXPECT_NE(h1.getInterfaceHandle("t2", InterfaceType::TRANSLATOR), nullptr);
+    EXPECT_EQ(h1.getInterfaceHandle("p3", InterfaceType::PUBLICATION), nullptr);
+
+    // interfaces and aliases added after freezing are still found
+    h1.addHandle(fed3, InterfaceType::PUBLICATION, "p3", "double", "V");
+    h1.addAlias("p3", "pub3");
+    h1.addAlias("in1", "input1");
+    EXPECT_NE(h1.getInterfaceHandle("pub3", InterfaceType::PUBLICATION), nullptr);
+    EXPECT_NE(h1.getInterfaceHandle("input1", InterfaceType::INPUT), nullptr);
+    EXPECT_THROW(h1.addHandle(fed3, InterfaceType::PUBLICATION, "p2", "double", "V"),
+                 std::runtime_error);
+
+    auto matches = h1.regexSearch("REGEX:p.*", InterfaceType::PUBLICATION);
+    EXPECT_EQ(matches.size(), 5U);
+
+    h1.removeHandle(h1.getInterfaceHandle("e1", InterfaceType::ENDPOINT)->handle);
+    EXPECT_EQ(h1.getInterfaceHandle("e1", InterfaceType::ENDPOINT), nullptr);
+    EXPECT_NE(h1.getInterfaceHandle("e2", InterfaceType::ENDPOINT), nullptr);
+
+    // freezing again merges the overlay into the tables
+    h1.freezeSearchIndex();
+    EXPECT_NE(h1.getInterfaceHandle("pub3", InterfaceType::PUBLICATION), nullptr);
+    EXPECT_EQ(h1.getInterfaceHandle("e1", InterfaceType::ENDPOINT), nullptr);
+}
+
+TEST(handleManager, frozenIndexLarge)
+{
+    HandleManager h1;
+    const int count = static_cast<int>(InterfaceNameIndex::parallelBuildThreshold) + 1000;
+    for (int ii = 0; ii < count; ++ii) {
+        h1.addHandle(fed2, InterfaceType::INPUT, "input" + std::to_string(ii), "double", "V");
+    }
+    h1.freezeSearchIndex();
+    for (int ii = 0; ii < count; ii += 97) {
+        const auto* input =
+            h1.getInterfaceHandle("input" + std::to_string(ii), InterfaceType::INPUT);
+        ASSERT_NE(input, nullptr);
+        EXPECT_EQ(input->getInterfaceHandle(), InterfaceHandle(ii));
+    }
+    EXPECT_EQ(h1.getInterfaceHandle("input", InterfaceType::INPUT), nullptr);
+}
@@ -0,0 +1,134 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/MessagePool.hpp"
+
+#include "gtest/gtest.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace helics;
+
+TEST(messagePool, reuse)
+{
+    MessagePool pool(4);
+    EXPECT_EQ(pool.capacity(), 4U);
+    EXPECT_EQ(pool.size(), 0U);
+
+    auto message = pool.acquire();
+    ASSERT_TRUE(message);
+    message->dest = std::string(100, 'd');
+    message->source = "source";
+    message->data = "payload";
+    message->messageID = 10;
+    message->backReference = &pool;
+    auto* original = message.get();
+    const auto* destStorage = message->dest.data();
+    pool.release(std::move(message));
+    EXPECT_EQ(pool.size(), 1U);
+
+    auto reused = pool.acquire();
+    EXPECT_EQ(reused.get(), original);
+    EXPECT_TRUE(reused->dest.empty());
+    EXPECT_TRUE(reused->source.empty());
+    EXPECT_TRUE(reused->data.empty());
+    EXPECT_EQ(reused->messageID, 0);
+    EXPECT_EQ(reused->backReference, nullptr);
+    // the string memory is retained
+    reused->dest = "fed/endpoint";
+    EXPECT_EQ(reused->dest.data(), destStorage);
+    EXPECT_EQ(pool.size(), 0U);
+}
+
+TEST(messagePool, limit)
+{
+    MessagePool pool(2);
+    for (int ii = 0; ii < 5; ++ii) {
+        pool.release(std::make_unique<Message>());
+    }
+    pool.release(nullptr);
+    EXPECT_EQ(pool.size(), 2U);
+
+    auto large = std::make_unique<Message>();
+    large->data.resize(MessagePool::maxRetainedDataSize * 2);
+    pool.clear();
+    pool.release(std::move(large));
+    auto reused = pool.acquire();
+    EXPECT_LE(reused->data.capacity(), MessagePool::maxRetainedDataSize);
+}
+
+TEST(messagePool, command_conversion)
+{
+    MessagePool pool;
+    ActionMessage cmd(CMD_SEND_MESSAGE);
+    cmd.payload = "message data";
+    cmd.setStringData("dest", "source");
+    cmd.actionTime = 2.5;
+
+    auto recycled = pool.acquire();
+    recycled->original_dest = "stale";
+    auto message = createMessageFromCommand(std::move(cmd), std::move(recycled));
+    EXPECT_EQ(message->dest, "dest");
+    EXPECT_EQ(message->source, "source");
+    EXPECT_TRUE(message->original_dest.empty());
+    EXPECT_EQ(message->to_string(), "message data");
+    EXPECT_EQ(message->time, 2.5);
+
+    ActionMessage back(std::move(*message));
+    pool.release(std::move(message));
+    EXPECT_EQ(back.getString(0), "dest");
+    EXPECT_EQ(back.getString(1), "source");
+    EXPECT_EQ(back.payload.to_string(), "message data");
+    EXPECT_EQ(pool.size(), 1U);
+}
+
+TEST(messagePool, recycled_data_capacity)
+{
+    MessagePool pool;
+    auto first = pool.acquire();
+    first->data.resize(4000);
+    const auto* recycledData = first->data.data();
+    pool.release(std::move(first));
+
+    // the payload is copied into the buffer the recycled message already has
+    ActionMessage cmd(CMD_SEND_MESSAGE);
+    cmd.payload = std::string(3000, 'p');
+    auto message = createMessageFromCommand(std::move(cmd), pool.acquire());
+    EXPECT_EQ(message->data.data(), recycledData);
+    EXPECT_EQ(message->to_string(), std::string(3000, 'p'));
+
+    // a payload too large for the recycled buffer is moved
+    ActionMessage large(CMD_SEND_MESSAGE);
+    large.payload = std::string(8000, 'q');
+    const auto* largeData = large.payload.data();
+    pool.release(std::move(message));
+    message = createMessageFromCommand(std::move(large), pool.acquire());
+    EXPECT_EQ(message->data.data(), largeData);
+    EXPECT_EQ(message->data.size(), 8000U);
+}
+
+TEST(messagePool, threads)
+{
+    MessagePool pool(16);
+    std::vector<std::thread> threads;
+    for (int tt = 0; tt < 4; ++tt) {
+        threads.emplace_back([&pool]() {
+            for (int ii = 0; ii < 2000; ++ii) {
+                auto message = pool.acquire();
+                message->dest = "destination";
+                pool.release(std::move(message));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_LE(pool.size(), 16U);
+}
@@ -95,3 +95,68 @@ TEST(timeDep_tests, equal_time_iteration_state_precedence)
     EXPECT_EQ(generateState(TimeState::time_requested, TimeState::time_granted),
               TimeState::time_granted);
 }
+
+TEST(timeDep_tests, indexed_minimum_updates)
+{
+    TimeDependencies timeDependencies;
+    for (int ii = 1; ii <= 9; ++ii) {
+        const GlobalFederateId fed{ii};
+        timeDependencies.addDependency(fed);
+        auto* dep = timeDependencies.getDependencyInfo(fed);
+        dep->connection = ConnectionType::CHILD;
+        dep->mTimeState = TimeState::time_requested;
+        dep->next = static_cast<double>(ii + 1);
+        dep->Te = static_cast<double>(ii + 2);
+        dep->minDe = dep->Te;
+    }
+    // generate the result without the index by ignoring an unrelated federate
+    auto scanTotal = [&timeDependencies]() {
+        return generateMinTimeTotal(
+            timeDependencies, true, GlobalFederateId{}, GlobalFederateId{100}, 0);
+    };
+    auto mTime = generateMinTimeTotal(
+        timeDependencies, true, GlobalFederateId{}, GlobalFederateId{}, 0);
+    EXPECT_EQ(mTime.next, 2.0);
+    EXPECT_EQ(mTime.Te, 3.0);
+    EXPECT_EQ(mTime.minFed, GlobalFederateId{1});
+    EXPECT_TRUE(timeDependencies.checkIfReadyForTimeGrant(false, 2.0, GrantDelayMode::NONE));
+    EXPECT_FALSE(timeDependencies.checkIfReadyForTimeGrant(false, 3.0, GrantDelayMode::NONE));
+
+    // a timing message updates a single dependency
+    ActionMessage request(CMD_TIME_REQUEST, GlobalFederateId{7}, GlobalFederateId{});
+    request.actionTime = 1.0;
+    request.Te = 1.5;
+    request.Tdemin = 1.5;
+    timeDependencies.updateTime(request);
+    mTime = generateMinTimeTotal(timeDependencies, true, GlobalFederateId{}, GlobalFederateId{}, 0);
+    auto scanned = scanTotal();
+    EXPECT_EQ(mTime.next, 1.0);
+    EXPECT_EQ(mTime.Te, 1.5);
+    EXPECT_EQ(mTime.minFed, GlobalFederateId{7});
+    EXPECT_EQ(mTime.next, scanned.next);
+    EXPECT_EQ(mTime.Te, scanned.Te);
+    EXPECT_EQ(mTime.TeAlt, scanned.TeAlt);
+    EXPECT_EQ(mTime.minDe, scanned.minDe);
+    EXPECT_FALSE(timeDependencies.checkIfReadyForTimeGrant(false, 2.0, GrantDelayMode::NONE));
+
+    // dependencies at the same time and event clear the minimum federate
+    timeDependencies.getDependencyInfo(GlobalFederateId{2})->Te = 1.5;
+    timeDependencies.getDependencyInfo(GlobalFederateId{2})->next = 1.0;
+    mTime = generateMinTimeTotal(timeDependencies, true, GlobalFederateId{}, GlobalFederateId{}, 0);
+    EXPECT_FALSE(mTime.minFed.isValid());
+    EXPECT_EQ(mTime.TeAlt, 1.5);
+
+    // the federate reported as the actual minimum is excluded
+    timeDependencies.getDependencyInfo(GlobalFederateId{2})->minFedActual = GlobalFederateId{20};
+    mTime = generateMinTimeTotal(
+        timeDependencies, true, GlobalFederateId{20}, GlobalFederateId{}, 0);
+    EXPECT_EQ(mTime.minFed, GlobalFederateId{7});
+
+    // removing a dependency rebuilds the index
+    timeDependencies.removeDependency(GlobalFederateId{7});
+    timeDependencies.removeDependency(GlobalFederateId{2});
+    mTime = generateMinTimeTotal(timeDependencies, true, GlobalFederateId{}, GlobalFederateId{}, 0);
+    EXPECT_EQ(mTime.next, 2.0);
+    EXPECT_EQ(mTime.minFed, GlobalFederateId{1});
+    EXPECT_TRUE(timeDependencies.checkIfReadyForTimeGrant(false, 2.0, GrantDelayMode::NONE));
+}
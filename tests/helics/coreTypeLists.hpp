@@ -53,6 +53,15 @@ SPDX-License-Identifier: BSD-3-Clause
 #    define IPCTEST2
 #endif
 
+#ifdef HELICS_ENABLE_SHM_CORE
+#    define SHMTEST "shm",
+#    define SHMTEST2 "shm_2",
+
+#else
+#    define SHMTEST
+#    define SHMTEST2
+#endif
+
 #ifdef HELICS_ENABLE_UDP_CORE
 #    define UDPTEST "udp",
 #    define UDPTEST2 "udp_2",
@@ -87,11 +96,11 @@ constexpr const char* ztypes[] = {ZMQTEST ZMQSSTEST ZMQTEST2 ZMQTEST3 ZMQSSTEST2
 constexpr const char* CoreTypes[] =
     {"test", ZMQTEST3 IPCTEST2 TCPTEST INPROCTEST2 ZMQTEST UDPTEST TCPSSTEST ZMQSSTEST ZMQTEST2};
 
-constexpr const char* CoreTypes_2[] = {IPCTEST2 TCPTEST2 ZMQSSTEST2 "test_2",
+constexpr const char* CoreTypes_2[] = {IPCTEST2 SHMTEST2 TCPTEST2 ZMQSSTEST2 "test_2",
                                        TCPSSTEST2 ZMQTEST2 UDPTEST2};
 
 constexpr const char* CoreTypes_simple[] = {
-    INPROCTEST TCPSSTEST ZMQSSTEST IPCTEST TCPTEST ZMQTEST UDPTEST};
+    INPROCTEST TCPSSTEST ZMQSSTEST IPCTEST SHMTEST TCPTEST ZMQTEST UDPTEST};
 constexpr const char* CoreTypes_ci[] = {"test", ZMQTEST IPCTEST TCPTEST};
 constexpr const char* CoreTypes_ci_A[] = {"test", IPCTEST2 TCPTEST ZMQTEST ZMQSSTEST};
 constexpr const char* CoreTypes_ci_B[] = {ZMQTEST3 INPROCTEST2 UDPTEST TCPSSTEST ZMQTEST2};
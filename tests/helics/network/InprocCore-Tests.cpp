@@ -1,5 +1,5 @@
 /*
-Copyright (c) 2017-2020,
+Copyright (c) 2017-2026,
 Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
 Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
 SPDX-License-Identifier: BSD-3-Clause
@@ -8,9 +8,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/Core.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/core/CoreFederateInfo.hpp"
+#include "helics/core/CoreTypes.hpp"
 #include "helics/core/core-exceptions.hpp"
-#include "helics/core/core-types.hpp"
-#include "helics/core/inproc/InprocCore.h"
+#include "helics/network/inproc/InprocCore.h"
 
 #include "gtest/gtest.h"
 #include <memory>
@@ -86,7 +86,7 @@ TEST(InprocCore_tests, pubsub_value_test)
     EXPECT_EQ(core->getFederateName(id), "sim1");
     EXPECT_TRUE(core->getFederateId("sim1") == id);
 
-    core->setTimeProperty(id, helics_property_time_delta, 1.0);
+    core->setTimeProperty(id, HELICS_PROPERTY_TIME_DELTA, 1.0);
 
     auto sub1 = core->registerInput(id, "", "type", "units");
     core->addSourceTarget(sub1, "sim1_pub");
@@ -139,6 +139,47 @@ TEST(InprocCore_tests, pubsub_value_test)
     helics::CoreFactory::cleanUpCores();
 }
 
+TEST(InprocCore_tests, direct_dispatch_value_test)
+{
+    auto broker = helics::BrokerFactory::create(helics::CoreType::INPROC, "--direct_dispatch");
+    ASSERT_TRUE(broker);
+    EXPECT_TRUE(broker->isConnected());
+    std::string configureString =
+        std::string("-f 1 --direct_dispatch --broker=") + broker->getIdentifier();
+    auto core = create(helics::CoreType::INPROC, configureString);
+    ASSERT_TRUE(core);
+    core->connect();
+    ASSERT_TRUE(core->isConnected());
+
+    auto id = core->registerFederate("sim1", helics::CoreFederateInfo());
+    core->setTimeProperty(id, HELICS_PROPERTY_TIME_DELTA, 1.0);
+    auto sub1 = core->registerInput(id, "", "type", "units");
+    core->addSourceTarget(sub1, "sim1_pub");
+    auto pub1 = core->registerPublication(id, "sim1_pub", "type", "units");
+
+    core->enterInitializingMode(id);
+    core->enterExecutingMode(id);
+
+    std::string str1 = "hello world";
+    for (int ii = 1; ii <= 10; ++ii) {
+        auto value = str1 + std::to_string(ii);
+        core->setValue(pub1, value.data(), value.size());
+        core->timeRequest(id, 50.0 * ii);
+        auto valueUpdates = core->getValueUpdates(id);
+        ASSERT_EQ(valueUpdates.size(), 1U);
+        EXPECT_EQ(core->getValue(sub1)->to_string(), value);
+    }
+    core->finalize(id);
+    core->disconnect();
+    broker->disconnect();
+    EXPECT_FALSE(core->isConnected());
+    EXPECT_FALSE(broker->isConnected());
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores();
+    helics::BrokerFactory::cleanUpBrokers();
+}
+
 TEST(InprocCore_tests, send_receive_test)
 {
     const char* initializationString =
@@ -156,7 +197,7 @@ TEST(InprocCore_tests, send_receive_test)
     EXPECT_EQ(core->getFederateName(id), "sim1");
     EXPECT_TRUE(core->getFederateId("sim1") == id);
 
-    core->setTimeProperty(id, helics_property_time_delta, 1.0);
+    core->setTimeProperty(id, HELICS_PROPERTY_TIME_DELTA, 1.0);
 
     auto end1 = core->registerEndpoint(id, "end1", "type");
     EXPECT_EQ(core->getInjectionType(end1), "type");
@@ -170,7 +211,7 @@ TEST(InprocCore_tests, send_receive_test)
 
     std::string str1 = "hello world";
     core->timeRequest(id, 50.0);
-    core->send(end1, "end2", str1.data(), str1.size());
+    core->sendTo(end1, str1.data(), str1.size(), "end2");
 
     core->timeRequest(id, 100.0);
     EXPECT_EQ(core->receiveCount(end1), 0);
@@ -199,7 +240,7 @@ TEST(InprocCore_tests, messagefilter_callback_test)
             msg->source = filterName;
 
             if (!msg->data.empty()) {
-                ++msg->data[0];
+                msg->data[0] = std::byte(std::to_integer<int>(msg->data[0]) + 1);
             }
             return msg;
         }
@@ -237,7 +278,7 @@ TEST(InprocCore_tests, messagefilter_callback_test)
     core->enterExecutingMode(id);
 
     std::string msgData = "hello world";
-    core->send(end1, "end2", msgData.data(), msgData.size() + 1);
+    core->sendTo(end1, msgData.data(), msgData.size() + 1, "end2");
 
     core->timeRequest(id, 50.0);
 
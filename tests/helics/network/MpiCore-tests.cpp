@@ -1,10 +1,103 @@
 /*
-Copyright (c) 2017-2018,
+Copyright (c) 2017-2026,
 Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
-Innovation LLC. All rights reserved. See LICENSE file and DISCLAIMER for more details.
+Innovation LLC. See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
 */
+#include "helics/core/ActionMessage.hpp"
 #include "helics/helics-config.h"
+#include "helics/network/mpi/MpiComms.h"
+#include "helics/network/mpi/MpiService.h"
 
 #include "gtest/gtest.h"
+#include <mpi.h>
+#include <string>
+#include <vector>
+
+using helics::mpi::MpiComms;
+using helics::mpi::MpiService;
+
+namespace {
+/** get the MPI service for a single rank without the service thread so each test drives the
+progress itself*/
+MpiService& singleRankService()
+{
+    MpiService::setStartServiceThread(false);
+    return MpiService::getInstance();
+}
+
+/** collect the messages waiting in the receive queue of a comms object*/
+std::vector<helics::ActionMessage> receivedMessages(MpiComms& comm)
+{
+    std::vector<helics::ActionMessage> messages;
+    auto message = comm.getRxMessageQueue().try_pop();
+    while (message) {
+        messages.push_back(std::move(*message));
+        message = comm.getRxMessageQueue().try_pop();
+    }
+    return messages;
+}
+}  // namespace
 
 TEST(MpiCore_tests, init_test) {}
+
+TEST(MpiCore_tests, batched_receive_single_rank)
+{
+    auto& service = singleRankService();
+    const int rank = service.getRank();
+    ASSERT_GE(rank, 0);
+    MpiComms comm;
+    const int tag = service.getTag(&comm);
+    ASSERT_GE(tag, 0);
+
+    // a batch as the service sends it to another rank, sent to this rank over MPI
+    std::string batch;
+    for (int ii = 0; ii < 50; ++ii) {
+        helics::ActionMessage message(helics::CMD_PUB);
+        message.counter = static_cast<uint16_t>(ii);
+        message.payload = std::string(ii * 10, 'a');
+        message.appendPacket(batch);
+    }
+    MPI_Request request{MPI_REQUEST_NULL};
+    MPI_Isend(batch.data(),
+              static_cast<int>(batch.size()),
+              MPI_CHAR,
+              rank,
+              tag,
+              MpiService::getMpiCommunicator(),
+              &request);
+
+    std::vector<helics::ActionMessage> messages;
+    for (int ii = 0; ii < 100 && messages.size() < 50U; ++ii) {
+        service.sendAndReceiveMessages();
+        auto received = receivedMessages(comm);
+        messages.insert(messages.end(), received.begin(), received.end());
+    }
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    ASSERT_EQ(messages.size(), 50U);
+    for (int ii = 0; ii < 50; ++ii) {
+        EXPECT_EQ(messages[ii].counter, ii);
+        EXPECT_EQ(messages[ii].payload.size(), static_cast<std::size_t>(ii * 10));
+    }
+    service.removeMpiComms(&comm);
+}
+
+TEST(MpiCore_tests, progress_without_service_thread)
+{
+    auto& service = singleRankService();
+    MpiComms comm;
+    const std::pair<int, int> address{service.getRank(), service.getTag(&comm)};
+    for (int ii = 0; ii < 20; ++ii) {
+        helics::ActionMessage message(helics::CMD_PUB);
+        message.counter = static_cast<uint16_t>(ii);
+        service.sendMessage(address, message);
+    }
+    // nothing moves the queued messages until progress is made
+    EXPECT_TRUE(receivedMessages(comm).empty());
+    EXPECT_TRUE(service.tryProgress());
+    auto messages = receivedMessages(comm);
+    ASSERT_EQ(messages.size(), 20U);
+    EXPECT_EQ(messages.front().counter, 0);
+    EXPECT_EQ(messages.back().counter, 19);
+    service.removeMpiComms(&comm);
+}
@@ -0,0 +1,211 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Energy
+Innovation LLC.  See the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/common/GuardedTypes.hpp"
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreBroker.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/CoreTypes.hpp"
+#include "helics/network/shm/ShmComms.h"
+#include "helics/network/shm/ShmCore.h"
+#include "helics/network/shm/ShmMailbox.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals::chrono_literals;
+
+TEST(SHMCore, mailbox_order)
+{
+    helics::shm::OwnedMailbox rx;
+    ASSERT_TRUE(rx.connect("shmMailbox", 4, 4096));
+
+    constexpr int messageCount{5000};
+    std::vector<std::thread> senders;
+    for (int ii = 0; ii < 3; ++ii) {
+        senders.emplace_back([ii]() {
+            helics::shm::SendToMailbox tx;
+            ASSERT_TRUE(tx.connect("shmMailbox", false, 2));
+            for (int jj = 0; jj < messageCount; ++jj) {
+                helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+                cmd.messageID = jj;
+                cmd.counter = static_cast<std::uint16_t>(ii);
+                if (jj % 1000 == 0) {
+                    // bigger than the ring so it has to go in pieces
+                    cmd.payload = std::string(20000, static_cast<char>('a' + ii));
+                }
+                EXPECT_TRUE(tx.sendMessage(cmd));
+            }
+        });
+    }
+    std::vector<int> next(3, 0);
+    for (int ii = 0; ii < 3 * messageCount; ++ii) {
+        auto cmd = rx.getMessage(2000);
+        ASSERT_TRUE(cmd);
+        const auto sender = static_cast<int>(cmd->counter);
+        ASSERT_LT(sender, 3);
+        EXPECT_EQ(cmd->messageID, next[sender]);
+        if (cmd->messageID % 1000 == 0) {
+            EXPECT_EQ(cmd->payload.size(), 20000U);
+        }
+        next[sender] = cmd->messageID + 1;
+    }
+    for (auto& sender : senders) {
+        sender.join();
+    }
+    EXPECT_FALSE(rx.getMessage(0));
+}
+
+TEST(SHMCore, mailbox_slots_recycled)
+{
+    helics::shm::OwnedMailbox rx;
+    ASSERT_TRUE(rx.connect("shmMailbox2", 1, 4096));
+    {
+        helics::shm::SendToMailbox tx;
+        ASSERT_TRUE(tx.connect("shmMailbox2", false, 0));
+        helics::shm::SendToMailbox tx2;
+        EXPECT_FALSE(tx2.connect("shmMailbox2", false, 0));
+        EXPECT_TRUE(tx.sendMessage(helics::CMD_IGNORE));
+    }
+    auto cmd = rx.getMessage(1000);
+    ASSERT_TRUE(cmd);
+    EXPECT_EQ(cmd->action(), helics::CMD_IGNORE);
+    // reading the mailbox frees the slot of the closed sender
+    EXPECT_FALSE(rx.getMessage(0));
+    helics::shm::SendToMailbox tx3;
+    EXPECT_TRUE(tx3.connect("shmMailbox2", false, 0));
+}
+
+TEST(SHMCore, mailbox_allocation_failure)
+{
+    helics::shm::OwnedMailbox rx;
+    // far more than any shared memory filesystem has room for
+    EXPECT_FALSE(rx.connect("shmMailboxHuge", 4, std::size_t{1} << 42U));
+    EXPECT_FALSE(rx.getError().empty());
+    helics::shm::SendToMailbox tx;
+    EXPECT_FALSE(tx.connect("shmMailboxHuge", false, 0));
+}
+
+TEST(SHMCore, shmcomms_broker)
+{
+    std::string brokerLoc = "brokerSHM";
+    std::string localLoc = "localSHM";
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+
+    helics::shm::OwnedMailbox mq;
+    ASSERT_TRUE(mq.connect(brokerLoc, 16, 4096));
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+
+    bool connected = comm.connect();
+    ASSERT_TRUE(connected);
+    comm.transmit(helics::parent_route_id, helics::CMD_IGNORE);
+
+    helics::ActionMessage rM = mq.getMessage();
+    EXPECT_TRUE(rM.action() == helics::action_message_def::action_t::cmd_ignore);
+    comm.disconnect();
+}
+
+TEST(SHMCore, shmComm_transmit_add_route)
+{
+    std::string brokerLoc = "brokerSHM";
+    std::string localLoc = "localSHM";
+    std::string localLocB = "localSHM2";
+
+    std::atomic<int> counter{0};
+    std::atomic<int> counter2{0};
+    std::atomic<int> counter3{0};
+    guarded<helics::ActionMessage> act;
+    guarded<helics::ActionMessage> act2;
+    guarded<helics::ActionMessage> act3;
+
+    helics::shm::ShmComms comm;
+    helics::shm::ShmComms comm2;
+    helics::shm::ShmComms comm3;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+    comm2.loadTargetInfo(brokerLoc, std::string());
+    comm3.loadTargetInfo(localLocB, brokerLoc);
+
+    comm.setCallback([&counter, &act](const helics::ActionMessage& m) {
+        ++counter;
+        act = m;
+    });
+    comm2.setCallback([&counter2, &act2](const helics::ActionMessage& m) {
+        ++counter2;
+        act2 = m;
+    });
+    comm3.setCallback([&counter3, &act3](const helics::ActionMessage& m) {
+        ++counter3;
+        act3 = m;
+    });
+
+    ASSERT_TRUE(comm2.connect());
+    ASSERT_TRUE(comm.connect());
+    ASSERT_TRUE(comm3.connect());
+
+    comm.transmit(helics::parent_route_id, helics::CMD_ACK);
+    comm3.transmit(helics::parent_route_id, helics::CMD_ACK);
+    int cnt{0};
+    while (counter2 < 2 && cnt++ < 20) {
+        std::this_thread::sleep_for(50ms);
+    }
+    ASSERT_EQ(counter2, 2);
+    EXPECT_TRUE(act2.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm2.addRoute(helics::route_id(3), localLocB);
+    comm2.transmit(helics::route_id(3), helics::CMD_ACK);
+    comm2.addRoute(helics::route_id(4), localLoc);
+    comm2.transmit(helics::route_id(4), helics::CMD_ACK);
+    cnt = 0;
+    while ((counter3 < 1 || counter < 1) && cnt++ < 20) {
+        std::this_thread::sleep_for(50ms);
+    }
+    ASSERT_EQ(counter3, 1);
+    EXPECT_TRUE(act3.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+    ASSERT_EQ(counter, 1);
+    EXPECT_TRUE(act.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm.disconnect();
+    comm2.disconnect();
+    comm3.disconnect();
+}
+
+/** test case checks default values and makes sure they all mesh together*/
+TEST(SHMCore, shmCore_core_broker_default)
+{
+    std::string initializationString = "-f 1";
+
+    auto broker = helics::BrokerFactory::create(helics::CoreType::SHM, initializationString);
+
+    auto core = helics::CoreFactory::create(helics::CoreType::SHM, initializationString);
+    bool connected = broker->isConnected();
+    EXPECT_TRUE(connected);
+    connected = core->connect();
+    EXPECT_TRUE(connected);
+
+    core->disconnect();
+    broker->disconnect();
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores(100ms);
+    helics::BrokerFactory::cleanUpBrokers(100ms);
+}
+
+TEST(SHMCore, commFactory)
+{
+    auto comm = helics::CommFactory::create("shm");
+    auto comm2 = helics::CommFactory::create(helics::CoreType::SHM);
+
+    EXPECT_TRUE(dynamic_cast<helics::shm::ShmComms*>(comm.get()) != nullptr);
+    EXPECT_TRUE(dynamic_cast<helics::shm::ShmComms*>(comm2.get()) != nullptr);
+}
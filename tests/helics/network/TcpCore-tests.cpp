@@ -7,11 +7,16 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/networking/AsioContextManager.h"
 #include "gmlc/networking/TcpHelperClasses.h"
 #include "helics/common/GuardedTypes.hpp"
+#include "helics/common/JsonProcessingFunctions.hpp"
 #include "helics/core/ActionMessage.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/Core.hpp"
 #include "helics/core/CoreFactory.hpp"
+#include "helics/core/CoreFederateInfo.hpp"
 #include "helics/core/CoreTypes.hpp"
+#include "helics/network/NetworkBrokerData.hpp"
+#include "helics/network/NetworkCompression.hpp"
+#include "helics/network/WarmStartCache.hpp"
 #include "helics/network/networkDefaults.hpp"
 #include "helics/network/tcp/TcpBroker.h"
 #include "helics/network/tcp/TcpComms.h"
@@ -19,6 +24,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <cstdint>
+#include <filesystem>
 #include <future>
 #include <numeric>
 #include <string>
@@ -433,6 +440,204 @@ TEST(TcpCore, tcpComm_transmit_add_route)
     std::this_thread::sleep_for(100ms);
 }
 
+TEST(TcpCore, tcpComm_parallel_send)
+{
+    std::this_thread::sleep_for(300ms);
+    std::atomic<int> counter{0};
+    std::atomic<int> outOfOrder{0};
+
+    std::string host = "localhost";
+    helics::tcp::TcpComms comm;
+    comm.loadTargetInfo(host, host);
+    comm.setFlag("reuse_address", true);
+    comm.setFlag("parallel_send", true);
+    helics::tcp::TcpComms comm2;
+    comm2.loadTargetInfo(host, std::string());
+
+    comm.setBrokerPort(helics::network::DEFAULT_TCP_PORT + 3);
+    comm.setName("tests");
+    comm2.setName("test2");
+    comm2.setPortNumber(helics::network::DEFAULT_TCP_PORT + 3);
+    comm2.setFlag("reuse_address", true);
+    comm.setPortNumber(TCP_SECONDARY_PORT);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+    comm2.setCallback([&counter, &outOfOrder](const helics::ActionMessage& m) {
+        if (m.messageID != counter) {
+            ++outOfOrder;
+        }
+        ++counter;
+    });
+
+    ASSERT_TRUE(comm2.connect());
+    bool connected = comm.connect();
+    if (!connected) {  // lets just try again if it is not connected
+        connected = comm.connect();
+    }
+    ASSERT_TRUE(connected);
+
+    constexpr int messageCount{2000};
+    for (int ii = 0; ii < messageCount; ++ii) {
+        helics::ActionMessage cmd(helics::CMD_ACK);
+        cmd.messageID = ii;
+        comm.transmit(helics::parent_route_id, cmd);
+    }
+    int cnt{0};
+    while (counter < messageCount && cnt++ < 40) {
+        std::this_thread::sleep_for(50ms);
+    }
+    EXPECT_EQ(counter, messageCount);
+    EXPECT_EQ(outOfOrder, 0);
+
+    comm.disconnect();
+    EXPECT_TRUE(!comm.isConnected());
+
+    comm2.disconnect();
+    EXPECT_TRUE(!comm2.isConnected());
+
+    std::this_thread::sleep_for(100ms);
+}
+
+TEST(TcpCore, tcpComm_compression)
+{
+    if (helics::availableCompressionMask() == 0) {
+        GTEST_SKIP() << "no compression library available";
+    }
+    std::this_thread::sleep_for(300ms);
+    std::atomic<int> counter{0};
+    std::atomic<int> mismatch{0};
+
+    const std::string value(20000, 'a');
+    helics::NetworkBrokerData netInfo;
+    netInfo.compression = helics::compressionAvailable(helics::CompressionType::ZSTD) ?
+        helics::CompressionType::ZSTD :
+        helics::CompressionType::LZ4;
+
+    std::string host = "localhost";
+    helics::tcp::TcpComms comm;
+    comm.loadNetworkInfo(netInfo);
+    comm.loadTargetInfo(host, host);
+    comm.setFlag("reuse_address", true);
+    helics::tcp::TcpComms comm2;
+    comm2.loadTargetInfo(host, std::string());
+
+    comm.setBrokerPort(helics::network::DEFAULT_TCP_PORT + 4);
+    comm.setName("tests");
+    comm2.setName("test2");
+    comm2.setPortNumber(helics::network::DEFAULT_TCP_PORT + 4);
+    comm2.setFlag("reuse_address", true);
+    comm.setPortNumber(TCP_SECONDARY_PORT);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+    comm2.setCallback([&counter, &mismatch, &value](const helics::ActionMessage& m) {
+        if (m.payload.to_string() != value) {
+            ++mismatch;
+        }
+        ++counter;
+    });
+
+    ASSERT_TRUE(comm2.connect());
+    bool connected = comm.connect();
+    if (!connected) {  // lets just try again if it is not connected
+        connected = comm.connect();
+    }
+    ASSERT_TRUE(connected);
+
+    constexpr int messageCount{20};
+    for (int ii = 0; ii < messageCount; ++ii) {
+        helics::ActionMessage cmd(helics::CMD_PUB);
+        cmd.messageID = ii;
+        cmd.payload = value;
+        comm.transmit(helics::parent_route_id, cmd);
+    }
+    int cnt{0};
+    while (counter < messageCount && cnt++ < 40) {
+        std::this_thread::sleep_for(50ms);
+    }
+    EXPECT_EQ(counter, messageCount);
+    EXPECT_EQ(mismatch, 0);
+
+    const auto stats = comm.query("compression");
+    EXPECT_EQ(stats.find("\"frames_compressed\":0,"), std::string::npos);
+    EXPECT_NE(stats.find(std::string("\"parent\":\"") +
+                         std::string(helics::compressionTypeName(netInfo.compression))),
+              std::string::npos);
+    const auto stats2 = comm2.query("compression");
+    EXPECT_EQ(stats2.find("\"frames_decompressed\":0,"), std::string::npos);
+
+    comm.disconnect();
+    EXPECT_TRUE(!comm.isConnected());
+
+    comm2.disconnect();
+    EXPECT_TRUE(!comm2.isConnected());
+
+    std::this_thread::sleep_for(100ms);
+}
+
+TEST(TcpCore, tcpComm_route_compression)
+{
+    if (helics::availableCompressionMask() == 0) {
+        GTEST_SKIP() << "no compression library available";
+    }
+    std::this_thread::sleep_for(300ms);
+    std::atomic<int> counter{0};
+    std::atomic<int> mismatch{0};
+
+    const std::string value(20000, 'a');
+    helics::NetworkBrokerData netInfo;
+    netInfo.compression = helics::compressionAvailable(helics::CompressionType::ZSTD) ?
+        helics::CompressionType::ZSTD :
+        helics::CompressionType::LZ4;
+
+    std::string host = "localhost";
+    helics::tcp::TcpComms comm2;
+    comm2.loadNetworkInfo(netInfo);
+    comm2.loadTargetInfo(host, std::string());
+    comm2.setName("broker");
+    comm2.setFlag("reuse_address", true);
+    comm2.setPortNumber(helics::network::DEFAULT_TCP_PORT + 5);
+    helics::tcp::TcpComms comm3;
+    comm3.loadTargetInfo(host, host);
+    comm3.setName("test3");
+    comm3.setBrokerPort(helics::network::DEFAULT_TCP_PORT + 5);
+    comm3.setFlag("reuse_address", true);
+    comm3.setPortNumber(23921);
+
+    comm2.setCallback([](const helics::ActionMessage& /*m*/) {});
+    comm3.setCallback([&counter, &mismatch, &value](const helics::ActionMessage& m) {
+        if (m.payload.to_string() != value) {
+            ++mismatch;
+        }
+        ++counter;
+    });
+
+    ASSERT_TRUE(comm2.connect());
+    ASSERT_TRUE(comm3.connect());
+
+    // the route is compressed once the child replies that it supports the compression
+    comm2.addRoute(helics::route_id(3), comm3.getAddress());
+    std::this_thread::sleep_for(250ms);
+    constexpr int messageCount{20};
+    for (int ii = 0; ii < messageCount; ++ii) {
+        helics::ActionMessage cmd(helics::CMD_PUB);
+        cmd.messageID = ii;
+        cmd.payload = value;
+        comm2.transmit(helics::route_id(3), cmd);
+    }
+    int cnt{0};
+    while (counter < messageCount && cnt++ < 40) {
+        std::this_thread::sleep_for(50ms);
+    }
+    EXPECT_EQ(counter, messageCount);
+    EXPECT_EQ(mismatch, 0);
+    const auto stats3 = comm3.query("compression");
+    EXPECT_EQ(stats3.find("\"frames_decompressed\":0,"), std::string::npos);
+
+    comm3.disconnect();
+    comm2.disconnect();
+    std::this_thread::sleep_for(100ms);
+}
+
 TEST(TcpCore, tcpCore_initialization)
 {
     std::this_thread::sleep_for(300ms);
@@ -523,6 +728,72 @@ TEST(TcpCore, tcpCore_core_broker_default)
     helics::BrokerFactory::cleanUpBrokers(100ms);
 }
 
+TEST(TcpCore, tcpCore_warm_start)
+{
+    std::this_thread::sleep_for(300ms);
+    const auto cacheFile =
+        (std::filesystem::temp_directory_path() / "helics_tcp_warm_start.json").string();
+    std::filesystem::remove(cacheFile);
+    const std::string initializationString =
+        "--reuse_address --warm_start_cache=" + cacheFile + " --federation_key=fed_ws";
+
+    auto broker = helics::BrokerFactory::create(helics::CoreType::TCP, initializationString);
+    ASSERT_TRUE(broker);
+    auto core = helics::CoreFactory::create(helics::CoreType::TCP,
+                                            initializationString + " --name=wscore");
+    ASSERT_TRUE(core);
+    EXPECT_TRUE(core->connect());
+    const auto address = core->getAddress();
+    auto coreId = [&core]() {
+        auto logs = helics::fileops::loadJsonStr(
+            core->query("core", "logs", HELICS_SEQUENCING_MODE_ORDERED));
+        return logs["attributes"]["id"].get<std::int32_t>();
+    };
+    core->registerFederate("wsfed", helics::CoreFederateInfo());
+    const auto firstId = coreId();
+
+    core->disconnect();
+    broker->disconnect();
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores(100ms);
+    helics::BrokerFactory::cleanUpBrokers(100ms);
+    ASSERT_TRUE(std::filesystem::exists(cacheFile));
+    helics::WarmStartCache cache;
+    ASSERT_TRUE(cache.load(cacheFile, "fed_ws"));
+    ASSERT_TRUE(cache.find("wscore"));
+    EXPECT_EQ(cache.find("wscore")->id, firstId);
+    EXPECT_GE(cache.compressionMask(), 0);
+
+    // the second time the core gets its port and id from the cache and registers the federate
+    // along with the core
+    broker = helics::BrokerFactory::create(helics::CoreType::TCP, initializationString);
+    ASSERT_TRUE(broker);
+    core = helics::CoreFactory::create(helics::CoreType::TCP,
+                                       initializationString + " --name=wscore");
+    ASSERT_TRUE(core);
+    EXPECT_TRUE(core->connect());
+    EXPECT_EQ(core->getAddress(), address);
+    core->registerFederate("wsfed", helics::CoreFederateInfo());
+    EXPECT_EQ(coreId(), firstId);
+    // a core not in the cache still negotiates a port different from the cached one
+    auto core2 = helics::CoreFactory::create(helics::CoreType::TCP,
+                                             initializationString + " --name=wscore2");
+    ASSERT_TRUE(core2);
+    EXPECT_TRUE(core2->connect());
+    EXPECT_NE(core2->getAddress(), address);
+
+    core2->disconnect();
+    core->disconnect();
+    broker->disconnect();
+    core2 = nullptr;
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores(100ms);
+    helics::BrokerFactory::cleanUpBrokers(100ms);
+    std::filesystem::remove(cacheFile);
+}
+
 TEST(TcpCore, commFactory)
 {
     auto comm = helics::CommFactory::create("tcp");
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/Core.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/core/CoreTypes.hpp"
+#include "helics/network/CommsEventLoop.hpp"
 #include "helics/network/networkDefaults.hpp"
 #include "helics/network/tcp/TcpBroker.h"
 #include "helics/network/tcp/TcpCommsSS.h"
@@ -19,6 +20,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <numeric>
 #include <string>
@@ -251,6 +253,105 @@ TEST(TcpSSCore, tcpSSComm_transmit_through)
     std::this_thread::sleep_for(100ms);
 }
 
+TEST(TcpSSCore, event_task_trigger_during_run)
+{
+    auto loop = std::make_shared<helics::CommsEventLoop>(2);
+    std::atomic<int> runs{0};
+    std::promise<void> firstRunStarted;
+    std::promise<void> releaseFirstRun;
+    auto release = releaseFirstRun.get_future().share();
+    helics::CommsEventTask task(loop, [&runs, &firstRunStarted, release]() {
+        if (++runs == 1) {
+            firstRunStarted.set_value();
+            release.wait();
+        }
+    });
+    task.trigger();
+    firstRunStarted.get_future().wait();
+    // triggers during the run are merged into a single rerun on the same thread
+    for (int ii = 0; ii < 10; ++ii) {
+        task.trigger();
+    }
+    // so the other thread of the loop is still free for other work
+    std::promise<void> otherWork;
+    auto otherDone = otherWork.get_future();
+    loop->post([&otherWork]() { otherWork.set_value(); });
+    EXPECT_EQ(otherDone.wait_for(2s), std::future_status::ready);
+    EXPECT_EQ(runs, 1);
+
+    releaseFirstRun.set_value();
+    int cnt{0};
+    while (task.statistics().runs < 2 && cnt++ < 40) {
+        std::this_thread::sleep_for(50ms);
+    }
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(runs, 2);
+    EXPECT_EQ(task.statistics().runs, 2U);
+    task.cancel();
+}
+
+TEST(TcpSSCore, tcpSSComm_event_loop_transmit_through)
+{
+    std::this_thread::sleep_for(400ms);
+    std::atomic<int> counter{0};
+    std::atomic<int> counter2{0};
+    guarded<helics::ActionMessage> act2;
+    auto srv = AsioContextManager::getContextPointer();
+    auto contextLoop = srv->startContextLoop();
+
+    std::string host = "localhost";
+    helics::tcp::TcpCommsSS comm;
+    helics::tcp::TcpCommsSS comm2;
+    comm.loadTargetInfo(host, host);
+    // comm2 is the broker
+    comm2.loadTargetInfo(host, std::string());
+
+    comm.setBrokerPort(helics::network::DEFAULT_TCPSS_PORT);
+    comm.setName("tests");
+    comm.setServerMode(false);
+    comm.setFlag("event_loop", true);
+    comm2.setName("test2");
+    comm2.setPortNumber(helics::network::DEFAULT_TCPSS_PORT);
+    comm2.setServerMode(true);
+    comm2.setFlag("event_loop", true);
+
+    comm.setCallback([&counter](const helics::ActionMessage& /*m*/) { ++counter; });
+    comm2.setCallback([&counter2, &act2](const helics::ActionMessage& m) {
+        ++counter2;
+        act2 = m;
+    });
+    auto connected_fut = std::async(std::launch::async, [&comm] { return comm.connect(); });
+    bool connected1 = comm2.connect();
+    ASSERT_TRUE(connected1);
+    bool connected2 = connected_fut.get();
+    if (!connected2) {
+        connected2 = comm.connect();
+    }
+    ASSERT_TRUE(connected2);
+
+    for (int ii = 0; ii < 10; ++ii) {
+        comm.transmit(helics::parent_route_id, helics::CMD_ACK);
+    }
+    int cnt = 0;
+    while (counter2 < 10 && cnt < 30) {
+        std::this_thread::sleep_for(50ms);
+        ++cnt;
+    }
+    ASSERT_EQ(counter2, 10);
+    EXPECT_TRUE(act2.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    auto stats = comm.query("event_loop");
+    EXPECT_NE(stats.find("\"runs\""), std::string::npos);
+    EXPECT_NE(stats.find("\"mean_latency_us\""), std::string::npos);
+
+    comm2.disconnect();
+    EXPECT_TRUE(!comm2.isConnected());
+    comm.disconnect();
+    EXPECT_TRUE(!comm.isConnected());
+
+    std::this_thread::sleep_for(100ms);
+}
+
 TEST(TcpSSCore, tcpSSComm_transmit_add_route)
 {
     std::this_thread::sleep_for(500ms);
@@ -14,9 +14,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/network/udp/UdpBroker.h"
 #include "helics/network/udp/UdpComms.h"
 #include "helics/network/udp/UdpCore.h"
+#include "helics/network/udp/UdpReliability.h"
 
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <asio/ip/udp.hpp>
+#include <deque>
 #include <future>
 #include <string>
 #include <thread>
@@ -292,6 +295,207 @@ TEST(UdpCore, udpComm_transmit_add_route)
     std::this_thread::sleep_for(100ms);
 }
 
+TEST(UdpCore, reliable_datagrams_with_loss)
+{
+    helics::udp::ReliableSender sender(17, 200);
+    helics::udp::ReliableReceiver receiver;
+    std::deque<std::string> toReceiver;
+    std::deque<std::string> toSender;
+    std::vector<int> delivered;
+
+    int datagramCount{0};
+    // the injected loss drops every third datagram sent
+    auto lossySend = [&datagramCount, &toReceiver](std::string_view datagram) {
+        if (++datagramCount % 3 != 0) {
+            toReceiver.emplace_back(datagram);
+        }
+    };
+    auto now = std::chrono::steady_clock::now();
+    constexpr int messageCount{500};
+    for (int ii = 0; ii < messageCount; ++ii) {
+        helics::ActionMessage cmd(helics::CMD_PUB);
+        cmd.messageID = ii;
+        sender.addMessage(cmd);
+        if (sender.hasCompleted()) {
+            sender.sendCompleted(now, lossySend);
+        }
+    }
+    sender.flush(now, lossySend);
+    // messages are packed several to a datagram
+    EXPECT_LT(datagramCount, messageCount / 2);
+
+    int ackCount{0};
+    for (int round = 0; round < 50 && sender.outstanding() > 0; ++round) {
+        // deliver in reverse order to check the reordering
+        std::reverse(toReceiver.begin(), toReceiver.end());
+        for (const auto& datagram : toReceiver) {
+            auto ack = receiver.processDatagram(reinterpret_cast<const std::byte*>(datagram.data()),
+                                                datagram.size(),
+                                                [&delivered](helics::ActionMessage&& cmd) {
+                                                    delivered.push_back(cmd.messageID);
+                                                });
+            ASSERT_EQ(ack.size(), helics::udp::reliableAckSize);
+            // drop some of the acknowledgments as well
+            if (++ackCount % 4 != 0) {
+                toSender.push_back(std::move(ack));
+            }
+        }
+        toReceiver.clear();
+        for (const auto& ack : toSender) {
+            EXPECT_TRUE(sender.processAck(
+                reinterpret_cast<const std::byte*>(ack.data()), ack.size(), now, lossySend));
+        }
+        toSender.clear();
+        now += std::chrono::seconds(3);
+        EXPECT_TRUE(sender.retransmit(now, lossySend));
+    }
+    EXPECT_EQ(sender.outstanding(), 0U);
+    ASSERT_EQ(delivered.size(), static_cast<std::size_t>(messageCount));
+    for (int ii = 0; ii < messageCount; ++ii) {
+        EXPECT_EQ(delivered[ii], ii);
+    }
+}
+
+TEST(UdpCore, reliable_datagrams_dropped)
+{
+    helics::udp::ReliableSender sender(5, 1400);
+    sender.setMaxTransmissions(3);
+    int sent{0};
+    auto lostSend = [&sent](std::string_view /*datagram*/) { ++sent; };
+    auto now = std::chrono::steady_clock::now();
+    sender.addMessage(helics::ActionMessage(helics::CMD_ACK));
+    sender.flush(now, lostSend);
+    EXPECT_EQ(sender.outstanding(), 1U);
+    int failures{0};
+    for (int ii = 0; ii < 5; ++ii) {
+        now += std::chrono::seconds(3);
+        if (!sender.retransmit(now, lostSend)) {
+            ++failures;
+        }
+    }
+    EXPECT_EQ(sent, 3);
+    EXPECT_EQ(failures, 1);
+    EXPECT_TRUE(sender.hasFailed());
+    EXPECT_EQ(sender.outstanding(), 0U);
+    // nothing more is sent once the sender has failed
+    sender.addMessage(helics::ActionMessage(helics::CMD_ACK));
+    sender.flush(now, lostSend);
+    EXPECT_EQ(sent, 3);
+    EXPECT_EQ(sender.outstanding(), 0U);
+}
+
+TEST(UdpCore, reliable_datagrams_retry_limit)
+{
+    helics::udp::ReliableSender sender(9, 200);
+    sender.setMaxTransmissions(4);
+    helics::udp::ReliableReceiver receiver;
+    std::deque<std::string> toReceiver;
+    std::vector<int> delivered;
+
+    int datagramCount{0};
+    std::string lostDatagram;
+    // the third datagram and every retransmission of it is lost
+    auto lossySend = [&datagramCount, &lostDatagram, &toReceiver](std::string_view datagram) {
+        if (++datagramCount == 3) {
+            lostDatagram = datagram;
+        }
+        if (datagram != lostDatagram) {
+            toReceiver.emplace_back(datagram);
+        }
+    };
+    auto now = std::chrono::steady_clock::now();
+    constexpr int messageCount{100};
+    for (int ii = 0; ii < messageCount; ++ii) {
+        helics::ActionMessage cmd(helics::CMD_PUB);
+        cmd.messageID = ii;
+        sender.addMessage(cmd);
+        if (sender.hasCompleted()) {
+            sender.sendCompleted(now, lossySend);
+        }
+    }
+    sender.flush(now, lossySend);
+    ASSERT_GT(datagramCount, 3);
+
+    bool failed{false};
+    for (int round = 0; round < 20 && !failed; ++round) {
+        for (const auto& datagram : toReceiver) {
+            auto ack = receiver.processDatagram(reinterpret_cast<const std::byte*>(datagram.data()),
+                                                datagram.size(),
+                                                [&delivered](helics::ActionMessage&& cmd) {
+                                                    delivered.push_back(cmd.messageID);
+                                                });
+            EXPECT_TRUE(sender.processAck(
+                reinterpret_cast<const std::byte*>(ack.data()), ack.size(), now, lossySend));
+        }
+        toReceiver.clear();
+        now += std::chrono::seconds(3);
+        failed = !sender.retransmit(now, lossySend);
+    }
+    // the link fails instead of dropping the datagram and stalling the receiver silently
+    EXPECT_TRUE(failed);
+    EXPECT_TRUE(sender.hasFailed());
+    EXPECT_FALSE(sender.windowFull());
+    EXPECT_EQ(sender.outstanding(), 0U);
+    // only the messages before the lost datagram were delivered, in order
+    ASSERT_FALSE(delivered.empty());
+    EXPECT_LT(delivered.size(), static_cast<std::size_t>(messageCount));
+    for (std::size_t ii = 0; ii < delivered.size(); ++ii) {
+        EXPECT_EQ(delivered[ii], static_cast<int>(ii));
+    }
+}
+
+TEST(UdpCore, udpComm_reliable_transmit)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    std::atomic<int> counter{0};
+    std::atomic<int> outOfOrder{0};
+
+    std::string host = "localhost";
+    helics::udp::UdpComms comm;
+    comm.loadTargetInfo(host, host);
+    comm.setFlag("reliable_udp", true);
+    helics::udp::UdpComms comm2;
+    comm2.loadTargetInfo(host, "");
+
+    comm.setBrokerPort(UDP_BROKER_PORT);
+    comm.setName("tests");
+    comm2.setName("test2");
+    comm2.setPortNumber(UDP_BROKER_PORT);
+    comm.setPortNumber(UDP_SECONDARY_PORT);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+    comm2.setCallback([&counter, &outOfOrder](const helics::ActionMessage& m) {
+        if (m.messageID != counter) {
+            ++outOfOrder;
+        }
+        ++counter;
+    });
+
+    auto connected_fut = std::async(std::launch::async, [&comm] { return comm.connect(); });
+
+    bool connected = comm2.connect();
+    ASSERT_TRUE(connected);
+    connected = connected_fut.get();
+    ASSERT_TRUE(connected);
+
+    constexpr int messageCount{5000};
+    for (int ii = 0; ii < messageCount; ++ii) {
+        helics::ActionMessage cmd(helics::CMD_ACK);
+        cmd.messageID = ii;
+        comm.transmit(helics::parent_route_id, cmd);
+    }
+    int cnt{0};
+    while (counter < messageCount && cnt++ < 40) {
+        std::this_thread::sleep_for(50ms);
+    }
+    EXPECT_EQ(counter, messageCount);
+    EXPECT_EQ(outOfOrder, 0);
+
+    comm.disconnect();
+    comm2.disconnect();
+    std::this_thread::sleep_for(100ms);
+}
+
 TEST(UdpCore, udpCore_initialization)
 {
     std::this_thread::sleep_for(std::chrono::milliseconds(500));
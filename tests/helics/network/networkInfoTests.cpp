@@ -7,8 +7,13 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/networking/addressOperations.hpp"
 #include "helics/core/helicsCLI11.hpp"
 #include "helics/network/NetworkBrokerData.hpp"
+#include "helics/network/WarmStartCache.hpp"
 
 #include "gtest/gtest.h"
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
 
 TEST(networkData_tests, basic_test)
 {
@@ -26,3 +31,71 @@ TEST(networkData_tests, basic_test)
     EXPECT_EQ(bdata.encrypted, true);
     EXPECT_EQ(bdata.encryptionConfig, "openssl.json");
 }
+
+TEST(networkData_tests, warm_start_options)
+{
+    helics::NetworkBrokerData bdata;
+    auto parser = bdata.commandLineParser("local");
+    parser->helics_parse("--warm_start_cache=ports.json --federation_key=fed1");
+    EXPECT_EQ(bdata.warmStartFile, "ports.json");
+    EXPECT_EQ(bdata.federationKey, "fed1");
+}
+
+TEST(networkData_tests, warm_start_cache)
+{
+    const auto cacheFile =
+        (std::filesystem::temp_directory_path() / "helics_warm_start_test.json").string();
+    helics::WarmStartCache cache;
+    EXPECT_TRUE(cache.record("core1", "localhost", 23500, 2));
+    EXPECT_TRUE(cache.record("core2", "192.168.1.4", 23502, 1));
+    EXPECT_FALSE(cache.record("core2", "192.168.1.4", 23502, 1));
+    EXPECT_FALSE(cache.record("", "localhost", 23504, 1));
+    EXPECT_TRUE(cache.recordId("core1", 0x7000'0002));
+    EXPECT_FALSE(cache.recordId("core1", 0x7000'0002));
+    // ids are only recorded for names with ports assigned
+    EXPECT_FALSE(cache.recordId("core3", 0x7000'0003));
+    EXPECT_EQ(cache.compressionMask(), -1);
+    EXPECT_TRUE(cache.setCompressionMask(3));
+    ASSERT_TRUE(cache.save(cacheFile, "fed1"));
+
+    helics::WarmStartCache loaded;
+    ASSERT_TRUE(loaded.load(cacheFile, "fed1"));
+    EXPECT_EQ(loaded.assignments().size(), 2U);
+    const auto assignment = loaded.find("core1");
+    ASSERT_TRUE(assignment);
+    EXPECT_EQ(assignment->host, "localhost");
+    EXPECT_EQ(assignment->port, 23500);
+    EXPECT_EQ(assignment->count, 2);
+    EXPECT_EQ(assignment->id, 0x7000'0002);
+    EXPECT_EQ(loaded.find("core2")->id, 0);
+    EXPECT_EQ(loaded.compressionMask(), 3);
+    EXPECT_FALSE(loaded.find("core3"));
+    // a new port assignment keeps the id of the name
+    EXPECT_TRUE(loaded.record("core1", "localhost", 23510, 2));
+    EXPECT_EQ(loaded.find("core1")->id, 0x7000'0002);
+
+    // a different federation does not use the assignments
+    EXPECT_FALSE(loaded.load(cacheFile, "fed2"));
+    EXPECT_TRUE(loaded.empty());
+    EXPECT_EQ(loaded.compressionMask(), -1);
+    std::filesystem::remove(cacheFile);
+    EXPECT_FALSE(loaded.load(cacheFile, "fed1"));
+}
+
+TEST(networkData_tests, warm_start_cache_concurrent_record)
+{
+    // the assignments are recorded from the receive threads of the comms
+    helics::WarmStartCache cache;
+    std::vector<std::thread> threads;
+    for (int ii = 0; ii < 4; ++ii) {
+        threads.emplace_back([&cache, ii]() {
+            for (int jj = 0; jj < 500; ++jj) {
+                cache.record("core" + std::to_string(ii * 500 + jj), "localhost", 23500 + jj, 1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(cache.assignments().size(), 2000U);
+}
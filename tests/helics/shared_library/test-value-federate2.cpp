@@ -334,6 +334,39 @@ TEST_F(vfed2_tests, json_publish)
     CE(helicsFederateFinalize(vFed1, &err));
 }
 
+TEST_F(vfed2_tests, bulk_doubles)
+{
+    SetupTest(helicsCreateValueFederate, "test", 1);
+    auto vFed1 = GetFederateAt(0);
+    ASSERT_FALSE(vFed1 == nullptr);
+
+    auto pub1 =
+        helicsFederateRegisterGlobalPublication(vFed1, "pub1", HELICS_DATA_TYPE_DOUBLE, "", &err);
+    auto pub2 =
+        helicsFederateRegisterGlobalPublication(vFed1, "pub2", HELICS_DATA_TYPE_INT, "", &err);
+    HelicsInput inputs[2];
+    inputs[0] = helicsFederateRegisterSubscription(vFed1, "pub1", nullptr, &err);
+    inputs[1] = helicsFederateRegisterSubscription(vFed1, "pub2", nullptr, &err);
+    CE(helicsFederateEnterExecutingMode(vFed1, &err));
+
+    CE(helicsPublicationPublishDouble(pub1, 27.5, &err));
+    CE(helicsPublicationPublishInteger(pub2, 12, &err));
+    CE(helicsFederateRequestTime(vFed1, 1.0, &err));
+    double values[2] = {0.0, 0.0};
+    EXPECT_EQ(helicsFederateGetInputDoubles(vFed1, inputs, 2, values, &err), 2);
+    EXPECT_EQ(err.error_code, 0);
+    EXPECT_DOUBLE_EQ(values[0], 27.5);
+    EXPECT_DOUBLE_EQ(values[1], 12.0);
+    EXPECT_EQ(helicsInputIsUpdated(inputs[0]), HELICS_FALSE);
+
+    HelicsInput badInputs[2] = {inputs[0], nullptr};
+    EXPECT_EQ(helicsFederateGetInputDoubles(vFed1, badInputs, 2, values, &err), 0);
+    EXPECT_NE(err.error_code, 0);
+    helicsErrorClear(&err);
+
+    CE(helicsFederateFinalize(vFed1, &err));
+}
+
 TEST_F(vfed2_tests, json_register_publish)
 {
     SetupTest(helicsCreateValueFederate, "test", 1);
@@ -234,6 +234,50 @@ TEST_F(timing, simple_global_timing_message)
                         // it will time out.
 }
 
+TEST_F(timing, aggregated_time_updates)
+{
+    extraBrokerArgs = "--time_aggregation_threshold=2";
+    SetupTest<helics::ValueFederate>("test_2", 4);
+    std::vector<std::shared_ptr<helics::ValueFederate>> feds;
+    for (int ii = 0; ii < 4; ++ii) {
+        feds.push_back(GetFederateAs<helics::ValueFederate>(ii));
+        feds.back()->setProperty(HELICS_PROPERTY_TIME_PERIOD, 0.5);
+    }
+    auto& pub = feds[0]->registerGlobalPublication<double>("pub1");
+    std::vector<helics::Input*> subs;
+    for (int ii = 1; ii < 4; ++ii) {
+        subs.push_back(&feds[ii]->registerSubscription("pub1"));
+    }
+    for (auto& fed : feds) {
+        fed->enterExecutingModeAsync();
+    }
+    for (auto& fed : feds) {
+        fed->enterExecutingModeComplete();
+    }
+    for (int step = 1; step <= 4; ++step) {
+        const helics::Time stepTime(static_cast<double>(step));
+        for (auto& fed : feds) {
+            fed->requestTimeAsync(stepTime);
+        }
+        for (auto& fed : feds) {
+            EXPECT_EQ(fed->requestTimeComplete(), stepTime);
+        }
+    }
+    pub.publish(3.0);
+    for (auto& fed : feds) {
+        fed->requestTimeAsync(5.0);
+    }
+    EXPECT_EQ(feds[0]->requestTimeComplete(), 5.0);
+    for (int ii = 1; ii < 4; ++ii) {
+        // the value should show up at the next available time point
+        EXPECT_EQ(feds[ii]->requestTimeComplete(), 4.5);
+        EXPECT_DOUBLE_EQ(subs[ii - 1]->getValue<double>(), 3.0);
+    }
+    for (auto& fed : feds) {
+        fed->finalize();
+    }
+}
+
 TEST_F(timing, test_uninteruptible_flag)
 {
     SetupTest<helics::ValueFederate>("test", 2);